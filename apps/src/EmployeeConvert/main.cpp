@@ -0,0 +1,72 @@
+/**
+ * @file main.cpp
+ * @brief Command-line front end for core::General::EmployeeFileConverter.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ *
+ * Usage: EmployeeConvert <input> <output> [--layout compact|aligned] [--block N]
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+
+using namespace core;
+
+static int usage()
+{
+    std::cerr << "Usage: EmployeeConvert <input> <output> [--layout compact|aligned] [--block N]" << std::endl;
+    return 2;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+        return usage();
+
+    General::EmployeeLayout layout = General::EmployeeLayout::aligned;
+    uint32_t block_records = General::EmployeeFileHeader::DEFAULT_BLOCK_RECORDS;
+    for(int i = 3; i < argc; i += 2)
+    {
+        if(i + 1 >= argc)
+            return usage();
+
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if("--layout" == flag)
+        {
+            if("compact" == value)          layout = General::EmployeeLayout::compact;
+            else if("aligned" == value)     layout = General::EmployeeLayout::aligned;
+            else return usage();
+        }
+        else if("--block" == flag)
+            block_records = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        else
+            return usage();
+    }
+
+    General::File input = General::File::open(argv[1], GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                               OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(!input)
+    {
+        std::cerr << "Cannot open input file: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    General::File output = General::File::open(argv[2], GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                                                CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(!output)
+    {
+        std::cerr << "Cannot create output file: " << argv[2] << std::endl;
+        return 1;
+    }
+
+    if(!General::EmployeeFileConverter::run(input, output, layout, block_records))
+    {
+        std::cerr << "Conversion failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file main.cpp
+ * @brief Command-line front end for core::General::DatasetGenerator.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ *
+ * Usage: EmployeeGenerate <output> [--records N] [--seed S] [--ids sequential|uniform|zipf]
+ *        [--skew X] [--id-range N] [--names N] [--hours uniform|normal|exponential]
+ *        [--hours-min X] [--hours-max X] [--hours-mean X] [--hours-stddev X] [--hours-step X]
+ *        [--threads N] [--layout compact|aligned] [--block N]
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <core/General/DatasetGenerator.h>
+#include <core/General/File.h>
+
+using namespace core;
+
+static int usage()
+{
+    std::cerr << "Usage: EmployeeGenerate <output> [--records N] [--seed S] [--ids sequential|uniform|zipf]\n"
+                 "       [--skew X] [--id-range N] [--names N] [--hours uniform|normal|exponential]\n"
+                 "       [--hours-min X] [--hours-max X] [--hours-mean X] [--hours-stddev X] [--hours-step X]\n"
+                 "       [--threads N] [--layout compact|aligned] [--block N]" << std::endl;
+    return 2;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 2)
+        return usage();
+
+    General::DatasetOptions opts;
+    for(int i = 2; i < argc; i += 2)
+    {
+        if(i + 1 >= argc)
+            return usage();
+
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        const char* v = value.c_str();
+        if("--records" == flag)             opts.records = std::strtoull(v, nullptr, 10);
+        else if("--seed" == flag)           opts.seed = std::strtoull(v, nullptr, 10);
+        else if("--skew" == flag)           opts.zipf_skew = std::strtod(v, nullptr);
+        else if("--id-range" == flag)       opts.id_range = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        else if("--names" == flag)          opts.name_cardinality = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        else if("--hours-min" == flag)      opts.hours_min = std::strtod(v, nullptr);
+        else if("--hours-max" == flag)      opts.hours_max = std::strtod(v, nullptr);
+        else if("--hours-mean" == flag)     opts.hours_mean = std::strtod(v, nullptr);
+        else if("--hours-stddev" == flag)   opts.hours_stddev = std::strtod(v, nullptr);
+        else if("--hours-step" == flag)     opts.hours_step = std::strtod(v, nullptr);
+        else if("--threads" == flag)        opts.threads = static_cast<size_t>(std::strtoull(v, nullptr, 10));
+        else if("--block" == flag)          opts.block_records = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        else if("--ids" == flag)
+        {
+            if("sequential" == value)       opts.ids = General::IdDistribution::sequential;
+            else if("uniform" == value)     opts.ids = General::IdDistribution::uniform;
+            else if("zipf" == value)        opts.ids = General::IdDistribution::zipf;
+            else return usage();
+        }
+        else if("--hours" == flag)
+        {
+            if("uniform" == value)          opts.hours = General::HoursDistribution::uniform;
+            else if("normal" == value)      opts.hours = General::HoursDistribution::normal;
+            else if("exponential" == value) opts.hours = General::HoursDistribution::exponential;
+            else return usage();
+        }
+        else if("--layout" == flag)
+        {
+            if("compact" == value)          opts.layout = General::EmployeeLayout::compact;
+            else if("aligned" == value)     opts.layout = General::EmployeeLayout::aligned;
+            else return usage();
+        }
+        else
+            return usage();
+    }
+
+    General::File output = General::File::open(argv[1], GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                                                CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(!output)
+    {
+        std::cerr << "Cannot create output file: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    General::DatasetGenerator generator(opts);
+    if(!generator.write(output))
+    {
+        std::cerr << "Generation failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file main.cpp
+ * @brief Command-line front end for core::General::MapReduce.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ *
+ * Usage: EmployeeMapReduce <input> [--key name|id|id_bucket] [--bucket N] [--workers N]
+ *
+ * The same executable serves as its own worker: the driver restarts it
+ * with MapReduce::WORKER_FLAG for every range.
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <core/General/MapReduce.h>
+
+using namespace core;
+
+static int usage()
+{
+    std::cerr << "Usage: EmployeeMapReduce <input> [--key name|id|id_bucket] [--bucket N] [--workers N]" << std::endl;
+    return 2;
+}
+
+int main(int argc, char* argv[])
+{
+    if(General::MapReduce::is_worker(argc, argv))
+        return General::MapReduce::worker_main(argc, argv);
+    if(argc < 2)
+        return usage();
+
+    General::MapReduceOptions options;
+    for(int i = 2; i < argc; i += 2)
+    {
+        if(i + 1 >= argc)
+            return usage();
+
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if("--key" == flag)
+        {
+            if("name" == value)             options.key = General::GroupKey::name;
+            else if("id" == value)          options.key = General::GroupKey::id;
+            else if("id_bucket" == value)   options.key = General::GroupKey::id_bucket;
+            else return usage();
+        }
+        else if("--bucket" == flag)
+            options.bucket_width = static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+        else if("--workers" == flag)
+            options.workers = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else
+            return usage();
+    }
+
+    char self[MAX_PATH] = {};
+    if(0 == GetModuleFileNameA(nullptr, self, MAX_PATH))
+    {
+        std::cerr << "Cannot locate the worker executable." << std::endl;
+        return 1;
+    }
+
+    std::optional<General::GroupByResult> result = General::MapReduce::run(self, argv[1], options);
+    if(!result.has_value())
+    {
+        std::cerr << "Map-reduce failed." << std::endl;
+        return 1;
+    }
+
+    for(const General::GroupRow& g : result->rows)
+    {
+        if(General::GroupKey::name == options.key)
+            std::cout << result->names.name(static_cast<General::NameDictionary::Code>(g.key));
+        else
+            std::cout << g.key;
+        std::cout << '\t' << g.stats.count << '\t' << g.stats.hours_sum
+                  << '\t' << g.stats.hours_min << '\t' << g.stats.hours_max << '\n';
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file main.cpp
+ * @brief Command-line front end for core::General::ExternalSort.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ *
+ * Usage: ExternalSort <input> <output> [--key id|hours|name]
+ *                     [--memory MiB] [--threads N] [--temp DIR]
+ */
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <core/General/ExternalSort.h>
+#include <core/General/File.h>
+
+using namespace core;
+
+static int usage()
+{
+    std::cerr << "Usage: ExternalSort <input> <output> [--key id|hours|name]"
+                 " [--memory MiB] [--threads N] [--temp DIR]" << std::endl;
+    return 2;
+}
+
+int main(int argc, char* argv[])
+{
+    if(argc < 3)
+        return usage();
+
+    General::ExternalSortOptions options;
+    for(int i = 3; i < argc; i += 2)
+    {
+        if(i + 1 >= argc)
+            return usage();
+
+        std::string flag = argv[i];
+        std::string value = argv[i + 1];
+        if("--key" == flag)
+        {
+            if("id" == value)           options.key = General::SortKey::id;
+            else if("hours" == value)   options.key = General::SortKey::hours;
+            else if("name" == value)    options.key = General::SortKey::name;
+            else return usage();
+        }
+        else if("--memory" == flag)
+            options.memory_budget = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10)) << 20;
+        else if("--threads" == flag)
+            options.threads = static_cast<size_t>(std::strtoull(value.c_str(), nullptr, 10));
+        else if("--temp" == flag)
+            options.temp_directory = argv[i + 1];
+        else
+            return usage();
+    }
+
+    // Sequential-scan hints let the cache manager read ahead on both ends
+    General::File input = General::File::open(argv[1], GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                               OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(!input)
+    {
+        std::cerr << "Cannot open input file: " << argv[1] << std::endl;
+        return 1;
+    }
+
+    General::File output = General::File::open(argv[2], GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                                                CREATE_ALWAYS, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if(!output)
+    {
+        std::cerr << "Cannot create output file: " << argv[2] << std::endl;
+        return 1;
+    }
+
+    if(!General::ExternalSort::sort(input, output, options))
+    {
+        std::cerr << "Sort failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file AlignedEmployee.h
+ * @brief Cache-line-friendly 32-byte Employee record with naturally aligned fields.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef ALIGNED_EMPLOYEE_H
+#define ALIGNED_EMPLOYEE_H
+
+#include <cstdint>
+#include <cstddef>
+#include "Employee.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Record layout of a versioned Employee file or a mapped record array. */
+    enum class EmployeeLayout
+    {
+        compact,    /**< Employee::SERIALIZED_SIZE packed bytes per record; the default for cold storage. */
+        aligned     /**< AlignedEmployee::SIZE bytes per record with naturally aligned fields. */
+    };
+
+    /**
+     * @struct AlignedEmployee
+     * @brief Employee record padded to 32 bytes: hours at 0, id at 8, name at 10.
+     *
+     * The compact serialized record is 25 bytes, so records straddle cache
+     * lines and every field load is unaligned. In this layout two records
+     * fill a 64-byte line exactly and every field sits at its natural
+     * alignment, so arrays and mapped files can be read with plain aligned
+     * loads and gathers. The padding is always zero, so equal records have
+     * equal bytes and checksums are deterministic.
+     */
+    struct alignas(32) AlignedEmployee
+    {
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t SIZE = 32;   /**< Record size in bytes. */
+        /** @} */
+
+        double hours;                                          /**< Hours worked. */
+        Employee::ID_TYPE id;                                  /**< Employee id. */
+        char name[Employee::BUFF_SIZE];                        /**< Name; not terminated when full. */
+        char reserved[SIZE - sizeof(double) - sizeof(Employee::ID_TYPE) - Employee::BUFF_SIZE]; /**< Zero. */
+
+        /** @brief Converts one compact serialized record. */
+        static AlignedEmployee from_record(const char* record) noexcept;
+
+        /** @brief Converts an Employee. */
+        static AlignedEmployee from_employee(const Employee& e) noexcept;
+
+        /** @brief Writes this record in the compact layout (Employee::SERIALIZED_SIZE bytes). */
+        void to_record(char* record) const noexcept;
+
+        /** @return The record as an Employee. */
+        Employee employee() const;
+
+        /** @brief Converts @p n compact records into @p out. */
+        static void from_records(const char* records, size_t n, AlignedEmployee* out) noexcept;
+
+        /** @brief Converts @p n aligned records into compact records at @p out. */
+        static void to_records(const AlignedEmployee* in, size_t n, char* out) noexcept;
+    };
+
+    static_assert(sizeof(AlignedEmployee) == AlignedEmployee::SIZE, "Aligned records must be 32 bytes");
+    static_assert(offsetof(AlignedEmployee, hours) == 0 && offsetof(AlignedEmployee, id) == 8
+                  && offsetof(AlignedEmployee, name) == 10, "Aligned record field offsets are part of the file format");
+} // namespace core::General
+
+#endif // ALIGNED_EMPLOYEE_H
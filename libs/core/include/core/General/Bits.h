@@ -0,0 +1,84 @@
+/**
+ * @file Bits.h
+ * @brief Portable bit-scan helpers over 64-bit words.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef BITS_H
+#define BITS_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class Bits
+     * @brief Compiler intrinsics for bit scans, with the same results on MSVC and GCC/Clang.
+     */
+    class Bits
+    {
+    public:
+        /** @return Number of zero bits above the highest set bit; 64 for 0. */
+        static unsigned leading_zeros(uint64_t v) noexcept
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long i;
+            return _BitScanReverse64(&i, v) ? 63u - i : 64u;
+#elif defined(_MSC_VER)
+            unsigned long i;
+            if(_BitScanReverse(&i, static_cast<uint32_t>(v >> 32)))
+                return 31u - i;
+            return _BitScanReverse(&i, static_cast<uint32_t>(v)) ? 63u - i : 64u;
+#else
+            return 0 == v ? 64u : static_cast<unsigned>(__builtin_clzll(v));
+#endif
+        }
+
+        /** @return Number of zero bits below the lowest set bit; 64 for 0. */
+        static unsigned trailing_zeros(uint64_t v) noexcept
+        {
+#if defined(_MSC_VER) && defined(_M_X64)
+            unsigned long i;
+            return _BitScanForward64(&i, v) ? i : 64u;
+#elif defined(_MSC_VER)
+            unsigned long i;
+            if(_BitScanForward(&i, static_cast<uint32_t>(v)))
+                return i;
+            return _BitScanForward(&i, static_cast<uint32_t>(v >> 32)) ? 32u + i : 64u;
+#else
+            return 0 == v ? 64u : static_cast<unsigned>(__builtin_ctzll(v));
+#endif
+        }
+
+        /**
+         * @return Number of set bits.
+         * @note MSVC's __popcnt64 emits POPCNT unconditionally, so MSVC builds use the SWAR count.
+         */
+        static unsigned popcount(uint64_t v) noexcept
+        {
+#if defined(_MSC_VER)
+            v = v - ((v >> 1) & 0x5555555555555555ull);
+            v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+            v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+            return static_cast<unsigned>((v * 0x0101010101010101ull) >> 56);
+#else
+            return static_cast<unsigned>(__builtin_popcountll(v));
+#endif
+        }
+
+        /** @return Bits needed to store @p v; 0 for 0. */
+        static unsigned width(uint64_t v) noexcept
+        { return 64u - leading_zeros(v); }
+    };
+} // namespace core::General
+
+#endif // BITS_H
@@ -0,0 +1,139 @@
+/**
+ * @file BufferedIO.h
+ * @brief Large-buffer sequential reader and writer on top of File.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef BUFFERED_IO_H
+#define BUFFERED_IO_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class BufferedReader
+     * @brief Sequential reader over a byte range of a File.
+     *
+     * Uses positional reads, so several readers may stream different ranges
+     * of the same handle at once. The File must outlive the reader.
+     */
+    class BufferedReader
+    {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 1u << 20; /**< 1 MiB. */
+
+    private:
+        const File* file_;        /**< Source file (not owned). */
+        uint64_t next_;           /**< Next file offset to fetch. */
+        uint64_t end_;            /**< End of the readable range. */
+        std::vector<char> buf_;   /**< Read buffer. */
+        size_t head_;             /**< First unread byte in buf_. */
+        size_t tail_;             /**< One past the last valid byte in buf_. */
+        bool ok_;                 /**< false after a failed read. */
+
+    public:
+        /**
+         * @brief Prepares a reader for [begin, end) of @p file. No I/O happens here.
+         * @param buffer_size Bytes fetched per read call.
+         */
+        BufferedReader(const File& file, uint64_t begin, uint64_t end,
+                       size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+        /** @brief Move constructor. */
+        BufferedReader(BufferedReader&&) noexcept = default;
+        /** @brief Move assignment. */
+        BufferedReader& operator=(BufferedReader&&) noexcept = default;
+        /** @brief Copying is deleted; readers track private positions. */
+        BufferedReader(const BufferedReader&) = delete;
+        /** @brief Copying is deleted; readers track private positions. */
+        BufferedReader& operator=(const BufferedReader&) = delete;
+
+        /**
+         * @brief Returns a pointer to the next @p n bytes without consuming them.
+         * @return nullptr if fewer than @p n bytes remain or a read failed.
+         * @note The pointer is valid until the next call on this reader.
+         */
+        const char* peek(size_t n) noexcept;
+
+        /** @brief Consumes @p n bytes previously made available by peek(). */
+        void skip(size_t n) noexcept;
+
+        /** @brief Copies the next @p n bytes into @p dst. */
+        bool read(char* dst, size_t n) noexcept;
+
+        /** @return Number of bytes not consumed yet. */
+        uint64_t remaining() const noexcept;
+
+        /** @return false if an underlying read failed. */
+        bool good() const noexcept;
+    };
+
+    /**
+     * @class BufferedWriter
+     * @brief Sequential writer that batches small writes into large positional writes.
+     *
+     * Data is written starting at a fixed offset and the buffer is flushed on
+     * destruction. The File must outlive the writer.
+     */
+    class BufferedWriter
+    {
+    public:
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 1u << 20; /**< 1 MiB. */
+
+    private:
+        const File* file_;        /**< Destination file (not owned). */
+        uint64_t offset_;         /**< File offset where buf_ starts. */
+        std::vector<char> buf_;   /**< Write buffer. */
+        size_t used_;             /**< Bytes pending in buf_. */
+        bool ok_;                 /**< false after a failed write. */
+
+    public:
+        /**
+         * @brief Prepares a writer that appends from @p offset.
+         * @param buffer_size Bytes accumulated before a write call.
+         */
+        BufferedWriter(const File& file, uint64_t offset = 0,
+                       size_t buffer_size = DEFAULT_BUFFER_SIZE);
+
+        /** @brief Move constructor. The source no longer flushes. */
+        BufferedWriter(BufferedWriter&& other) noexcept;
+        /** @brief Copying is deleted; pending data must be flushed once. */
+        BufferedWriter(const BufferedWriter&) = delete;
+        /** @brief Copying is deleted; pending data must be flushed once. */
+        BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+        /** @brief Destructor. Flushes pending data. */
+        ~BufferedWriter() noexcept;
+
+        /** @brief Appends @p n bytes. Large blocks bypass the buffer. */
+        bool write(const char* src, size_t n) noexcept;
+
+        /**
+         * @brief Returns space for @p n contiguous bytes inside the buffer.
+         * @return nullptr if @p n exceeds the buffer size or a flush failed.
+         * @note The caller must fill all @p n bytes before the next call.
+         */
+        char* reserve(size_t n) noexcept;
+
+        /** @brief Writes pending data to the file. */
+        bool flush() noexcept;
+
+        /** @return File offset just past the last byte written or buffered. */
+        uint64_t offset() const noexcept;
+
+        /** @return false if an underlying write failed. */
+        bool good() const noexcept;
+    };
+
+} // namespace core::General
+
+#endif // BUFFERED_IO_H
@@ -0,0 +1,41 @@
+/**
+ * @file Checksum.h
+ * @brief CRC-32C checksums for on-disk blocks.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class Checksum
+     * @brief CRC-32C (Castagnoli) over byte ranges.
+     *
+     * Uses the SSE4.2 crc32 instruction when the build targets it and a
+     * slice-by-8 table otherwise; both produce identical values.
+     */
+    class Checksum
+    {
+    public:
+        /**
+         * @brief Computes or continues a CRC-32C.
+         * @param data Bytes to checksum.
+         * @param size Number of bytes.
+         * @param crc Result of a previous call to continue a running checksum, 0 to start.
+         * @return The updated checksum.
+         */
+        static uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0) noexcept;
+    };
+} // namespace core::General
+
+#endif // CHECKSUM_H
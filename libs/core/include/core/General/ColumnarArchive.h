@@ -0,0 +1,187 @@
+/**
+ * @file ColumnarArchive.h
+ * @brief Compressed columnar block format for Employee archives.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef COLUMNAR_ARCHIVE_H
+#define COLUMNAR_ARCHIVE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class ColumnarArchive
+     * @brief Read-only handle to an archive of compressed column blocks.
+     *
+     * Rows are grouped into blocks of a fixed number of rows, and each block
+     * stores its three columns separately:
+     * - ids as zigzag deltas from the previous id, bit-packed to the widest delta;
+     * - names through a per-block dictionary of distinct 15-byte cells and
+     *   bit-packed codes;
+     * - hours XOR-compressed against the previous value (Gorilla encoding),
+     *   or raw when that does not pay off.
+     *
+     * A directory at the end of the file keeps the offset, size, checksum and
+     * min/max statistics of every block. Only the directory is held in
+     * memory, so range scans skip blocks whose statistics cannot match
+     * without reading them.
+     *
+     * File layout: [Header][Block * block_count][BlockInfo * block_count]
+     */
+    class ColumnarArchive
+    {
+    public:
+        /** @brief Directory entry: where a block lives and what it contains. */
+        struct BlockInfo
+        {
+            uint64_t offset;               /**< Byte offset of the encoded block. */
+            uint32_t size;                 /**< Encoded size in bytes. */
+            uint32_t rows;                 /**< Number of rows in the block. */
+            uint32_t crc;                  /**< CRC-32C of the encoded block. */
+            Employee::ID_TYPE id_min;      /**< Smallest id in the block. */
+            Employee::ID_TYPE id_max;      /**< Largest id in the block. */
+            double hours_min;              /**< Smallest hours value; NaN values are ignored. */
+            double hours_max;              /**< Largest hours value; NaN values are ignored. */
+        };
+
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x43504D45;             /**< "EMPC" in little-endian order. */
+        static constexpr uint32_t VERSION = 1;                    /**< On-disk format version. */
+        static constexpr uint32_t DEFAULT_BLOCK_ROWS = 65536;     /**< Rows per block. */
+        /** @} */
+
+    private:
+        File file_;                       /**< Open archive file. */
+        uint64_t rows_;                   /**< Total number of rows. */
+        std::vector<BlockInfo> blocks_;   /**< Block directory. */
+
+    public:
+        /** @name Lifecycle Management
+         *  @{ */
+
+        /** @brief Constructs an empty archive. */
+        ColumnarArchive() noexcept;
+
+        /** @brief Copying is deleted because the object owns a file handle. */
+        ColumnarArchive(const ColumnarArchive&) = delete;
+        /** @brief Copying is deleted because the object owns a file handle. */
+        ColumnarArchive& operator=(const ColumnarArchive&) = delete;
+
+        /** @brief Move constructor. */
+        ColumnarArchive(ColumnarArchive&& other) noexcept = default;
+        /** @brief Move assignment. */
+        ColumnarArchive& operator=(ColumnarArchive&& other) noexcept = default;
+
+        /** @brief Default destructor. Closes the archive file. */
+        ~ColumnarArchive() noexcept = default;
+
+        /**
+         * @brief Opens an archive and loads its block directory.
+         * @param file Readable archive file. Ownership is taken.
+         * @return The archive, or std::nullopt if the header or directory is invalid.
+         */
+        static std::optional<ColumnarArchive> open(File&& file);
+        /** @} */
+
+        /** @name Queries
+         *  @{ */
+
+        /** @return Total number of rows. */
+        uint64_t size() const noexcept;
+
+        /** @return Number of blocks. */
+        size_t block_count() const noexcept;
+
+        /** @return Directory entry of block @p b. */
+        const BlockInfo& block(size_t b) const noexcept;
+
+        /**
+         * @brief Decodes block @p b and appends its rows to @p out.
+         * @return false if the block cannot be read or fails its checksum.
+         */
+        bool read_block(size_t b, EmployeeColumns& out) const;
+
+        /** @brief Decodes every block into @p out. */
+        bool read_all(EmployeeColumns& out) const;
+
+        /**
+         * @brief Appends the rows with hours in [lo, hi] to @p out.
+         *
+         * Blocks whose [hours_min, hours_max] does not overlap [lo, hi] are
+         * skipped without being read.
+         *
+         * @param blocks_read Optional counter of blocks that had to be decoded.
+         */
+        bool scan_hours(double lo, double hi, EmployeeColumns& out, size_t* blocks_read = nullptr) const;
+        /** @} */
+    };
+
+    /**
+     * @class ColumnarArchiveWriter
+     * @brief Encodes rows into a new columnar archive one block at a time.
+     *
+     * At most one block of rows is held in memory. The directory and then
+     * the header are written by finish(), so an unfinished archive never
+     * opens. The File must outlive the writer.
+     */
+    class ColumnarArchiveWriter
+    {
+    private:
+        const File* file_;                                /**< Destination (not owned). */
+        uint32_t block_rows_;                             /**< Rows per block. */
+        uint64_t offset_;                                 /**< Where the next block goes. */
+        uint64_t rows_;                                   /**< Rows written so far. */
+        EmployeeColumns pending_;                         /**< Rows of the open block. */
+        std::vector<char> encoded_;                       /**< Reused encoding buffer. */
+        std::vector<ColumnarArchive::BlockInfo> blocks_;  /**< Directory of written blocks. */
+        bool ok_;                                         /**< No write has failed. */
+        bool finished_;                                   /**< finish() has been called. */
+
+        /** @brief Encodes and writes the pending rows as one block. */
+        bool flush_block_();
+
+    public:
+        /**
+         * @brief Prepares a writer for @p file.
+         * @param block_rows Rows per block; larger blocks compress better, smaller ones skip finer.
+         */
+        explicit ColumnarArchiveWriter(const File& file,
+                                       uint32_t block_rows = ColumnarArchive::DEFAULT_BLOCK_ROWS);
+
+        /** @brief Copying is deleted; an archive has one writer. */
+        ColumnarArchiveWriter(const ColumnarArchiveWriter&) = delete;
+        /** @brief Copying is deleted; an archive has one writer. */
+        ColumnarArchiveWriter& operator=(const ColumnarArchiveWriter&) = delete;
+
+        /** @brief Appends one row. */
+        bool append(const Employee& e);
+
+        /** @brief Appends @p n serialized records. */
+        bool append_records(const char* records, size_t n);
+
+        /** @brief Appends every row of @p table. */
+        bool append(const EmployeeColumns& table);
+
+        /** @brief Writes the last block, the directory and the header. */
+        bool finish();
+
+        /** @return Rows appended so far. */
+        uint64_t count() const noexcept;
+    };
+} // namespace core::General
+
+#endif // COLUMNAR_ARCHIVE_H
@@ -0,0 +1,117 @@
+/**
+ * @file DatasetGenerator.h
+ * @brief Deterministic parallel generator of synthetic Employee files.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef DATASET_GENERATOR_H
+#define DATASET_GENERATOR_H
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <string>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeFile.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief How ids are drawn. */
+    enum class IdDistribution
+    {
+        sequential,   /**< first, first + 1, ... wrapping at id_range. */
+        uniform,      /**< Uniform over [0, id_range). */
+        zipf          /**< Zipf over [0, id_range); id 0 is the most frequent. */
+    };
+
+    /** @brief How hours are drawn. */
+    enum class HoursDistribution
+    {
+        uniform,      /**< Uniform over [hours_min, hours_max). */
+        normal,       /**< Normal with hours_mean and hours_stddev. */
+        exponential   /**< Exponential with hours_mean. */
+    };
+
+    /** @brief Shape of a generated dataset. */
+    struct DatasetOptions
+    {
+        uint64_t records = 1000000;                           /**< Records to produce. */
+        uint64_t seed = 1;                                    /**< Same seed, same file, whatever the thread count. */
+        IdDistribution ids = IdDistribution::uniform;         /**< Id distribution. */
+        uint32_t id_range = uint32_t(Employee::ID_MAX) + 1;   /**< Ids fall in [0, id_range); clamped to the id type. */
+        double zipf_skew = 1.0;                               /**< Zipf exponent; larger is more skewed. */
+        uint32_t name_cardinality = 1000;                     /**< Distinct names, drawn uniformly. */
+        HoursDistribution hours = HoursDistribution::uniform; /**< Hours distribution. */
+        double hours_min = 0.0;                               /**< Uniform lower bound. */
+        double hours_max = 200.0;                             /**< Uniform upper bound. */
+        double hours_mean = 40.0;                             /**< Normal and exponential mean. */
+        double hours_stddev = 10.0;                           /**< Normal standard deviation. */
+        double hours_step = 0.0;                              /**< Rounds hours to a multiple of this if positive. */
+        size_t threads = 0;                                   /**< Worker threads, 0 = one per core. */
+        EmployeeLayout layout = EmployeeLayout::compact;      /**< Record layout of the output. */
+        uint32_t block_records = EmployeeFileHeader::DEFAULT_BLOCK_RECORDS; /**< Records per checksum block. */
+        size_t buffer_size = 8u << 20;                        /**< Write buffer; large writes keep the disk streaming. */
+    };
+
+    /**
+     * @class DatasetGenerator
+     * @brief Produces versioned Employee files of any size for load tests and benchmarks.
+     *
+     * Every record is generated from its own random state, derived from the
+     * seed and the record index. Chunks can therefore be produced by any
+     * number of threads in any order and the file comes out byte-identical.
+     * Each round, the workers fill one chunk each, already serialized in the
+     * output layout. The calling thread then hands the chunks to
+     * EmployeeFileWriter in order.
+     *
+     * Zipf ids use rejection-inversion sampling: O(1) per draw with no table,
+     * for any id range and any positive exponent.
+     */
+    class DatasetGenerator
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t CHUNK_RECORDS = 65536;   /**< Records per worker per round. */
+        /** @} */
+
+    private:
+        DatasetOptions opts_;                                        /**< Normalized options. */
+        std::vector<std::array<char, Employee::BUFF_SIZE>> names_;   /**< Name table. */
+        double zipf_h_x1_, zipf_h_n_, zipf_s_;                       /**< Rejection-inversion constants. */
+
+        double zipf_h_(double x) const noexcept;
+        double zipf_h_integral_(double x) const noexcept;
+        double zipf_h_integral_inverse_(double x) const noexcept;
+        uint64_t zipf_(uint64_t& state) const noexcept;
+
+    public:
+        /** @brief Prepares a generator; out-of-range options are clamped. */
+        explicit DatasetGenerator(const DatasetOptions& opts);
+
+        /** @return The options in effect after clamping. */
+        const DatasetOptions& options() const noexcept;
+
+        /** @return Name number @p i of the name table. */
+        std::string name(uint32_t i) const;
+
+        /**
+         * @brief Serializes records [first, first + n) in the compact layout.
+         *
+         * Thread-safe; the result depends only on the options and the range.
+         */
+        void generate(uint64_t first, size_t n, char* records) const noexcept;
+
+        /** @brief Writes the whole dataset to @p out as a versioned Employee file. */
+        bool write(const File& out) const;
+    };
+} // namespace core::General
+
+#endif // DATASET_GENERATOR_H
@@ -9,7 +9,9 @@
 #define EMPLOYEE_H
 
 #include <cstdint>
+#include <cstddef>
 #include <array>
+#include "RecordSchema.h"
 
 /**
  * @namespace core::General
@@ -36,10 +38,22 @@ namespace core::General
         static const ID_TYPE ID_MAX = UINT16_MAX;      /**< Maximum allowed ID value. */
         static const ID_TYPE ID_MIN = 0;               /**< Minimum allowed ID value. */
         static const size_t  BUFF_SIZE = 15;           /**< Fixed size for the name buffer. */
-        /** @brief Total size of the object when serialized to binary. */
-        static constexpr size_t SERIALIZED_SIZE = sizeof(ID_TYPE) + sizeof(double) + BUFF_SIZE;
         /** @} */
 
+        /** @brief Binary layout: [ID][Hours][NameBuffer], packed without padding. */
+        typedef RecordSchema<Field<ID_TYPE>, Field<double>, Field<char, BUFF_SIZE>> Schema;
+
+        /** @name Schema Field Indices
+         *  Used with Schema::read<>() to project single fields out of a record.
+         *  @{ */
+        static constexpr size_t FIELD_ID = 0;          /**< Position of the ID field. */
+        static constexpr size_t FIELD_HOURS = 1;       /**< Position of the hours field. */
+        static constexpr size_t FIELD_NAME = 2;        /**< Position of the name buffer. */
+        /** @} */
+
+        /** @brief Total size of the object when serialized to binary. */
+        static constexpr size_t SERIALIZED_SIZE = Schema::SIZE;
+
     private:
         ID_TYPE id_;               /**< Unique identifier for the employee. */
         char name_[BUFF_SIZE];     /**< Fixed-size character array for the name. */
@@ -84,6 +98,22 @@ namespace core::General
          */
         static Employee deserialize(const char* s);
 
+        /**
+         * @brief Serializes @p n objects into consecutive records.
+         * @param src Source objects.
+         * @param n Number of objects.
+         * @param out Destination buffer of at least n * SERIALIZED_SIZE bytes.
+         */
+        static void serialize_batch(const Employee* src, size_t n, char* out) noexcept;
+
+        /**
+         * @brief Reconstructs @p n objects from consecutive records.
+         * @param in Source buffer of at least n * SERIALIZED_SIZE bytes.
+         * @param n Number of records.
+         * @param out Destination objects.
+         */
+        static void deserialize_batch(const char* in, size_t n, Employee* out) noexcept;
+
         /** @brief Default copy assignment operator. */
         Employee& operator=(const Employee& other) noexcept = default;
         
@@ -0,0 +1,91 @@
+/**
+ * @file EmployeeColumns.h
+ * @brief Column-oriented in-memory table of Employee records.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EMPLOYEE_COLUMNS_H
+#define EMPLOYEE_COLUMNS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include "Employee.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class EmployeeColumns
+     * @brief Stores ids, hours and names in three parallel arrays.
+     *
+     * Scans and sorts that touch one field read only that field's array,
+     * which keeps them dense in cache and friendly to vectorization.
+     */
+    class EmployeeColumns
+    {
+    public:
+        /** @brief Fixed-size name cell, same layout as the Employee name buffer. */
+        typedef std::array<char, Employee::BUFF_SIZE> Name;
+
+    private:
+        std::vector<Employee::ID_TYPE> ids_;   /**< Id column. */
+        std::vector<double> hours_;            /**< Hours column. */
+        std::vector<Name> names_;              /**< Name column. */
+
+    public:
+        /** @brief Constructs an empty table. */
+        EmployeeColumns() noexcept = default;
+
+        /** @brief Builds a table from @p n consecutive serialized records. */
+        static EmployeeColumns from_records(const char* records, size_t n);
+
+        /** @name Size Management
+         *  @{ */
+        size_t size() const noexcept;      /**< @return Number of rows. */
+        bool empty() const noexcept;       /**< @return true if there are no rows. */
+        void reserve(size_t n);            /**< @brief Reserves capacity in every column. */
+        void resize(size_t n);             /**< @brief Resizes every column; new rows are zeroed. */
+        void clear() noexcept;             /**< @brief Removes all rows, keeping capacity. */
+        /** @} */
+
+        /** @name Row Access
+         *  @{ */
+
+        /** @brief Appends a row. */
+        void push_back(const Employee& e);
+
+        /** @brief Appends a row decoded from one serialized record. */
+        void push_back_record(const char* record);
+
+        /** @brief Materializes row @p i as an Employee. */
+        Employee employee(size_t i) const noexcept;
+
+        /** @brief Serializes row @p i into @p out (Employee::SERIALIZED_SIZE bytes). */
+        void serialize_row(size_t i, char* out) const noexcept;
+        /** @} */
+
+        /** @name Column Access
+         *  @{ */
+        const std::vector<Employee::ID_TYPE>& ids() const noexcept;  /**< @return Id column. */
+        const std::vector<double>& hours() const noexcept;           /**< @return Hours column. */
+        const std::vector<Name>& names() const noexcept;             /**< @return Name column. */
+        std::vector<Employee::ID_TYPE>& ids() noexcept;              /**< @return Mutable id column. */
+        std::vector<double>& hours() noexcept;                       /**< @return Mutable hours column. */
+        std::vector<Name>& names() noexcept;                         /**< @return Mutable name column. */
+        /** @} */
+
+        /**
+         * @brief Reorders all columns so that new row i is old row order[i].
+         * @param order A permutation of [0, size()).
+         */
+        void permute(const std::vector<uint32_t>& order);
+    };
+} // namespace core::General
+
+#endif // EMPLOYEE_COLUMNS_H
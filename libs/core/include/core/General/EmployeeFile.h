@@ -0,0 +1,254 @@
+/**
+ * @file EmployeeFile.h
+ * @brief Self-describing Employee file format: header, writer and reader.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EMPLOYEE_FILE_H
+#define EMPLOYEE_FILE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "AlignedEmployee.h"
+#include "BufferedIO.h"
+#include "Employee.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @struct EmployeeFileHeader
+     * @brief Fixed 64-byte header at the start of a versioned Employee file.
+     *
+     * File layout: [Header][Record * record_count][uint32 CRC-32C * block_count]
+     *
+     * Every size in the file follows from the header, so a reader validates
+     * the layout against the file size in O(1) and finds record i at
+     * data_offset + i * record_size. Each block of block_records records has
+     * its own checksum, so integrity checks can be limited to the blocks
+     * actually read.
+     *
+     * FLAG_ALIGNED marks the 32-byte AlignedEmployee layout. data_offset is
+     * a multiple of 32, so in a mapped view every aligned record starts on a
+     * 32-byte boundary.
+     */
+    struct EmployeeFileHeader
+    {
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x46504D45;           /**< "EMPF" in little-endian order. */
+        static constexpr uint16_t VERSION = 1;                  /**< Current format version. */
+        static constexpr uint16_t ENDIAN_MARKER = 0x0102;       /**< Reads as 0x0201 on an opposite-endian host. */
+        static constexpr uint32_t SIZE = 64;                    /**< Encoded header size in bytes. */
+        static constexpr uint32_t DEFAULT_BLOCK_RECORDS = 16384; /**< Records per checksum block (~400 KiB). */
+        /** @} */
+
+        /** @name Layout Flags
+         *  @{ */
+        static constexpr uint32_t FLAG_ALIGNED = 1;             /**< Records use the AlignedEmployee layout. */
+        static constexpr uint32_t KNOWN_FLAGS = FLAG_ALIGNED;   /**< Files with any other flag are rejected. */
+        /** @} */
+
+        uint16_t version = VERSION;            /**< Format version of the file. */
+        bool host_order = true;                /**< false if the file was written on an opposite-endian host. */
+        uint32_t flags = 0;                    /**< Combination of FLAG_* values. */
+        uint32_t record_size = Employee::SERIALIZED_SIZE;  /**< Bytes per record. */
+        uint32_t block_records = DEFAULT_BLOCK_RECORDS;    /**< Records per checksum block. */
+        uint64_t record_count = 0;             /**< Number of records. */
+        uint64_t data_offset = SIZE;           /**< Offset of record 0. */
+        uint64_t table_offset = SIZE;          /**< Offset of the block checksum table. */
+        uint64_t block_count = 0;              /**< Entries in the checksum table. */
+
+        /**
+         * @brief Reads and validates the header of @p file.
+         * @return The header, or std::nullopt if the magic, version, checksum
+         *         or any size disagrees with the file.
+         */
+        static std::optional<EmployeeFileHeader> read(const File& file) noexcept;
+
+        /** @brief Writes the header at offset 0 in host byte order. */
+        bool write(const File& file) const noexcept;
+
+        /** @return Byte offset of record @p i. */
+        uint64_t record_offset(uint64_t i) const noexcept;
+
+        /** @return Record layout selected by the flags. */
+        EmployeeLayout layout() const noexcept;
+
+        /** @return true if compact records can be used in place without conversion. */
+        bool native_layout() const noexcept;
+
+        /** @return true if aligned records can be used in place without conversion. */
+        bool aligned_layout() const noexcept;
+
+        /** @return Total file size implied by the header. */
+        uint64_t file_size() const noexcept;
+    };
+
+    /**
+     * @class EmployeeFileWriter
+     * @brief Streams records into a new versioned Employee file.
+     *
+     * Records go through a large BufferedWriter while block checksums are
+     * accumulated. finish() writes the checksum table and then the header,
+     * so an interrupted file never validates. The File must outlive the writer.
+     *
+     * Every append overload accepts input in either layout and converts it
+     * to the layout chosen at construction.
+     */
+    class EmployeeFileWriter
+    {
+    private:
+        const File* file_;                 /**< Destination (not owned). */
+        BufferedWriter out_;               /**< Sequential record writer. */
+        EmployeeFileHeader header_;        /**< Header being built. */
+        std::vector<uint32_t> checksums_;  /**< Completed block checksums. */
+        uint32_t crc_;                     /**< Running checksum of the open block. */
+        uint32_t in_block_;                /**< Records in the open block. */
+        bool finished_;                    /**< finish() has been called. */
+
+        /** @brief Counts @p n written records and folds them into the block checksums. */
+        void account_(const char* records, size_t n) noexcept;
+
+        /** @brief Writes @p n records produced by @p convert(dst, first, count) in the file layout. */
+        template <class Convert>
+        bool append_converted_(size_t n, Convert&& convert) noexcept;
+
+    public:
+        /**
+         * @brief Prepares a writer for @p file; the header is written by finish().
+         * @param block_records Records per checksum block.
+         * @param buffer_size Write buffer size in bytes.
+         * @param layout Record layout of the new file.
+         */
+        explicit EmployeeFileWriter(const File& file,
+                                    uint32_t block_records = EmployeeFileHeader::DEFAULT_BLOCK_RECORDS,
+                                    size_t buffer_size = 4u << 20,
+                                    EmployeeLayout layout = EmployeeLayout::compact);
+
+        /** @brief Copying is deleted; a file has one writer. */
+        EmployeeFileWriter(const EmployeeFileWriter&) = delete;
+        /** @brief Copying is deleted; a file has one writer. */
+        EmployeeFileWriter& operator=(const EmployeeFileWriter&) = delete;
+
+        /** @brief Appends one Employee. */
+        bool append(const Employee& e) noexcept;
+
+        /** @brief Appends @p n Employees through the batch serializer. */
+        bool append(const Employee* src, size_t n) noexcept;
+
+        /** @brief Appends @p n already serialized compact records. */
+        bool append_records(const char* records, size_t n) noexcept;
+
+        /** @brief Appends @p n aligned records. */
+        bool append_aligned(const AlignedEmployee* records, size_t n) noexcept;
+
+        /** @brief Writes the checksum table and the header. */
+        bool finish() noexcept;
+
+        /** @return Records appended so far. */
+        uint64_t count() const noexcept;
+    };
+
+    /**
+     * @class EmployeeFileReader
+     * @brief Random-access reader over a versioned or legacy Employee file.
+     *
+     * Legacy files are bare SERIALIZED_SIZE records with no header and no
+     * checksums; they are accepted when their size is a whole number of
+     * records and they do not start with the header magic. The File must
+     * outlive the reader.
+     *
+     * read() always produces compact records and read_aligned() always
+     * produces aligned ones, whatever the layout on disk.
+     */
+    class EmployeeFileReader
+    {
+    private:
+        const File* file_;            /**< Source (not owned). */
+        EmployeeFileHeader header_;   /**< Validated or synthesized header. */
+        bool versioned_;              /**< false for a legacy headerless file. */
+
+        EmployeeFileReader(const File& file, const EmployeeFileHeader& header, bool versioned) noexcept;
+
+    public:
+        /**
+         * @brief Probes @p file in O(1) and prepares a reader.
+         * @return std::nullopt if the file is neither a valid versioned file
+         *         nor a plausible legacy file.
+         */
+        static std::optional<EmployeeFileReader> open(const File& file) noexcept;
+
+        /** @return The validated header; synthesized for legacy files. */
+        const EmployeeFileHeader& header() const noexcept;
+
+        /** @return true if the file has a versioned header and checksums. */
+        bool versioned() const noexcept;
+
+        /** @return Number of records. */
+        uint64_t size() const noexcept;
+
+        /** @return true if compact records can be read straight into caller buffers. */
+        bool zero_copy() const noexcept;
+
+        /**
+         * @brief Reads records [first, first + n) into @p out in host layout.
+         * @param out Destination of n * Employee::SERIALIZED_SIZE bytes.
+         */
+        bool read(uint64_t first, size_t n, char* out) const noexcept;
+
+        /** @brief Reads records [first, first + n) into @p out as aligned records. */
+        bool read_aligned(uint64_t first, size_t n, AlignedEmployee* out) const noexcept;
+
+        /** @return Record @p i, or std::nullopt if out of range or unreadable. */
+        std::optional<Employee> at(uint64_t i) const noexcept;
+
+        /** @brief Checks the stored checksum of block @p b. Legacy files always pass. */
+        bool verify_block(uint64_t b) const;
+
+        /** @brief Checks every block. */
+        bool verify() const;
+
+        /**
+         * @brief CRC-32C of the stored block checksum table.
+         *
+         * Reads only the table, so it is cheap even for large files, and it
+         * changes whenever a block is rewritten and its checksum refreshed.
+         * @return The checksum, 0 for legacy files, or std::nullopt if the table cannot be read.
+         */
+        std::optional<uint32_t> table_checksum() const;
+    };
+
+    /**
+     * @class EmployeeFileConverter
+     * @brief Rewrites an Employee file in another record layout.
+     *
+     * Keeps the compact layout for cold storage and produces the aligned one
+     * for hot, mapped or SIMD-heavy access, or the other way round.
+     */
+    class EmployeeFileConverter
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t BATCH_RECORDS = 65536;   /**< Records per read. */
+        /** @} */
+
+        /**
+         * @brief Copies every record of @p in (versioned or legacy) into a new
+         *        versioned file @p out with the given layout.
+         * @return true if the whole file was converted and @p out finished.
+         */
+        static bool run(const File& in, const File& out, EmployeeLayout layout,
+                        uint32_t block_records = EmployeeFileHeader::DEFAULT_BLOCK_RECORDS);
+    };
+} // namespace core::General
+
+#endif // EMPLOYEE_FILE_H
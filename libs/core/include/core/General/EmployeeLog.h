@@ -0,0 +1,196 @@
+/**
+ * @file EmployeeLog.h
+ * @brief Append-only Employee store with segment rotation and background compaction.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EMPLOYEE_LOG_H
+#define EMPLOYEE_LOG_H
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "BufferedIO.h"
+#include "Employee.h"
+#include "File.h"
+#include "GroupBy.h"
+#include "HoursAggregate.h"
+#include "Thread.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Options for EmployeeLog. */
+    struct EmployeeLogOptions
+    {
+        uint64_t segment_bytes = 64u << 20;                           /**< The active segment is sealed once it would grow past this. */
+        size_t buffer_size = BufferedWriter::DEFAULT_BUFFER_SIZE;     /**< Write buffer of the active segment. */
+        double compact_threshold = 0.5;                               /**< Sealed segments whose live fraction is at or below this are compacted. */
+        bool background_compaction = true;                            /**< Run compact() periodically on a worker thread. */
+        DWORD compact_interval_ms = 1000;                             /**< Pause between background compaction passes. */
+    };
+
+    /** @brief Counters of an EmployeeLog. */
+    struct EmployeeLogStats
+    {
+        uint64_t segments = 0;          /**< Segment files, including the active one. */
+        uint64_t live = 0;              /**< Ids with a current record. */
+        uint64_t appended = 0;          /**< Records appended since opening. */
+        uint64_t compactions = 0;       /**< Compaction passes that rewrote or dropped segments. */
+        uint64_t reclaimed_bytes = 0;   /**< Bytes of deleted segments minus bytes rewritten. */
+    };
+
+    /**
+     * @class EmployeeLog
+     * @brief Log-structured store that keeps the latest record of every id.
+     *
+     * Every update is appended to the active segment through a BufferedWriter,
+     * so writes stay sequential however often the same id is rewritten. When
+     * the active segment reaches segment_bytes it is sealed and a new one is
+     * started. An in-memory table maps each id to the segment and offset of
+     * its latest entry; reads are one positional read.
+     *
+     * Entries carry a sequence number and a CRC-32C. Opening a directory
+     * replays every segment, keeps the entry with the highest sequence
+     * number per id, and ignores a torn tail. New appends always go to a new
+     * segment.
+     *
+     * Compaction copies the live entries of sparse sealed segments into a
+     * fresh segment and deletes the old files. Entries are read and copied
+     * without blocking writers. The index is only locked to check liveness
+     * and to install the result. Sequence numbers survive the copy, so the
+     * order of segment files does not matter for replay.
+     *
+     * All members are thread-safe. Segments written on an opposite-endian
+     * host are rejected.
+     */
+    class EmployeeLog
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x4C504D45;        /**< "EMPL" in little-endian order. */
+        static constexpr uint16_t VERSION = 1;               /**< Segment format version. */
+        static constexpr uint16_t ENDIAN_MARKER = 0x0102;    /**< Reads as 0x0201 on an opposite-endian host. */
+        static constexpr uint32_t HEADER_SIZE = 16;          /**< Segment header size in bytes. */
+        static constexpr uint32_t ENTRY_SIZE = sizeof(uint64_t) + Employee::SERIALIZED_SIZE + sizeof(uint32_t); /**< Sequence, record, CRC. */
+        /** @} */
+
+    private:
+        /** @brief One segment file. */
+        struct Segment
+        {
+            uint64_t seq = 0;        /**< Number in the file name. */
+            File file;               /**< Open read/write handle. */
+            uint64_t bytes = 0;      /**< End of valid entries. */
+            uint64_t entries = 0;    /**< Valid entries. */
+            uint64_t live = 0;       /**< Entries the index still points at. */
+        };
+
+        /** @brief Position of the latest entry of an id. */
+        struct Location
+        {
+            uint64_t lsn = 0;        /**< Sequence number; 0 if the id has no record. */
+            uint64_t segment = 0;    /**< Segment number. */
+            uint64_t offset = 0;     /**< Entry offset inside the segment. */
+            double hours = 0.0;      /**< Hours of that entry, so aggregates need no read. */
+        };
+
+        std::string directory_;                                    /**< Segment directory. */
+        EmployeeLogOptions opts_;                                  /**< Options. */
+        std::map<uint64_t, std::unique_ptr<Segment>> segments_;    /**< Segments by number; guarded by lock_. */
+        std::vector<Location> index_;                              /**< Location per id; guarded by lock_. */
+        Segment* active_;                                          /**< Segment receiving appends. */
+        std::optional<BufferedWriter> writer_;                     /**< Appends to active_. */
+        uint64_t flushed_;                                         /**< Bytes of active_ already in the file. */
+        uint64_t next_lsn_;                                        /**< Sequence number of the next entry. */
+        uint64_t next_segment_;                                    /**< Number of the next segment file. */
+        EmployeeLogStats stats_;                                   /**< Counters; guarded by lock_. */
+        HoursAggregate* aggregate_;                                /**< Follows every put (not owned); guarded by lock_. */
+        bool open_;                                                /**< Directory replayed and a segment is active. */
+        bool stop_;                                                /**< Asks the compactor to exit; guarded by lock_. */
+        mutable SRWLOCK lock_;                                     /**< Guards everything above. */
+        SRWLOCK compact_lock_;                                     /**< Serializes compaction passes. */
+        CONDITION_VARIABLE wake_;                                  /**< Wakes the compactor early on shutdown. */
+        Thread compactor_;                                         /**< Background compaction thread. */
+
+        std::string path_(uint64_t seq) const;
+        std::unique_ptr<Segment> create_segment_(uint64_t seq);
+        bool replay_(Segment& s);
+        bool rotate_();
+        bool append_(const Employee& e);
+        bool flush_();
+        std::optional<Employee> read_(const Location& loc) const;
+        bool compact_();
+        static DWORD WINAPI compactor_main_(LPVOID self);
+
+    public:
+        /**
+         * @brief Opens or creates the log in @p directory; check is_open() afterwards.
+         *
+         * The directory is created if it does not exist.
+         */
+        explicit EmployeeLog(LPCSTR directory, const EmployeeLogOptions& opts = EmployeeLogOptions());
+
+        EmployeeLog(const EmployeeLog&) = delete;
+        EmployeeLog& operator=(const EmployeeLog&) = delete;
+
+        /** @brief Stops the compactor and flushes the active segment. */
+        ~EmployeeLog() noexcept;
+
+        /** @return true if the directory was replayed and appends are possible. */
+        bool is_open() const noexcept;
+
+        /** @brief Appends @p e as the latest record of its id. */
+        bool put(const Employee& e);
+
+        /** @brief Appends @p n records in order. */
+        bool put(const Employee* src, size_t n);
+
+        /** @brief Appends the latest record of @p id with new hours. @return false if the id is unknown. */
+        bool set_hours(Employee::ID_TYPE id, double hours);
+
+        /** @return The latest record of @p id, or std::nullopt if it has none. */
+        std::optional<Employee> get(Employee::ID_TYPE id);
+
+        /** @return true if @p id has a record. */
+        bool contains(Employee::ID_TYPE id) const noexcept;
+
+        /** @brief Writes buffered appends to the active segment. */
+        bool flush();
+
+        /**
+         * @brief Runs one compaction pass.
+         *
+         * Sealed segments at or below compact_threshold are taken in order
+         * while their live entries fit in one segment. Those entries are
+         * rewritten into a new segment and the old files are deleted.
+         */
+        bool compact();
+
+        /** @return Snapshot of the counters. */
+        EmployeeLogStats stats() const;
+
+        /**
+         * @brief Keeps @p aggregate in step with the latest hours of every id.
+         *
+         * The aggregate is rebuilt from the in-memory index, so no segment is
+         * read. Pass nullptr to detach. While writers run, read it through
+         * hours_stats() only.
+         */
+        void attach(HoursAggregate* aggregate);
+
+        /** @return Snapshot of the attached aggregate; an empty GroupStats if none is attached. */
+        GroupStats hours_stats() const;
+    };
+} // namespace core::General
+
+#endif // EMPLOYEE_LOG_H
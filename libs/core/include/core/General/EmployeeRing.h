@@ -0,0 +1,193 @@
+/**
+ * @file EmployeeRing.h
+ * @brief Lock-free ring of Employee records in named shared memory.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EMPLOYEE_RING_H
+#define EMPLOYEE_RING_H
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <Windows.h>
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include "Employee.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief What a ring endpoint does when it has to wait. */
+    enum class RingWait
+    {
+        spin,    /**< Spin, then yield the processor; lowest latency, burns a core. */
+        block    /**< Spin briefly, then sleep on a named event. */
+    };
+
+    /**
+     * @class EmployeeRing
+     * @brief Single-producer, multi-consumer queue of compact Employee records between processes.
+     *
+     * The ring lives in a named shared-memory section created by the
+     * producer; consumers in other processes (or threads) open it by name.
+     * Each slot carries a sequence number next to its record (a bounded
+     * Vyukov queue), so a consumer claims a record with one compare-exchange
+     * on the shared head. The producer writes without any atomic
+     * read-modify-write. The head, the tail and the wait counters each sit
+     * on their own cache line, so producer and consumers do not false-share.
+     *
+     * Waiting costs a system call only when a side actually has to sleep:
+     * the other side checks a waiter count in shared memory and sets the
+     * event only when someone is waiting. Each record goes to exactly one
+     * consumer; order is kept per consumer.
+     *
+     * Move-only. The producer's destructor closes the ring, so consumers see
+     * the end of the stream even if it forgets to.
+     */
+    class EmployeeRing
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x52504D45;            /**< "EMPR" in little-endian order. */
+        static constexpr uint32_t VERSION = 1;                   /**< Shared layout version. */
+        static constexpr size_t RECORD_SIZE = Employee::SERIALIZED_SIZE; /**< Bytes per record. */
+        static constexpr size_t SLOT_SIZE = 32;                  /**< Sequence number plus record, padded. */
+        static constexpr uint32_t MAX_CAPACITY = 1u << 24;       /**< Largest slot count (512 MiB). */
+        static constexpr uint32_t SPIN_COUNT = 4096;             /**< Polls before yielding or sleeping. */
+        static constexpr DWORD WAIT_SLICE_MS = 50;               /**< Longest sleep between re-checks. */
+        /** @} */
+
+    private:
+        struct Control;
+        struct Slot;
+
+        HANDLE hMapping_;       /**< Shared section. */
+        HANDLE hData_;          /**< Set when records are published and a consumer waits. */
+        HANDLE hSpace_;         /**< Set when slots are freed and the producer waits. */
+        Control* control_;      /**< Counters at the start of the view. */
+        Slot* slots_;           /**< Slot array after the counters. */
+        uint64_t mask_;         /**< capacity - 1. */
+        uint64_t tail_;         /**< Next slot to write (producer only). */
+        RingWait wait_;         /**< Wait mode of this endpoint. */
+        bool producer_;         /**< This endpoint created the ring. */
+
+        EmployeeRing() noexcept;
+
+        /** @brief Closes the ring if this is the producer, then releases the view and handles. */
+        void detach_() noexcept;
+
+        /** @brief Writes one record if its slot is free, without signalling. */
+        bool put_(const char* record) noexcept;
+
+        /** @brief Claims and copies up to @p max ready records without waiting. */
+        size_t take_(char* out, size_t max) noexcept;
+
+        /** @brief Wakes a sleeping consumer if there is one. */
+        void signal_data_() noexcept;
+
+        /** @return true if a record is ready, or the ring is closed. */
+        bool readable_() const noexcept;
+
+        /** @return true if the producer's next slot is free, or the ring is closed. */
+        bool writable_() const noexcept;
+
+        /** @brief Waits until @p ready() holds, per the wait mode. */
+        template <class Ready>
+        void wait_until_(Ready&& ready, bool consumer) const noexcept;
+
+        static std::optional<EmployeeRing> attach_(HANDLE mapping, const std::string& name,
+                                                   bool producer, RingWait wait) noexcept;
+
+    public:
+        /** @name Lifecycle Management
+         *  @{ */
+        EmployeeRing(const EmployeeRing&) = delete;
+        EmployeeRing& operator=(const EmployeeRing&) = delete;
+
+        /** @brief Move constructor. @p other is left detached. */
+        EmployeeRing(EmployeeRing&& other) noexcept;
+
+        /** @brief Move assignment. Detaches from the current ring first. */
+        EmployeeRing& operator=(EmployeeRing&& other) noexcept;
+
+        /** @brief Closes the ring if this is the producer, then unmaps it. */
+        ~EmployeeRing() noexcept;
+
+        /**
+         * @brief Creates a ring as its producer.
+         * @param name Name of the shared section, e.g. "Local\\employees".
+         * @param capacity Slot count, rounded up to a power of two within [2, MAX_CAPACITY].
+         * @return std::nullopt if the name is already in use or the section cannot be created.
+         */
+        static std::optional<EmployeeRing> create(const char* name, uint32_t capacity,
+                                                  RingWait wait = RingWait::block) noexcept;
+
+        /** @brief Opens an existing ring as a consumer. @return std::nullopt if it does not exist or is not a ring. */
+        static std::optional<EmployeeRing> open(const char* name, RingWait wait = RingWait::block) noexcept;
+        /** @} */
+
+        /** @name Producer
+         *  @{ */
+
+        /** @brief Appends one compact record without waiting. @return false if the ring is full or closed. */
+        bool try_push(const char* record) noexcept;
+
+        /** @brief Appends one compact record, waiting while the ring is full. @return false if closed. */
+        bool push(const char* record) noexcept;
+
+        /** @brief Appends one Employee, waiting while the ring is full. */
+        bool push(const Employee& e) noexcept;
+
+        /**
+         * @brief Appends @p n compact records, waiting for space as needed.
+         *
+         * Consumers are woken once per run of records rather than per record.
+         */
+        bool push_records(const char* records, size_t n) noexcept;
+
+        /** @brief Marks the end of the stream; consumers drain what is left and then stop. */
+        void close() noexcept;
+        /** @} */
+
+        /** @name Consumer
+         *  @{ */
+
+        /** @brief Takes one record without waiting. @return false if none is ready. */
+        bool try_pop(char* record) noexcept;
+
+        /** @brief Takes one record, waiting for one. @return false once the ring is closed and drained. */
+        bool pop(char* record) noexcept;
+
+        /** @brief Takes one Employee, waiting for one. @return false once the ring is closed and drained. */
+        bool pop(Employee& e) noexcept;
+
+        /**
+         * @brief Takes up to @p max records, waiting for at least one.
+         * @return Records taken; 0 once the ring is closed and drained.
+         */
+        size_t pop_records(char* out, size_t max) noexcept;
+        /** @} */
+
+        /** @name State
+         *  @{ */
+        bool is_producer() const noexcept;   /**< @return true for the endpoint that created the ring. */
+        bool closed() const noexcept;        /**< @return true once close() was called. */
+        uint32_t capacity() const noexcept;  /**< @return Slot count. */
+        uint64_t size() const noexcept;      /**< @return Records waiting; a snapshot under concurrency. */
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // EMPLOYEE_RING_H
@@ -0,0 +1,174 @@
+/**
+ * @file EmployeeStore.h
+ * @brief In-place record updates for fixed-size Employee files.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EMPLOYEE_STORE_H
+#define EMPLOYEE_STORE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeFile.h"
+#include "File.h"
+#include "HoursAggregate.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief One entry of a batched hours update. */
+    struct HoursUpdate
+    {
+        uint64_t record;   /**< Record index. */
+        double value;      /**< New hours, or the amount to add. */
+    };
+
+    /** @brief How EmployeeStore::update_hours() applies HoursUpdate::value. */
+    enum class HoursUpdateMode
+    {
+        set,   /**< Replace the stored hours. */
+        add    /**< Add to the stored hours. */
+    };
+
+    /**
+     * @class EmployeeStore
+     * @brief Reads and modifies records of an Employee file in place.
+     *
+     * Records have a fixed size, so the offset of record i is computed
+     * directly from the header and a field update is a single positional
+     * write of that field's bytes. An optional id index finds the record of
+     * an id without a scan. When ids repeat, the index keeps the last record
+     * with that id; when that record takes another id, the index falls back
+     * to the previous record that still holds it, found by a backward scan.
+     *
+     * Batched updates are sorted by offset. Updates that fall close together
+     * are applied by reading the covering span once, patching it in memory
+     * and writing it back, so bulk adjustments turn into sequential I/O.
+     *
+     * In versioned files, every modified block is remembered and its
+     * checksum is recomputed by flush() or by the destructor. Until then,
+     * verify() reports those blocks as damaged. Both record layouts are
+     * supported. Files written on an opposite-endian host are rejected.
+     * An attached HoursAggregate follows every hours change, and flush()
+     * moves its stamp to the new HoursAggregate::data_stamp() of the file,
+     * so a checkpoint saved after flush() matches only the flushed content.
+     * The File must be opened for writing and outlive the store. The store
+     * is not thread-safe. Several stores may update one file through their
+     * own handles under the RangeLock::records() protocol.
+     */
+    class EmployeeStore
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr uint64_t MAX_GAP_RECORDS = 64;       /**< Largest gap merged into one batched span. */
+        static constexpr uint64_t MAX_SPAN_RECORDS = 65536;   /**< Largest batched span. */
+        /** @} */
+
+    private:
+        const File* file_;                        /**< Target (not owned); nullptr once moved from. */
+        EmployeeFileReader reader_;               /**< Header and reads. */
+        uint32_t id_offset_;                      /**< Byte offset of the id inside a record. */
+        uint32_t hours_offset_;                   /**< Byte offset of the hours inside a record. */
+        uint32_t name_offset_;                    /**< Byte offset of the name inside a record. */
+        std::vector<uint64_t> index_;             /**< Record + 1 per id; 0 for unknown ids. Empty if not built. */
+        std::vector<uint32_t> counts_;            /**< Records per id; built with index_. */
+        std::vector<bool> dirty_;                 /**< Blocks whose checksum is stale. */
+        bool any_dirty_;                          /**< At least one bit of dirty_ is set. */
+        HoursAggregate* aggregate_;               /**< Kept in step with hours changes (not owned); may be nullptr. */
+
+        EmployeeStore(const File& file, const EmployeeFileReader& reader) noexcept;
+
+        bool write_field_(uint64_t record, uint32_t offset, const void* value, size_t size) noexcept;
+        void touch_(uint64_t first, uint64_t last) noexcept;
+        std::optional<double> read_hours_(uint64_t record) const noexcept;
+        bool reindex_(uint64_t record, Employee::ID_TYPE old_id, Employee::ID_TYPE new_id) noexcept;
+
+    public:
+        /**
+         * @brief Prepares a store over @p file.
+         * @return std::nullopt if the file is not a readable host-order Employee file.
+         */
+        static std::optional<EmployeeStore> open(const File& file) noexcept;
+
+        EmployeeStore(const EmployeeStore&) = delete;
+        EmployeeStore& operator=(const EmployeeStore&) = delete;
+        /** @brief Transfers the store; @p other no longer flushes. */
+        EmployeeStore(EmployeeStore&& other) noexcept;
+        /** @brief Flushes, then takes over @p other. */
+        EmployeeStore& operator=(EmployeeStore&& other) noexcept;
+        /** @brief Flushes stale checksums. */
+        ~EmployeeStore() noexcept;
+
+        /** @return Number of records. */
+        uint64_t size() const noexcept;
+
+        /** @return The underlying reader. */
+        const EmployeeFileReader& reader() const noexcept;
+
+        /**
+         * @brief Keeps @p aggregate in step with every later hours change.
+         *
+         * The aggregate must already describe the file, for example from
+         * HoursAggregate::from_file() or a current checkpoint. Pass nullptr
+         * to detach. The aggregate must outlive the store or be detached.
+         */
+        void attach(HoursAggregate* aggregate) noexcept;
+
+        /** @name Id Index
+         *  @{ */
+
+        /** @brief Builds the id index with one sequential pass over the file. */
+        bool build_index();
+
+        /** @return true if build_index() has been called. */
+        bool indexed() const noexcept;
+
+        /** @return The record holding @p id, or std::nullopt if unknown or not indexed. */
+        std::optional<uint64_t> find(Employee::ID_TYPE id) const noexcept;
+        /** @} */
+
+        /** @name Single-Record Access
+         *  @{ */
+
+        /** @return Record @p record, or std::nullopt if out of range or unreadable. */
+        std::optional<Employee> get(uint64_t record) const noexcept;
+
+        /** @brief Overwrites the hours of @p record. */
+        bool set_hours(uint64_t record, double hours) noexcept;
+
+        /** @brief Overwrites the id of @p record and updates the index. */
+        bool set_id(uint64_t record, Employee::ID_TYPE id) noexcept;
+
+        /** @brief Overwrites the name of @p record (at most BUFF_SIZE bytes, zero-padded). */
+        bool set_name(uint64_t record, const char* name) noexcept;
+
+        /** @brief Overwrites the whole of @p record and updates the index. */
+        bool put(uint64_t record, const Employee& e) noexcept;
+
+        /** @brief Overwrites the hours of the record with @p id; needs the index. */
+        bool set_hours_by_id(Employee::ID_TYPE id, double hours) noexcept;
+        /** @} */
+
+        /**
+         * @brief Applies many hours updates in ascending offset order.
+         *
+         * Updates to the same record are applied in their original order.
+         * @return false if any record is out of range (nothing is written)
+         *         or an I/O error occurs.
+         */
+        bool update_hours(std::vector<HoursUpdate> updates, HoursUpdateMode mode = HoursUpdateMode::set);
+
+        /** @brief Recomputes and stores the checksums of modified blocks, then restamps an attached aggregate. */
+        bool flush();
+    };
+} // namespace core::General
+
+#endif // EMPLOYEE_STORE_H
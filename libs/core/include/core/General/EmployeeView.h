@@ -0,0 +1,133 @@
+/**
+ * @file EmployeeView.h
+ * @brief Non-owning, zero-copy views over serialized Employee records in either layout.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EMPLOYEE_VIEW_H
+#define EMPLOYEE_VIEW_H
+
+#include <cstddef>
+#include <cstring>
+#include "AlignedEmployee.h"
+#include "Employee.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class EmployeeView
+     * @brief Reads single fields straight out of a serialized record.
+     *
+     * Each accessor is a fixed-offset load: from Employee::Schema for
+     * compact records, or from the AlignedEmployee fields for aligned ones,
+     * where every load is naturally aligned. Filters that need only one
+     * field never build an Employee object. The viewed bytes must outlive
+     * the view.
+     */
+    class EmployeeView
+    {
+    private:
+        const char* record_;      /**< First byte of the record. */
+        EmployeeLayout layout_;   /**< Layout of the viewed bytes. */
+
+    public:
+        /** @brief Constructs a view over @p record, stride(@p layout) bytes long. */
+        explicit EmployeeView(const char* record = nullptr, EmployeeLayout layout = EmployeeLayout::compact) noexcept
+            : record_(record), layout_(layout)
+        {
+        }
+
+        /** @return Bytes per record in @p layout. */
+        static constexpr size_t stride(EmployeeLayout layout) noexcept
+        { return EmployeeLayout::aligned == layout ? AlignedEmployee::SIZE : Employee::SERIALIZED_SIZE; }
+
+        /** @return The record's ID. */
+        Employee::ID_TYPE id() const noexcept
+        {
+            if(EmployeeLayout::compact == layout_)
+                return Employee::Schema::read<Employee::FIELD_ID>(record_);
+            Employee::ID_TYPE id;
+            memcpy(&id, record_ + offsetof(AlignedEmployee, id), sizeof(id));
+            return id;
+        }
+
+        /** @return The record's hours. */
+        double hours() const noexcept
+        {
+            if(EmployeeLayout::compact == layout_)
+                return Employee::Schema::read<Employee::FIELD_HOURS>(record_);
+            double hours;
+            memcpy(&hours, record_ + offsetof(AlignedEmployee, hours), sizeof(hours));
+            return hours;
+        }
+
+        /**
+         * @return Pointer to the record's BUFF_SIZE-byte name buffer.
+         * @warning A name that fills the whole buffer is not null-terminated.
+         */
+        const char* name() const noexcept
+        {
+            return record_ + (EmployeeLayout::compact == layout_ ? Employee::Schema::offset<Employee::FIELD_NAME>()
+                                                                 : offsetof(AlignedEmployee, name));
+        }
+
+        /** @return Pointer to the first byte of the record. */
+        const char* data() const noexcept
+        { return record_; }
+
+        /** @return Layout of the viewed record. */
+        EmployeeLayout layout() const noexcept
+        { return layout_; }
+
+        /** @return A full Employee decoded from the record. */
+        Employee materialize() const
+        {
+            if(EmployeeLayout::compact == layout_)
+                return Employee::deserialize(record_);
+            AlignedEmployee a;
+            memcpy(&a, record_, sizeof(a));
+            return a.employee();
+        }
+    };
+
+    /**
+     * @class EmployeeRecords
+     * @brief A run of consecutive records in one layout, viewed in place.
+     */
+    class EmployeeRecords
+    {
+    private:
+        const char* data_;        /**< First byte of record 0; nullptr for no records. */
+        EmployeeLayout layout_;   /**< Layout of every record. */
+
+    public:
+        /** @brief Views the records starting at @p data. */
+        explicit EmployeeRecords(const char* data = nullptr, EmployeeLayout layout = EmployeeLayout::compact) noexcept
+            : data_(data), layout_(layout)
+        {
+        }
+
+        /** @return A view of record @p i; not range checked. */
+        EmployeeView operator[](size_t i) const noexcept
+        { return EmployeeView(data_ + i * EmployeeView::stride(layout_), layout_); }
+
+        /** @return First byte of record 0. */
+        const char* data() const noexcept
+        { return data_; }
+
+        /** @return Layout of the records. */
+        EmployeeLayout layout() const noexcept
+        { return layout_; }
+
+        /** @return Bytes between records. */
+        size_t stride() const noexcept
+        { return EmployeeView::stride(layout_); }
+    };
+} // namespace core::General
+
+#endif // EMPLOYEE_VIEW_H
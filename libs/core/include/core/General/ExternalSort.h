@@ -0,0 +1,76 @@
+/**
+ * @file ExternalSort.h
+ * @brief External merge sort for serialized Employee files larger than RAM.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include "File.h"
+#include "RecordOrder.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @struct ExternalSortOptions
+     * @brief Tuning knobs for ExternalSort::sort().
+     */
+    struct ExternalSortOptions
+    {
+        SortKey key = SortKey::id;                  /**< Field to sort by. */
+        size_t memory_budget = 256u << 20;          /**< Bytes for run formation and merge buffers. */
+        size_t threads = 0;                         /**< Run-sorting workers, 0 = one per processor. */
+        size_t io_buffer_size = 4u << 20;           /**< Preferred size of each merge read/write buffer. */
+        LPCSTR temp_directory = nullptr;            /**< Spill directory, nullptr = system temp path. */
+    };
+
+    /**
+     * @class ExternalSort
+     * @brief Sorts a versioned or legacy Employee file by one field.
+     *
+     * Input is read through EmployeeFileReader, so any layout it accepts is
+     * sorted. The output keeps the input's format: a versioned input yields
+     * a versioned file with the same layout and block size and fresh
+     * checksums, a legacy input yields bare compact records.
+     *
+     * Phase one reads the input in memory-sized batches. Each batch is split
+     * between Thread workers that sort (key prefix, index) pairs, the sorted
+     * slices are merged with a loser tree and written as one run to a
+     * delete-on-close spill file. Phase two merges the runs with a loser tree
+     * over large sequential read buffers; if there are more runs than the
+     * budget can buffer, runs are merged in several passes.
+     *
+     * The sort is stable: records with equal keys keep their input order.
+     */
+    class ExternalSort
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t MIN_MEMORY_BUDGET = 1u << 20;  /**< Smallest accepted budget. */
+        static constexpr size_t MIN_MERGE_BUFFER = 64u << 10;  /**< Smallest per-run read buffer. */
+        /** @} */
+
+        /**
+         * @brief Sorts @p input into @p output.
+         * @param input Versioned Employee file, or a legacy file of whole compact records.
+         * @param output Writable destination; records are written from offset 0.
+         * @param options Sort key and resource limits.
+         * @return true if every record was written in order; false if @p input
+         *         is not a readable Employee file.
+         */
+        static bool sort(const File& input,
+                         const File& output,
+                         const ExternalSortOptions& options = ExternalSortOptions());
+    };
+} // namespace core::General
+
+#endif // EXTERNAL_SORT_H
@@ -18,6 +18,7 @@
 #include <Windows.h>
 #include <string>
 #include <optional>
+#include <cstdint>
 
 /**
  * @namespace core::General
@@ -73,6 +74,9 @@ namespace core::General
         /** @return true if the file handle is valid and opened. */
         bool is_opened() const noexcept;
 
+        /** @return The underlying Win32 handle, still owned by this object. */
+        HANDLE handle() const noexcept;
+
         /**
          * @brief Writes data to the file.
          * @param buf Source buffer.
@@ -116,6 +120,13 @@ namespace core::General
                           DWORD dwCreationDisposition,
                           DWORD dwFlagsAndAttributes,
                           HANDLE hTemplateFile);
+
+        /**
+         * @brief Creates a read/write scratch file that is deleted when closed.
+         * @param lpDirectory Target directory, or nullptr for the system temp path.
+         * @return A File object owning the handle, invalid on failure.
+         */
+        static File openTemporary(LPCSTR lpDirectory = nullptr);
         /** @} */
 
         /** @name Positioning and Size
@@ -136,6 +147,59 @@ namespace core::General
 
         /** @return The total size of the file in bytes. */
         std::optional<DWORD> getFileSize() const noexcept;
+
+        /** @return The total size of the file in bytes, valid beyond 4 GiB. */
+        std::optional<uint64_t> getFileSize64() const noexcept;
+        /** @} */
+
+        /** @name Positional I/O
+         *  Offsets are absolute, so independent readers do not have to 
+         *  coordinate through setFilePointer(). 
+         *  @{ */
+
+        /**
+         * @brief Reads exactly @p size bytes starting at @p offset.
+         * @param buf Destination buffer.
+         * @param size Number of bytes to read.
+         * @param offset Absolute byte offset from the start of the file.
+         * @return true only if the whole range was read.
+         * @note On a synchronous handle the file pointer is left after the range.
+         */
+        bool readAt(char* buf, DWORD size, uint64_t offset) const noexcept;
+
+        /**
+         * @brief Writes exactly @p size bytes starting at @p offset.
+         * @param buf Source buffer.
+         * @param size Number of bytes to write.
+         * @param offset Absolute byte offset from the start of the file.
+         * @return true only if the whole buffer was written.
+         */
+        bool writeAt(const char* buf, DWORD size, uint64_t offset) const noexcept;
+        /** @} */
+
+        /** @name Byte-Range Locking
+         *  Locks belong to this handle, so two handles on the same file
+         *  contend even within one process. Ranges may extend past the end
+         *  of the file. Exclusive ranges also block reads and writes through
+         *  other handles; shared ranges block writes.
+         *  @{ */
+
+        /**
+         * @brief Locks @p length bytes starting at @p offset.
+         * @param exclusive true for a writer lock, false for a shared reader lock.
+         * @param timeout_ms 0 to fail at once if the range is taken, INFINITE to
+         *        block, anything else to retry until that many milliseconds pass.
+         * @return true if the range is now locked; false on timeout, on any
+         *         other error or if @p length is 0.
+         * @note LockFileEx cannot time out on a synchronous handle, so finite
+         *       timeouts poll with a growing sleep of at most LOCK_POLL_MAX_MS.
+         */
+        bool lockRange(uint64_t offset, uint64_t length, bool exclusive, DWORD timeout_ms = INFINITE) const noexcept;
+
+        /** @brief Releases a range locked by lockRange() with the same offset and length. */
+        bool unlockRange(uint64_t offset, uint64_t length) const noexcept;
+
+        static constexpr DWORD LOCK_POLL_MAX_MS = 16;   /**< Longest sleep between lock attempts. */
         /** @} */
 
     private:
@@ -0,0 +1,78 @@
+/**
+ * @file FileMapping.h
+ * @brief RAII wrapper for a read-only memory-mapped view of a whole file.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef FILE_MAPPING_H
+#define FILE_MAPPING_H
+
+#include <cstdint>
+#include <cstddef>
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class FileMapping
+     * @brief A move-only owner of a file mapping object and its read-only view.
+     *
+     * The view covers the whole file as it was when open() was called and
+     * stays valid after the File is closed. Pages are faulted in on first
+     * touch, so scans over a mapping read straight from the page cache
+     * without copying into user buffers.
+     */
+    class FileMapping
+    {
+    private:
+        HANDLE hMapping_;     /**< Win32 file mapping object. */
+        const char* data_;    /**< First byte of the view. */
+        uint64_t size_;       /**< View size in bytes. */
+
+        FileMapping(HANDLE mapping, const char* data, uint64_t size) noexcept;
+
+    public:
+        /** @name Lifecycle Management
+         *  @{ */
+
+        /** @brief Constructs an unmapped object. */
+        FileMapping() noexcept;
+
+        FileMapping(const FileMapping&) = delete;
+        FileMapping& operator=(const FileMapping&) = delete;
+
+        /** @brief Move constructor. Transfers the view from @p other. */
+        FileMapping(FileMapping&& other) noexcept;
+
+        /** @brief Move assignment. Unmaps the current view and takes ownership from @p other. */
+        FileMapping& operator=(FileMapping&& other) noexcept;
+
+        /** @brief Destructor. Unmaps the view. */
+        ~FileMapping() noexcept;
+
+        /**
+         * @brief Maps all of @p file read-only.
+         * @return A mapped object, or an unmapped one if the file is empty,
+         *         larger than the address space, or cannot be mapped.
+         */
+        static FileMapping open(const File& file) noexcept;
+
+        /** @brief Unmaps the view and closes the mapping object. */
+        void close() noexcept;
+        /** @} */
+
+        /** @name Access
+         *  @{ */
+        bool is_mapped() const noexcept;      /**< @return true if a view is mapped. */
+        const char* data() const noexcept;    /**< @return First byte of the view, or nullptr. */
+        uint64_t size() const noexcept;       /**< @return View size in bytes. */
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // FILE_MAPPING_H
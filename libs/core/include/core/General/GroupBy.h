@@ -0,0 +1,173 @@
+/**
+ * @file GroupBy.h
+ * @brief Hash group-by aggregation of hours over Employee fields.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef GROUP_BY_H
+#define GROUP_BY_H
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include "File.h"
+#include "NameDictionary.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Running count, sum, min and max of hours for one group. */
+    struct GroupStats
+    {
+        uint64_t count = 0;                                            /**< Rows in the group. */
+        double hours_sum = 0.0;                                        /**< Sum of hours. */
+        double hours_min = std::numeric_limits<double>::infinity();    /**< Smallest hours value. */
+        double hours_max = -std::numeric_limits<double>::infinity();   /**< Largest hours value. */
+
+        /** @brief Adds one row. */
+        void add(double hours) noexcept
+        {
+            count++;
+            hours_sum += hours;
+            if(hours < hours_min) hours_min = hours;
+            if(hours > hours_max) hours_max = hours;
+        }
+
+        /** @brief Folds another partial aggregate of the same group into this one. */
+        void merge(const GroupStats& other) noexcept
+        {
+            count += other.count;
+            hours_sum += other.hours_sum;
+            if(other.hours_min < hours_min) hours_min = other.hours_min;
+            if(other.hours_max > hours_max) hours_max = other.hours_max;
+        }
+    };
+
+    /** @brief One output row: a group key and its aggregate. */
+    struct GroupRow
+    {
+        uint64_t key;        /**< Id, lower bound of the id bucket, or name code. */
+        GroupStats stats;    /**< Aggregate over the group. */
+    };
+
+    /**
+     * @class GroupTable
+     * @brief Open-addressing hash table from 64-bit keys to GroupStats.
+     *
+     * Each slot holds the key next to its aggregate, so a hit costs one
+     * cache line. Probing is linear from a Fibonacci hash of the key and
+     * the load factor stays at or below one half.
+     */
+    class GroupTable
+    {
+    private:
+        /** @brief Key plus one (0 marks an empty slot) and the aggregate. */
+        struct Slot
+        {
+            uint64_t key;
+            GroupStats stats;
+        };
+
+        std::vector<Slot> slots_;   /**< Power-of-two slot array. */
+        size_t size_;               /**< Occupied slots. */
+        unsigned shift_;            /**< 64 - log2(slots_.size()). */
+
+        size_t probe_(uint64_t stored) const noexcept;
+        void grow_();
+
+    public:
+        /** @brief Constructs an empty table. */
+        GroupTable();
+
+        /** @return The aggregate of @p key, inserting an empty one if it is new. */
+        GroupStats& at(uint64_t key);
+
+        /** @return The aggregate of @p key, or nullptr if it is absent. */
+        const GroupStats* find(uint64_t key) const noexcept;
+
+        /** @brief Folds every group of @p other into this table. */
+        void merge(const GroupTable& other);
+
+        /** @return Number of groups. */
+        size_t size() const noexcept;
+
+        /** @brief Removes every group. */
+        void clear() noexcept;
+
+        /** @return All groups in ascending key order. */
+        std::vector<GroupRow> rows() const;
+    };
+
+    /** @brief Employee field that defines the groups. */
+    enum class GroupKey
+    {
+        name,        /**< One group per distinct name. */
+        id,          /**< One group per id. */
+        id_bucket    /**< One group per run of bucket_width consecutive ids. */
+    };
+
+    /** @brief Options for GroupBy::run(). */
+    struct GroupByOptions
+    {
+        GroupKey key = GroupKey::name;        /**< Grouping field. */
+        uint32_t bucket_width = 1024;         /**< Ids per bucket for GroupKey::id_bucket; 0 is treated as 1. */
+        size_t threads = 0;                   /**< Worker threads; 0 means one per logical processor. */
+    };
+
+    /** @brief Output of GroupBy::run(). */
+    struct GroupByResult
+    {
+        std::vector<GroupRow> rows;   /**< Groups in ascending key order. */
+        NameDictionary names;         /**< Names behind the codes for GroupKey::name; empty otherwise. */
+    };
+
+    /**
+     * @class GroupBy
+     * @brief Parallel GROUP BY over an in-memory table or an Employee file.
+     *
+     * Rows are split into one contiguous range per thread. Every thread
+     * aggregates into a private partial table, with no sharing or locking,
+     * and the partial tables are merged once all threads have finished.
+     * Id keys go through a GroupTable. Names are interned into a per-thread
+     * NameDictionary and their aggregates are kept in a dense array indexed
+     * by code. When merging, each local code is re-interned into the result
+     * dictionary in thread order, so name codes follow the order of first
+     * appearance in the input.
+     *
+     * @code
+     * GroupByOptions opts;
+     * opts.key = GroupKey::name;
+     * GroupByResult r = GroupBy::run(table, opts);
+     * for(const GroupRow& g : r.rows)
+     *     printf("%s %f\n", r.names.name(static_cast<NameDictionary::Code>(g.key)), g.stats.hours_sum);
+     * @endcode
+     */
+    class GroupBy
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t FILE_BATCH_ROWS = 65536;    /**< Records per file read. */
+        static constexpr size_t MIN_ROWS_PER_THREAD = 65536; /**< Smaller inputs use fewer threads. */
+        /** @} */
+
+        /** @brief Groups every row of @p table. */
+        static GroupByResult run(const EmployeeColumns& table, const GroupByOptions& opts = GroupByOptions());
+
+        /**
+         * @brief Groups every record of an Employee file (versioned or legacy).
+         * @return The result, or std::nullopt if the file cannot be read.
+         */
+        static std::optional<GroupByResult> run(const File& file, const GroupByOptions& opts = GroupByOptions());
+    };
+} // namespace core::General
+
+#endif // GROUP_BY_H
@@ -0,0 +1,142 @@
+/**
+ * @file HoursAggregate.h
+ * @brief Incrementally maintained count, sum, min and max of hours.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef HOURS_AGGREGATE_H
+#define HOURS_AGGREGATE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include "EmployeeFile.h"
+#include "File.h"
+#include "GroupBy.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class HoursAggregate
+     * @brief Materialized hours aggregate that follows inserts, updates and deletes.
+     *
+     * count and sum change in O(1). The sum is compensated (Neumaier), so
+     * long runs of additions and removals do not drift. Min and max come
+     * from an ordered multiset of values (a balanced tree of value ->
+     * multiplicity), so every change costs O(log d) for d distinct values
+     * and reading them is O(1). NaN values are counted but kept out of the
+     * sum, min and max. Infinities take part in min and max but are counted
+     * apart from the compensated sum, so removing them restores a finite
+     * sum instead of leaving NaN behind.
+     *
+     * A checkpoint stores the aggregate together with a caller-defined
+     * stamp, such as a log sequence number or data_stamp() of an Employee
+     * file. On restart, the caller compares the stamp with the data and only
+     * rescans if they differ. Checkpoints are written in host byte order and
+     * carry a CRC-32C.
+     *
+     * Not thread-safe; stores that maintain an attached aggregate update it
+     * under their own locking rules.
+     */
+    class HoursAggregate
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x47414845;             /**< "EHAG" in little-endian order. */
+        static constexpr uint32_t VERSION = 1;                    /**< Checkpoint format version. */
+        static constexpr const char* FILE_SUFFIX = ".agg";        /**< Appended to the data file name by path_for(). */
+        /** @} */
+
+    private:
+        std::map<double, uint64_t> values_;   /**< Non-NaN value -> multiplicity. */
+        uint64_t count_;                      /**< All values, NaN included. */
+        uint64_t nan_count_;                  /**< NaN values. */
+        uint64_t pos_inf_count_;              /**< +inf values; also in values_. */
+        uint64_t neg_inf_count_;              /**< -inf values; also in values_. */
+        double sum_;                          /**< Running sum of finite values. */
+        double compensation_;                 /**< Low-order bits lost by sum_. */
+        uint64_t stamp_;                      /**< Caller-defined data position. */
+
+        void accumulate_(double value) noexcept;
+
+    public:
+        /** @brief Constructs an empty aggregate. */
+        HoursAggregate() noexcept;
+
+        /** @brief Adds one value. */
+        void insert(double hours);
+
+        /** @brief Removes one occurrence of @p hours. @return false if it was not present. */
+        bool erase(double hours);
+
+        /** @brief Replaces one occurrence of @p old_hours by @p new_hours. @return false if @p old_hours was not present. */
+        bool update(double old_hours, double new_hours);
+
+        /** @brief Removes every value; the stamp is kept. */
+        void clear() noexcept;
+
+        /** @name Results
+         *  @{ */
+        uint64_t count() const noexcept;               /**< @return Number of values, NaN included. */
+        double sum() const noexcept;                   /**< @return Sum of non-NaN values; NaN if both infinities are present. */
+        std::optional<double> min() const noexcept;    /**< @return Smallest non-NaN value. */
+        std::optional<double> max() const noexcept;    /**< @return Largest non-NaN value. */
+        std::optional<double> mean() const noexcept;   /**< @return sum() over the non-NaN count. */
+
+        /** @return The aggregate in GroupBy form; min and max are infinite when empty. */
+        GroupStats stats() const noexcept;
+        /** @} */
+
+        /** @name Checkpoints
+         *  @{ */
+
+        /** @return The stamp stored with the next checkpoint. */
+        uint64_t stamp() const noexcept;
+
+        /** @brief Sets the stamp stored with the next checkpoint. */
+        void set_stamp(uint64_t stamp) noexcept;
+
+        /**
+         * @brief Builds the aggregate with one sequential scan of an Employee file.
+         *
+         * The stamp is set to data_stamp() of the file.
+         * @return std::nullopt if @p data is not a readable Employee file.
+         */
+        static std::optional<HoursAggregate> from_file(const File& data);
+
+        /**
+         * @brief Identifies the current content of an Employee file without scanning it.
+         *
+         * Combines the record count with the CRC-32C of the block checksum
+         * table, so in-place updates change it once EmployeeStore::flush()
+         * has refreshed the checksums of the modified blocks. Legacy files
+         * have no checksums; their stamp is the record count alone and does
+         * not see in-place updates.
+         * @return The stamp, or std::nullopt if @p data is not a readable Employee file.
+         */
+        static std::optional<uint64_t> data_stamp(const File& data);
+
+        /** @brief data_stamp() of the file behind @p reader. */
+        static std::optional<uint64_t> data_stamp(const EmployeeFileReader& reader);
+
+        /** @brief Writes a checkpoint to @p out from offset 0. */
+        bool write(const File& out) const;
+
+        /** @return The aggregate stored in @p in, or std::nullopt if it is damaged. */
+        static std::optional<HoursAggregate> read(const File& in);
+
+        /** @return The conventional checkpoint path for the data file @p data_path. */
+        static std::string path_for(const std::string& data_path);
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // HOURS_AGGREGATE_H
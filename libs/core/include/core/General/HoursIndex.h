@@ -0,0 +1,167 @@
+/**
+ * @file HoursIndex.h
+ * @brief Persistent sorted secondary index over Employee::hours().
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef HOURS_INDEX_H
+#define HOURS_INDEX_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <optional>
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class HoursIndex
+     * @brief Read-only handle to a sorted (hours, record offset) index file.
+     *
+     * The index is a compact sorted array of fixed-size entries grouped into
+     * pages, followed by a fence table holding the first key of every page.
+     * Only the fence table is kept in memory, so a lookup costs one in-memory
+     * binary search plus a single page read, the same shape as a two-level
+     * B+-tree.
+     *
+     * File layout: [Header][Entry * count][Fence key * page count]
+     */
+    class HoursIndex
+    {
+    public:
+        /** @brief One index entry: the hours value and the byte offset of its record. */
+        struct Entry
+        {
+            double hours;      /**< Indexed value copied from the record. */
+            uint64_t offset;   /**< Byte offset of the record inside the data file. */
+        };
+
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x58494845;                  /**< "EHIX" in little-endian order. */
+        static constexpr uint32_t VERSION = 1;                         /**< On-disk format version. */
+        static constexpr uint32_t PAGE_ENTRIES = 256;                  /**< Entries per page (4 KiB pages). */
+        static constexpr size_t ENTRY_SIZE = sizeof(double) + sizeof(uint64_t); /**< Serialized entry size. */
+        static constexpr size_t DEFAULT_MEMORY_BUDGET = 64u << 20;     /**< Default build budget in bytes. */
+        static constexpr size_t MIN_MEMORY_BUDGET = 1u << 20;          /**< Smallest accepted build budget. */
+        /** @} */
+
+    private:
+        File file_;                      /**< Open index file. */
+        uint64_t count_;                 /**< Number of entries in the index. */
+        std::vector<uint64_t> fences_;   /**< Ordered key of the first entry of every page. */
+
+    public:
+        /** @name Lifecycle Management
+         *  @{ */
+
+        /** @brief Constructs an empty index that answers every query with no results. */
+        HoursIndex() noexcept;
+
+        /** @brief Copying is deleted because the object owns a file handle. */
+        HoursIndex(const HoursIndex&) = delete;
+        /** @brief Copying is deleted because the object owns a file handle. */
+        HoursIndex& operator=(const HoursIndex&) = delete;
+
+        /** @brief Move constructor. */
+        HoursIndex(HoursIndex&& other) noexcept = default;
+        /** @brief Move assignment. */
+        HoursIndex& operator=(HoursIndex&& other) noexcept = default;
+
+        /** @brief Default destructor. Closes the index file. */
+        ~HoursIndex() noexcept = default;
+        /** @} */
+
+        /** @name Building and Opening
+         *  @{ */
+
+        /**
+         * @brief Streams a serialized Employee file and writes a sorted index for it.
+         *
+         * Records are read sequentially and turned into entries until the memory
+         * budget is filled. Each full batch is sorted and spilled as a run to a
+         * temporary file, and the runs are merged into @p index at the end.
+         * A file that fits in a single run is written directly.
+         *
+         * @param data Readable Employee file, versioned (EmployeeFile.h) or legacy headerless.
+         * @param index Writable, empty destination file.
+         * @param memory_budget Upper bound for entry and I/O buffers, in bytes.
+         * @return true if the index was written completely.
+         */
+        static bool build(const File& data,
+                          const File& index,
+                          size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+        /**
+         * @brief Opens a previously built index and loads its fence table.
+         * @param index Readable index file. Ownership is taken.
+         * @return The index, or std::nullopt if the header is invalid.
+         */
+        static std::optional<HoursIndex> open(File&& index);
+        /** @} */
+
+        /** @name Queries
+         *  @{ */
+
+        /** @return Number of indexed records. */
+        uint64_t size() const noexcept;
+
+        /**
+         * @brief Reads a single entry by its rank in hours order.
+         * @param i Rank in [0, size()).
+         */
+        std::optional<Entry> at(uint64_t i) const noexcept;
+
+        /**
+         * @brief Finds the rank of the first entry with hours not less than @p hours.
+         * @return A rank in [0, size()], or std::nullopt if the index page cannot be read.
+         */
+        std::optional<uint64_t> lower_bound(double hours) const noexcept;
+
+        /**
+         * @brief Finds the rank of the first entry with hours greater than @p hours.
+         * @return A rank in [0, size()], or std::nullopt if the index page cannot be read.
+         */
+        std::optional<uint64_t> upper_bound(double hours) const noexcept;
+
+        /**
+         * @brief Collects the record offsets with hours in [lo, hi].
+         * @return Offsets ordered by ascending hours, or std::nullopt if a read failed.
+         */
+        std::optional<std::vector<uint64_t>> range(double lo, double hi) const;
+
+        /**
+         * @brief Collects the record offsets with the @p k highest hours.
+         * @return Offsets ordered by descending hours, or std::nullopt if a read failed.
+         */
+        std::optional<std::vector<uint64_t>> top(size_t k) const;
+
+        /**
+         * @brief Collects the record offsets with the @p k lowest hours.
+         * @return Offsets ordered by ascending hours, or std::nullopt if a read failed.
+         */
+        std::optional<std::vector<uint64_t>> bottom(size_t k) const;
+        /** @} */
+
+        /** @brief Order-preserving integer key for an hours value, see RecordOrder::hours_key(). */
+        static uint64_t ordered_key(double value) noexcept;
+
+    private:
+        HoursIndex(File&& file, uint64_t count, std::vector<uint64_t>&& fences) noexcept;
+
+        /** @brief Reads entries [first, first + n) into @p out. */
+        bool read_entries_(uint64_t first, size_t n, std::vector<Entry>& out) const;
+
+        /** @brief Shared implementation of lower_bound()/upper_bound(). */
+        std::optional<uint64_t> bound_(uint64_t key, bool upper) const noexcept;
+    };
+
+} // namespace core::General
+
+#endif // HOURS_INDEX_H
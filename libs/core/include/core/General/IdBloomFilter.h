@@ -0,0 +1,118 @@
+/**
+ * @file IdBloomFilter.h
+ * @brief Cache-line blocked Bloom filter over Employee ids, stored beside a data file.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef ID_BLOOM_FILTER_H
+#define ID_BLOOM_FILTER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Employee.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class IdBloomFilter
+     * @brief Answers "definitely absent" or "maybe present" for Employee ids.
+     *
+     * The filter is an array of 64-byte blocks, one cache line each. An id
+     * hashes to one block and sets one bit in each of its eight 64-bit
+     * words. A lookup therefore touches a single cache line. The eight bit
+     * positions are derived from the hash with fixed odd multipliers, so the
+     * probe is branch-free and vectorizes: AVX2 builds and tests the whole
+     * block mask at once, SSE2 tests it 128 bits at a time, and the scalar
+     * path gives identical answers.
+     *
+     * Ids are 16-bit, so the filter never grows past MAX_BLOCKS blocks
+     * (8 KiB), which is one bit per possible id. A filter of that size is
+     * kept as an exact bitmap instead: bit i is set for id i, and there
+     * are no false positives.
+     *
+     * File layout: [Header][Block * block count]. The header carries a
+     * CRC-32C of the blocks. Files are written in host byte order.
+     */
+    class IdBloomFilter
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x46424945;                 /**< "EIBF" in little-endian order. */
+        static constexpr uint32_t VERSION = 2;                        /**< On-disk format version; 2 added the exact bitmap. */
+        static constexpr size_t BLOCK_BYTES = 64;                     /**< One cache line. */
+        static constexpr size_t BLOCK_WORDS = BLOCK_BYTES / sizeof(uint64_t); /**< Words, and bits set per id. */
+        static constexpr size_t MAX_BLOCKS = (size_t(Employee::ID_MAX) + 1) / (BLOCK_BYTES * 8); /**< One bit per possible id. */
+        static constexpr double DEFAULT_BITS_PER_KEY = 10.0;          /**< About 1% false positives. */
+        static constexpr const char* FILE_SUFFIX = ".bloom";          /**< Appended to the data file name by path_for(). */
+        /** @} */
+
+        /** @brief One cache line of the filter. */
+        struct alignas(BLOCK_BYTES) Block
+        {
+            uint64_t words[BLOCK_WORDS];
+        };
+
+    private:
+        std::vector<Block> blocks_;   /**< Filter bits. */
+        uint64_t keys_;               /**< Ids inserted, counting repeats. */
+
+    public:
+        /** @brief Constructs an empty filter that contains nothing. */
+        IdBloomFilter() noexcept;
+
+        /**
+         * @brief Sizes a filter for @p expected_keys ids.
+         * @param bits_per_key Filter bits per expected id; more bits, fewer false positives.
+         */
+        explicit IdBloomFilter(size_t expected_keys, double bits_per_key = DEFAULT_BITS_PER_KEY);
+
+        /** @brief Adds @p id. */
+        void insert(Employee::ID_TYPE id) noexcept;
+
+        /** @return false if @p id was definitely never inserted. */
+        bool may_contain(Employee::ID_TYPE id) const noexcept;
+
+        /** @return Number of blocks. */
+        size_t block_count() const noexcept;
+
+        /** @return true if the filter is an exact bitmap with no false positives. */
+        bool exact() const noexcept;
+
+        /** @return Number of insert() calls. */
+        uint64_t key_count() const noexcept;
+
+        /** @return Size of the filter bits in bytes. */
+        size_t size_bytes() const noexcept;
+
+        /** @name Building and Persistence
+         *  @{ */
+
+        /**
+         * @brief Builds a filter over every id of an Employee file.
+         * @return std::nullopt if @p data is not a readable Employee file.
+         */
+        static std::optional<IdBloomFilter> from_file(const File& data, double bits_per_key = DEFAULT_BITS_PER_KEY);
+
+        /** @brief Writes the filter to @p out from offset 0. */
+        bool write(const File& out) const;
+
+        /** @return The filter stored in @p in, or std::nullopt if it is damaged. */
+        static std::optional<IdBloomFilter> read(const File& in);
+
+        /** @return The conventional filter path for the data file @p data_path. */
+        static std::string path_for(const std::string& data_path);
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // ID_BLOOM_FILTER_H
@@ -0,0 +1,96 @@
+/**
+ * @file InternedColumns.h
+ * @brief Column-oriented Employee table with dictionary-coded names.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef INTERNED_COLUMNS_H
+#define INTERNED_COLUMNS_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include "NameDictionary.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class InternedColumns
+     * @brief Like EmployeeColumns, but each row stores a 4-byte name code
+     *        instead of a 15-byte name cell.
+     *
+     * Rows with equal names have equal codes, so name equality, hashing and
+     * grouping are integer operations, and grouping by name is a direct
+     * array index. The table owns its dictionary; codes from different
+     * tables are not comparable.
+     */
+    class InternedColumns
+    {
+    private:
+        std::vector<Employee::ID_TYPE> ids_;      /**< Id column. */
+        std::vector<double> hours_;               /**< Hours column. */
+        std::vector<NameDictionary::Code> codes_; /**< Name code column. */
+        NameDictionary dictionary_;               /**< Names of the codes. */
+
+    public:
+        /** @brief Constructs an empty table. */
+        InternedColumns() = default;
+
+        /** @brief Builds a table from a plain column table. */
+        static InternedColumns from_columns(const EmployeeColumns& table);
+
+        /** @brief Builds a table from @p n consecutive serialized records. */
+        static InternedColumns from_records(const char* records, size_t n);
+
+        /** @name Size Management
+         *  @{ */
+        size_t size() const noexcept;      /**< @return Number of rows. */
+        bool empty() const noexcept;       /**< @return true if there are no rows. */
+        void reserve(size_t n);            /**< @brief Reserves capacity in every column. */
+        void clear() noexcept;             /**< @brief Removes all rows and names. */
+        /** @} */
+
+        /** @name Row Access
+         *  @{ */
+
+        /** @brief Appends a row. */
+        void push_back(const Employee& e);
+
+        /** @brief Appends a row decoded from one serialized record. */
+        void push_back_record(const char* record);
+
+        /** @brief Materializes row @p i as an Employee. */
+        Employee employee(size_t i) const noexcept;
+
+        /** @return Normalized name of row @p i. */
+        const char* name(size_t i) const noexcept;
+
+        /** @brief Expands the table back into plain columns. */
+        EmployeeColumns to_columns() const;
+        /** @} */
+
+        /** @name Column Access
+         *  @{ */
+        const std::vector<Employee::ID_TYPE>& ids() const noexcept;      /**< @return Id column. */
+        const std::vector<double>& hours() const noexcept;               /**< @return Hours column. */
+        const std::vector<NameDictionary::Code>& codes() const noexcept; /**< @return Name code column. */
+        const NameDictionary& dictionary() const noexcept;               /**< @return Name dictionary. */
+        /** @} */
+
+        /** @name Grouping by Name
+         *  Results are indexed by name code.
+         *  @{ */
+        std::vector<uint64_t> count_by_name() const;   /**< @return Rows per name. */
+        std::vector<double> hours_by_name() const;     /**< @return Sum of hours per name. */
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // INTERNED_COLUMNS_H
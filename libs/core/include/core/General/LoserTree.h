@@ -0,0 +1,101 @@
+/**
+ * @file LoserTree.h
+ * @brief Tournament tree of losers for k-way merging.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef LOSER_TREE_H
+#define LOSER_TREE_H
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class LoserTree
+     * @brief Selects the smallest head among k sorted sources.
+     *
+     * Each internal node stores the loser of its match, so replacing the
+     * winner costs exactly log2(k) comparisons along one leaf-to-root path,
+     * without the sibling checks of a binary heap. Ties go to the lower
+     * source index, which makes merges of ordered runs stable.
+     *
+     * @tparam Less Callable `bool(size_t a, size_t b)` comparing the current
+     *         heads of sources a and b. It is never called for exhausted sources.
+     */
+    template <class Less>
+    class LoserTree
+    {
+    private:
+        size_t k_;                  /**< Number of sources. */
+        std::vector<size_t> tree_;  /**< tree_[0] is the winner, tree_[1..k) are losers. */
+        std::vector<char> done_;    /**< Exhausted flags per source. */
+        Less less_;                 /**< Head comparison. */
+
+        bool beats_(size_t a, size_t b)
+        {
+            if(done_[a]) return false;
+            if(done_[b]) return true;
+            if(less_(a, b)) return true;
+            return !less_(b, a) && a < b;
+        }
+
+        size_t build_(size_t node)
+        {
+            // Nodes numbered >= k are leaves: node k + i stands for source i
+            if(node >= k_) return node - k_;
+            size_t l = build_(2 * node);
+            size_t r = build_(2 * node + 1);
+            if(beats_(l, r)) { tree_[node] = r; return l; }
+            tree_[node] = l;
+            return r;
+        }
+
+    public:
+        /**
+         * @brief Creates a tree over @p k sources.
+         * @param exhausted Optional per-source flags for sources that start empty.
+         */
+        LoserTree(size_t k, Less less, const std::vector<char>& exhausted = {})
+            : k_(k), tree_(k ? k : 1), done_(k, 0), less_(std::move(less))
+        {
+            for(size_t i = 0; i < exhausted.size() && i < k; i++)
+                done_[i] = exhausted[i];
+            if(0 < k_)
+                tree_[0] = build_(1);
+        }
+
+        /** @return true once every source is exhausted. */
+        bool empty() const noexcept
+        { return 0 == k_ || done_[tree_[0]]; }
+
+        /** @return Index of the source holding the smallest head. */
+        size_t top() const noexcept
+        { return tree_[0]; }
+
+        /**
+         * @brief Replays the path of the current winner after its head changed.
+         * @param exhausted Marks the winner's source as finished.
+         */
+        void replace_top(bool exhausted = false)
+        {
+            size_t cur = tree_[0];
+            done_[cur] = exhausted ? 1 : 0;
+            for(size_t node = (cur + k_) / 2; 0 < node; node /= 2)
+            {
+                if(beats_(tree_[node], cur))
+                    std::swap(tree_[node], cur);
+            }
+            tree_[0] = cur;
+        }
+    };
+} // namespace core::General
+
+#endif // LOSER_TREE_H
@@ -0,0 +1,122 @@
+/**
+ * @file MapReduce.h
+ * @brief Multi-process GROUP BY over an Employee file.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef MAP_REDUCE_H
+#define MAP_REDUCE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+#include "File.h"
+#include "GroupBy.h"
+#include "NameDictionary.h"
+#include "Pipe.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Options for MapReduce::run(). */
+    struct MapReduceOptions
+    {
+        size_t workers = 0;                               /**< Worker processes; 0 means one per logical processor. */
+        GroupKey key = GroupKey::id_bucket;               /**< Grouping field. */
+        uint32_t bucket_width = 1024;                     /**< Ids per bucket for GroupKey::id_bucket. */
+        uint64_t min_records_per_worker = 65536;          /**< Smaller files use fewer workers. */
+        DWORD pipe_buffer = Pipe::DEFAULT_BUFFER_SIZE;    /**< Buffer of each worker's result pipe. */
+        DWORD timeout_ms = INFINITE;                      /**< Time the workers may take; later ones are terminated. */
+    };
+
+    /** @brief A contiguous run of records handed to one worker. */
+    struct MapRange
+    {
+        uint64_t first;   /**< First record. */
+        uint64_t count;   /**< Records in the range. */
+    };
+
+    /**
+     * @class MapReduce
+     * @brief Splits an Employee file into ranges and aggregates each one in its own process.
+     *
+     * The driver starts one worker process per range, each running the same
+     * executable with WORKER_FLAG and the range on its command line. A
+     * worker opens the file, groups its range like GroupBy and streams the
+     * partial rows to its standard output, which is the write end of a
+     * Pipe. The driver reads every pipe to the end and merges the partials
+     * in range order, so name codes follow first appearance in the file,
+     * exactly as with GroupBy::run(). A worker that crashes, fails or sends
+     * a damaged partial fails the whole run; it cannot corrupt the others.
+     * A watchdog thread terminates workers still running when
+     * MapReduceOptions::timeout_ms expires, which also ends their pipes, so
+     * a hung worker cannot block the driver.
+     *
+     * Partials are a small header, fixed-size rows and a CRC-32C, in host
+     * byte order. Every worker runs on the same host.
+     *
+     * @code
+     * int main(int argc, char* argv[])
+     * {
+     *     if(MapReduce::is_worker(argc, argv))
+     *         return MapReduce::worker_main(argc, argv);
+     *     auto r = MapReduce::run(argv[0], "data.emp", MapReduceOptions());
+     *     ...
+     * }
+     * @endcode
+     */
+    class MapReduce
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr uint32_t MAGIC = 0x4D504D45;                   /**< "EMPM" in little-endian order. */
+        static constexpr uint32_t VERSION = 1;                          /**< Partial format version. */
+        static constexpr const char* WORKER_FLAG = "--map-worker";      /**< First argument of a worker process. */
+        static constexpr size_t BATCH_RECORDS = 65536;                  /**< Records per read in map(). */
+        /** @} */
+
+        /** @brief Splits [0, records) into at most @p workers near-equal ranges of at least @p min_records each. */
+        static std::vector<MapRange> split(uint64_t records, size_t workers, uint64_t min_records);
+
+        /**
+         * @brief Groups records [first, first + count) of @p data and writes the partial to @p out.
+         *
+         * @p out is written sequentially, so it may be a pipe, a standard
+         * handle or a file.
+         */
+        static bool map(const File& data, const MapRange& range, const GroupByOptions& opts, const File& out);
+
+        /**
+         * @brief Reads one partial from @p in and folds it into @p table.
+         *
+         * For name groups the keys in @p table are codes of @p names,
+         * interned in the order the partials arrive.
+         * @return false if the partial is truncated, damaged or of another key.
+         */
+        static bool reduce(const File& in, GroupKey key, GroupTable& table, NameDictionary& names);
+
+        /**
+         * @brief Runs the whole job with worker processes started from @p worker_exe.
+         * @param worker_exe Executable whose main() hands WORKER_FLAG runs to worker_main().
+         * @param data_path Employee file, opened separately by every worker.
+         * @return The merged groups, or std::nullopt if the file or any worker failed.
+         */
+        static std::optional<GroupByResult> run(const std::string& worker_exe, const std::string& data_path,
+                                                const MapReduceOptions& opts);
+
+        /** @return true if this process was started as a worker by run(). */
+        static bool is_worker(int argc, char* argv[]) noexcept;
+
+        /** @brief Worker entry point. @return The process exit code; 0 on success. */
+        static int worker_main(int argc, char* argv[]);
+    };
+} // namespace core::General
+
+#endif // MAP_REDUCE_H
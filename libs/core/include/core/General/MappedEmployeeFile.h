@@ -0,0 +1,176 @@
+/**
+ * @file MappedEmployeeFile.h
+ * @brief Read-only memory-mapped Employee file exposed as a random-access range of EmployeeViews.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef MAPPED_EMPLOYEE_FILE_H
+#define MAPPED_EMPLOYEE_FILE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include "AlignedEmployee.h"
+#include "Employee.h"
+#include "EmployeeView.h"
+#include "File.h"
+#include "FileMapping.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Expected access pattern, passed to the cache manager when the file is opened. */
+    enum class MappedAccess
+    {
+        normal,       /**< No hint. */
+        sequential,   /**< Front-to-back scans; FILE_FLAG_SEQUENTIAL_SCAN enables aggressive read-ahead. */
+        random        /**< Lookups such as binary search; FILE_FLAG_RANDOM_ACCESS disables read-ahead. */
+    };
+
+    /**
+     * @class MappedEmployeeFile
+     * @brief A move-only, read-only view of every record of an Employee file.
+     *
+     * Host-order versioned files in either layout and legacy headerless
+     * files are mapped whole; record i is viewed in place at i * stride(),
+     * so only the pages actually touched are read. Aligned files are viewed
+     * through their 32-byte records directly, with every field load
+     * naturally aligned. Iterators are random access and yield
+     * EmployeeView by value, so the range works with std::lower_bound,
+     * std::for_each (including the execution-policy overloads) and the
+     * other standard algorithms. On a file sorted by id, lower_bound()
+     * touches about log2(size()) records, a few page faults even for
+     * archives of many gigabytes.
+     *
+     * Block checksums are not verified; call EmployeeFileReader::verify()
+     * when the file is not trusted. The view stays valid after the File is
+     * closed.
+     */
+    class MappedEmployeeFile
+    {
+    public:
+        /**
+         * @class iterator
+         * @brief Random-access iterator over the mapped records.
+         *
+         * Dereferencing yields an EmployeeView by value, so the iterator
+         * has no operator->.
+         */
+        class iterator
+        {
+        private:
+            const char* record_;      /**< Current record. */
+            EmployeeLayout layout_;   /**< Layout of every record. */
+
+            std::ptrdiff_t stride_() const noexcept
+            { return static_cast<std::ptrdiff_t>(EmployeeView::stride(layout_)); }
+
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef EmployeeView value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef void pointer;
+            typedef EmployeeView reference;
+
+            /** @brief Constructs an iterator at @p record. */
+            explicit iterator(const char* record = nullptr, EmployeeLayout layout = EmployeeLayout::compact) noexcept
+                : record_(record), layout_(layout)
+            {
+            }
+
+            EmployeeView operator*() const noexcept
+            { return EmployeeView(record_, layout_); }
+
+            EmployeeView operator[](difference_type n) const noexcept
+            { return EmployeeView(record_ + n * stride_(), layout_); }
+
+            iterator& operator++() noexcept { record_ += stride_(); return *this; }
+            iterator& operator--() noexcept { record_ -= stride_(); return *this; }
+            iterator operator++(int) noexcept { iterator t = *this; record_ += stride_(); return t; }
+            iterator operator--(int) noexcept { iterator t = *this; record_ -= stride_(); return t; }
+            iterator& operator+=(difference_type n) noexcept { record_ += n * stride_(); return *this; }
+            iterator& operator-=(difference_type n) noexcept { record_ -= n * stride_(); return *this; }
+
+            friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+            friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+            friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+            friend difference_type operator-(const iterator& a, const iterator& b) noexcept
+            { return (a.record_ - b.record_) / a.stride_(); }
+
+            friend bool operator==(const iterator& a, const iterator& b) noexcept { return a.record_ == b.record_; }
+            friend bool operator!=(const iterator& a, const iterator& b) noexcept { return a.record_ != b.record_; }
+            friend bool operator<(const iterator& a, const iterator& b) noexcept { return a.record_ < b.record_; }
+            friend bool operator>(const iterator& a, const iterator& b) noexcept { return a.record_ > b.record_; }
+            friend bool operator<=(const iterator& a, const iterator& b) noexcept { return a.record_ <= b.record_; }
+            friend bool operator>=(const iterator& a, const iterator& b) noexcept { return a.record_ >= b.record_; }
+        };
+
+        typedef iterator const_iterator;
+
+    private:
+        FileMapping mapping_;     /**< Whole-file view. */
+        const char* records_;     /**< Record 0 inside the view. */
+        uint64_t size_;           /**< Number of records. */
+        EmployeeLayout layout_;   /**< Layout of every record. */
+
+        MappedEmployeeFile(FileMapping mapping, const char* records, uint64_t size, EmployeeLayout layout) noexcept;
+
+    public:
+        /** @name Lifecycle Management
+         *  @{ */
+
+        /**
+         * @brief Maps @p file.
+         * @return std::nullopt if the file is not a readable Employee file,
+         *         was written on an opposite-endian host, is empty, or
+         *         cannot be mapped.
+         */
+        static std::optional<MappedEmployeeFile> open(const File& file) noexcept;
+
+        /**
+         * @brief Opens @p path read-only with the cache hint for @p access and maps it.
+         *
+         * The file handle is closed again before returning; the mapping
+         * keeps the file open.
+         */
+        static std::optional<MappedEmployeeFile> open(const char* path, MappedAccess access = MappedAccess::normal) noexcept;
+        /** @} */
+
+        /** @name Access
+         *  @{ */
+        uint64_t size() const noexcept;                       /**< @return Number of records. */
+        bool empty() const noexcept;                          /**< @return true if there are no records. */
+        const char* data() const noexcept;                    /**< @return First byte of record 0. */
+        EmployeeLayout layout() const noexcept;               /**< @return Layout of the mapped records. */
+        size_t stride() const noexcept;                       /**< @return Bytes between records. */
+        EmployeeView operator[](uint64_t i) const noexcept;   /**< @return A view of record @p i; not range checked. */
+        iterator begin() const noexcept;                      /**< @return Iterator at record 0. */
+        iterator end() const noexcept;                        /**< @return Iterator past the last record. */
+        /** @} */
+
+        /**
+         * @brief Finds the first record whose id is not less than @p id.
+         * @pre The file is sorted by ascending id.
+         */
+        iterator lower_bound(Employee::ID_TYPE id) const noexcept;
+
+        /** @brief Finds the first record whose id is greater than @p id. @pre As lower_bound(). */
+        iterator upper_bound(Employee::ID_TYPE id) const noexcept;
+
+        /**
+         * @brief Asks the memory manager to read records [first, first + count) ahead of use.
+         *
+         * Useful before scanning a window of a file opened for random
+         * access. The range is clamped to the file.
+         * @return false if the request was rejected; the records stay readable either way.
+         */
+        bool prefetch(uint64_t first, uint64_t count) const noexcept;
+    };
+} // namespace core::General
+
+#endif // MAPPED_EMPLOYEE_FILE_H
@@ -0,0 +1,98 @@
+/**
+ * @file NameDictionary.h
+ * @brief Interning dictionary that maps Employee names to dense 32-bit codes.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NAME_DICTIONARY_H
+#define NAME_DICTIONARY_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "Employee.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class NameDictionary
+     * @brief Assigns each distinct name a code in [0, size()) in first-seen order.
+     *
+     * Names are normalized to the Employee name cell: at most BUFF_SIZE bytes,
+     * cut at the first NUL and zero-padded, so two names that compare equal
+     * with strncmp(a, b, BUFF_SIZE) always get the same code. Each cell is
+     * stored as two 64-bit words, which makes hashing and equality a couple
+     * of integer operations.
+     *
+     * The table uses open addressing with linear probing; every slot keeps
+     * the upper half of the hash next to the code, so probes rarely touch
+     * the cells themselves.
+     */
+    class NameDictionary
+    {
+    public:
+        /** @brief Dense name code. */
+        typedef uint32_t Code;
+
+        /** @name Constants
+         *  @{ */
+        static constexpr Code NONE = UINT32_MAX;    /**< Returned by find() for unknown names. */
+        /** @} */
+
+    private:
+        /** @brief Normalized name cell: BUFF_SIZE bytes plus one zero byte. */
+        struct Cell
+        {
+            uint64_t lo;
+            uint64_t hi;
+        };
+        static_assert(Employee::BUFF_SIZE < sizeof(Cell), "A name cell must hold the name and a terminator");
+
+        std::vector<Cell> cells_;      /**< Cell of every code. */
+        std::vector<uint64_t> slots_;  /**< (hash >> 32) << 32 | (code + 1); 0 marks an empty slot. */
+        size_t mask_;                  /**< slots_.size() - 1. */
+
+        static Cell normalize_(const char* name) noexcept;
+        static uint64_t hash_(const Cell& c) noexcept;
+        size_t probe_(const Cell& c, uint64_t h) const noexcept;
+        void grow_();
+
+    public:
+        /** @brief Constructs an empty dictionary. */
+        NameDictionary();
+
+        /**
+         * @brief Returns the code of @p name, adding it if it is new.
+         * @param name Name of at most BUFF_SIZE bytes; need not be terminated at BUFF_SIZE.
+         */
+        Code intern(const char* name);
+
+        /** @return The code of @p name, or NONE if it was never interned. */
+        Code find(const char* name) const noexcept;
+
+        /**
+         * @return The normalized name of @p code: BUFF_SIZE bytes, zero-padded
+         *         and always NUL-terminated. Stable until the next intern().
+         */
+        const char* name(Code code) const noexcept;
+
+        /** @return Number of distinct names. */
+        size_t size() const noexcept;
+
+        /** @brief Prepares room for @p n distinct names. */
+        void reserve(size_t n);
+
+        /** @brief Removes every name. */
+        void clear() noexcept;
+
+        /** @return Hash of @p name after normalization, consistent with intern(). */
+        static uint64_t hash(const char* name) noexcept;
+    };
+} // namespace core::General
+
+#endif // NAME_DICTIONARY_H
@@ -0,0 +1,175 @@
+/**
+ * @file PageCache.h
+ * @brief Bounded concurrent cache of fixed-size record pages with CLOCK eviction.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef PAGE_CACHE_H
+#define PAGE_CACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <atomic>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeFile.h"
+#include "EmployeeView.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Options for PageCache. */
+    struct PageCacheOptions
+    {
+        size_t budget_bytes = 64u << 20;   /**< Memory for cached pages; at least one page is always kept. */
+        uint32_t page_records = 2048;      /**< Records per page (~50 KiB); 0 is treated as 1. */
+    };
+
+    /** @brief Counters of a PageCache. */
+    struct PageCacheStats
+    {
+        uint64_t hits = 0;        /**< Lookups served from memory. */
+        uint64_t misses = 0;      /**< Lookups that read the file. */
+        uint64_t evictions = 0;   /**< Pages dropped to make room. */
+    };
+
+    /**
+     * @class PageCache
+     * @brief Caches pages of page_records consecutive records of an Employee file.
+     *
+     * A fixed pool of frames is allocated up front from the byte budget.
+     * Lookups of cached pages take the lock in shared mode only, so
+     * concurrent hits never serialize. Misses pick a victim with the CLOCK
+     * algorithm: a hand sweeps the frames and clears reference bits, and the
+     * first unpinned frame whose bit is already clear is reused. The file is
+     * read outside the lock while the frame is marked as loading. Other
+     * threads that want the same page wait for that load and do not read
+     * the file a second time.
+     *
+     * Pages always hold compact host-layout records, whatever the layout of
+     * the file. A pinned page is never evicted; pins are released by the Pin
+     * destructor. The File must outlive the cache.
+     */
+    class PageCache
+    {
+    public:
+        /**
+         * @class Pin
+         * @brief Move-only reference that keeps one cached page resident.
+         */
+        class Pin
+        {
+        private:
+            PageCache* cache_;     /**< Owning cache, or nullptr if empty. */
+            size_t frame_;         /**< Pinned frame. */
+            const char* data_;     /**< First record of the page. */
+            uint64_t first_;       /**< Index of the first record. */
+            uint32_t count_;       /**< Records in the page. */
+
+            friend class PageCache;
+            Pin(PageCache* cache, size_t frame, const char* data, uint64_t first, uint32_t count) noexcept;
+
+        public:
+            /** @brief Constructs an empty pin. */
+            Pin() noexcept;
+            Pin(const Pin&) = delete;
+            Pin& operator=(const Pin&) = delete;
+            /** @brief Transfers the pin from @p other. */
+            Pin(Pin&& other) noexcept;
+            /** @brief Releases the current pin and takes over @p other. */
+            Pin& operator=(Pin&& other) noexcept;
+            /** @brief Releases the pin. */
+            ~Pin() noexcept;
+
+            /** @brief Releases the pin early. */
+            void release() noexcept;
+
+            bool valid() const noexcept;              /**< @return true if a page is pinned. */
+            const char* data() const noexcept;        /**< @return First record of the page. */
+            uint64_t first() const noexcept;          /**< @return File index of the first record. */
+            uint32_t size() const noexcept;           /**< @return Records in the page. */
+
+            /** @return A view of record @p i of the page. */
+            EmployeeView operator[](size_t i) const noexcept
+            { return EmployeeView(data_ + i * Employee::SERIALIZED_SIZE); }
+        };
+
+    private:
+        /** @brief Frame lifecycle. */
+        enum class FrameState : uint8_t
+        {
+            empty,
+            loading,
+            ready
+        };
+
+        /** @brief One slot of the pool. */
+        struct Frame
+        {
+            uint64_t page = 0;                        /**< Cached page while not empty. */
+            uint32_t count = 0;                       /**< Records in the page. */
+            FrameState state = FrameState::empty;     /**< Guarded by lock_. */
+            std::atomic<uint32_t> pins{ 0 };          /**< Active Pin objects. */
+            std::atomic<bool> referenced{ false };    /**< CLOCK reference bit. */
+        };
+
+        std::optional<EmployeeFileReader> reader_;    /**< Source of pages. */
+        uint32_t page_records_;                       /**< Records per page. */
+        size_t page_bytes_;                           /**< Bytes per frame. */
+        std::vector<char> arena_;                     /**< Frame storage. */
+        std::vector<Frame> frames_;                   /**< Frame metadata. */
+        std::unordered_map<uint64_t, size_t> map_;    /**< Page to frame; guarded by lock_. */
+        size_t hand_;                                 /**< CLOCK hand; guarded by lock_. */
+        mutable SRWLOCK lock_;                        /**< Guards the map and frame states. */
+        CONDITION_VARIABLE loaded_;                   /**< Signalled when a load finishes. */
+        std::atomic<uint64_t> hits_, misses_, evictions_;
+
+        /** @return An unpinned frame to reuse, or frames_.size() if every frame is busy. */
+        size_t victim_() noexcept;
+        void unpin_(size_t frame) noexcept;
+
+    public:
+        /** @brief Opens a cache over @p file; check is_open() afterwards. */
+        explicit PageCache(const File& file, const PageCacheOptions& opts = PageCacheOptions());
+
+        PageCache(const PageCache&) = delete;
+        PageCache& operator=(const PageCache&) = delete;
+
+        /** @return true if the file is a readable Employee file. */
+        bool is_open() const noexcept;
+
+        /** @return Number of records in the file. */
+        uint64_t size() const noexcept;
+
+        /** @return Records per page. */
+        uint32_t page_records() const noexcept;
+
+        /** @return Number of frames in the pool. */
+        size_t capacity() const noexcept;
+
+        /**
+         * @brief Pins page @p page, reading it if it is not cached.
+         * @return An empty Pin if the page is out of range, the read fails
+         *         or every frame is pinned.
+         */
+        Pin pin(uint64_t page);
+
+        /** @brief Pins the page that holds record @p record. */
+        Pin pin_record(uint64_t record);
+
+        /** @return Record @p record, or std::nullopt if it cannot be read. */
+        std::optional<Employee> at(uint64_t record);
+
+        /** @return Snapshot of the counters. */
+        PageCacheStats stats() const noexcept;
+    };
+} // namespace core::General
+
+#endif // PAGE_CACHE_H
@@ -0,0 +1,102 @@
+/**
+ * @file Parallel.h
+ * @brief Fork-join helper that runs a callable on a group of Thread workers.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+#include "Thread.h"
+
+/**
+ * @namespace core::General
+ * @brief Core utilities for system object management.
+ */
+namespace core::General
+{
+    /**
+     * @class Parallel
+     * @brief Static helpers that fan work out to core::General::Thread workers.
+     */
+    class Parallel
+    {
+    private:
+        /** @brief Per-worker start block handed to the Win32 entry point. */
+        template <class F>
+        struct Task
+        {
+            F* fn;          /**< Shared callable. */
+            size_t index;   /**< Worker index passed to the callable. */
+        };
+
+        template <class F>
+        static DWORD WINAPI entry_(LPVOID param)
+        {
+            Task<F>* task = static_cast<Task<F>*>(param);
+            (*task->fn)(task->index);
+            return 0;
+        }
+
+    public:
+        /** @return A worker count for @p requested, where 0 means one per logical processor. */
+        static size_t workers(size_t requested) noexcept
+        {
+            if(0 != requested) return requested;
+            size_t n = Thread::hardware_concurrency();
+            return 0 == n ? 1 : n;
+        }
+
+        /**
+         * @brief Calls @p fn(i) for every i in [0, count) on its own thread and joins them.
+         *
+         * Index 0 runs on the calling thread. If a thread cannot be created its
+         * index also runs on the caller, so every index is always executed.
+         *
+         * @param count Number of workers.
+         * @param fn Callable taking the worker index; must not throw.
+         */
+        template <class F>
+        static void run(size_t count, F&& fn)
+        {
+            typedef typename std::remove_reference<F>::type Fn;
+            if(0 == count) return;
+
+            std::vector<Task<Fn>> tasks(count);
+            std::vector<Thread> threads(count);
+            for(size_t i = 1; i < count; i++)
+            {
+                tasks[i] = { &fn, i };
+                threads[i] = Thread::create(nullptr, 0, &entry_<Fn>, &tasks[i], 0, nullptr);
+            }
+
+            fn(0);
+            for(size_t i = 1; i < count; i++)
+            {
+                if(threads[i].joinable())
+                    threads[i].join();
+                else
+                    fn(i);
+            }
+        }
+
+        /**
+         * @brief Splits [0, n) into @p parts contiguous ranges and returns their bounds.
+         * @return parts + 1 ascending offsets; range i is [b[i], b[i + 1]).
+         */
+        static std::vector<size_t> split(size_t n, size_t parts)
+        {
+            if(0 == parts) parts = 1;
+            std::vector<size_t> bounds(parts + 1);
+            for(size_t i = 0; i <= parts; i++)
+                bounds[i] = static_cast<size_t>((static_cast<unsigned long long>(n) * i) / parts);
+            return bounds;
+        }
+    };
+} // namespace core::General
+
+#endif // PARALLEL_H
@@ -0,0 +1,167 @@
+/**
+ * @file ParallelScan.h
+ * @brief Partitioned multi-threaded scan driver over Employee files.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef PARALLEL_SCAN_H
+#define PARALLEL_SCAN_H
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "EmployeeFile.h"
+#include "EmployeeView.h"
+#include "File.h"
+#include "FileMapping.h"
+#include "Parallel.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Options for parallel_scan(). */
+    struct ParallelScanOptions
+    {
+        size_t threads = 0;              /**< Worker threads; 0 means one per logical processor. */
+        size_t batch_records = 65536;    /**< Records handed to the callback at a time; 0 is treated as 1. */
+        bool map_file = true;            /**< Read host-order compact and aligned files through a memory mapping. */
+    };
+
+    /**
+     * @class ParallelScan
+     * @brief An opened Employee file split into record-aligned worker ranges.
+     *
+     * Worker w owns records [begin(w), begin(w + 1)). Host-order compact
+     * and aligned files are mapped: fetch_records() then views the records
+     * in place, in the file's own layout, so aligned files are read with
+     * aligned loads at a 32-byte stride and nothing is copied. Opposite-
+     * endian and unmappable files go through positional reads into a
+     * worker-owned buffer. fetch() always returns compact records,
+     * converting mapped aligned records into the buffer. All paths are
+     * safe to call from any number of threads at once. The File must
+     * outlive the scan.
+     */
+    class ParallelScan
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t MIN_RECORDS_PER_THREAD = 65536;   /**< Smaller files use fewer workers. */
+        /** @} */
+
+    private:
+        EmployeeFileReader reader_;   /**< Header and positional reads. */
+        FileMapping mapping_;         /**< Whole-file view, if mapped. */
+        size_t workers_;              /**< Number of ranges. */
+        size_t batch_;                /**< Records per fetch. */
+
+        ParallelScan(EmployeeFileReader reader, FileMapping mapping, size_t workers, size_t batch) noexcept;
+
+    public:
+        /**
+         * @brief Opens @p file and plans the ranges.
+         * @return std::nullopt if the file is not a readable Employee file.
+         */
+        static std::optional<ParallelScan> open(const File& file,
+                                                const ParallelScanOptions& opts = ParallelScanOptions());
+
+        /** @return The underlying reader. */
+        const EmployeeFileReader& reader() const noexcept;
+
+        /** @return Number of records. */
+        uint64_t size() const noexcept;
+
+        /** @return Number of worker ranges. */
+        size_t workers() const noexcept;
+
+        /** @return Records per batch. */
+        size_t batch_records() const noexcept;
+
+        /** @return true if records are read in place from a mapping. */
+        bool mapped() const noexcept;
+
+        /** @return First record of range @p w; begin(workers()) is size(). */
+        uint64_t begin(size_t w) const noexcept;
+
+        /**
+         * @brief Returns records [first, first + n) in host layout.
+         * @param buffer Scratch space used when the records cannot be mapped.
+         * @return Pointer to n * Employee::SERIALIZED_SIZE bytes, valid until the
+         *         next call with the same buffer, or nullptr on a read error.
+         */
+        const char* fetch(uint64_t first, size_t n, std::vector<char>& buffer) const;
+
+        /**
+         * @brief Views records [first, first + n) in place when mapped, in the file's layout.
+         * @param buffer Scratch space used when the records cannot be mapped; they are then compact.
+         * @return The records, valid until the next call with the same buffer; data() is
+         *         nullptr on a read error.
+         */
+        EmployeeRecords fetch_records(uint64_t first, size_t n, std::vector<char>& buffer) const;
+    };
+
+    /**
+     * @brief Runs @p fn over every record of an Employee file on several threads.
+     *
+     * Each worker gets a default-constructed Result and calls
+     * fn(result, records, n, first) for consecutive batches of its range,
+     * where @p records is an EmployeeRecords view of n records starting at
+     * record @p first, read in place from a mapping when possible. Afterwards the per-worker results are folded in range order
+     * with combine(total, std::move(part)), so order-sensitive merges are
+     * deterministic.
+     *
+     * @code
+     * auto hours = parallel_scan<double>(file,
+     *     [](double& sum, const EmployeeRecords& rec, size_t n, uint64_t) {
+     *         for(size_t i = 0; i < n; i++)
+     *             sum += rec[i].hours();
+     *     },
+     *     [](double& total, double&& part) { total += part; });
+     * @endcode
+     *
+     * @return The combined result, or std::nullopt if the file cannot be read.
+     */
+    template <class Result, class Fn, class Combine>
+    std::optional<Result> parallel_scan(const File& file, Fn&& fn, Combine&& combine,
+                                        const ParallelScanOptions& opts = ParallelScanOptions())
+    {
+        std::optional<ParallelScan> scan = ParallelScan::open(file, opts);
+        if(!scan.has_value())
+            return std::nullopt;
+
+        const size_t workers = scan->workers();
+        std::vector<Result> results(workers);
+        std::vector<char> failed(workers, 0);
+        Parallel::run(workers, [&](size_t w) {
+            std::vector<char> buffer;
+            const uint64_t last = scan->begin(w + 1);
+            for(uint64_t first = scan->begin(w); first < last; first += scan->batch_records())
+            {
+                size_t n = static_cast<size_t>(std::min<uint64_t>(scan->batch_records(), last - first));
+                EmployeeRecords records = scan->fetch_records(first, n, buffer);
+                if(nullptr == records.data())
+                {
+                    failed[w] = 1;
+                    return;
+                }
+                fn(results[w], records, n, first);
+            }
+        });
+
+        for(char f : failed)
+            if(0 != f)
+                return std::nullopt;
+        for(size_t w = 1; w < workers; w++)
+            combine(results[0], std::move(results[w]));
+        return std::move(results[0]);
+    }
+} // namespace core::General
+
+#endif // PARALLEL_SCAN_H
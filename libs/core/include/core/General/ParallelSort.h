@@ -0,0 +1,102 @@
+/**
+ * @file ParallelSort.h
+ * @brief Multi-threaded in-memory sorting of Employee arrays and columns.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include "RecordOrder.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class ParallelSort
+     * @brief Stable parallel sorts that move 16-byte key/index pairs instead of records.
+     *
+     * Every sort first extracts a (64-bit key, 32-bit row index) pair per row.
+     * Id and hours keys are fixed-width integers and are sorted with a
+     * parallel LSD radix sort (8-bit digits, per-thread histograms, constant
+     * digits skipped). Name keys are sorted with a parallel merge sort whose
+     * merges are split across workers by merge-path co-ranking. The
+     * resulting permutation is applied to the payload with parallel gathers.
+     *
+     * Row indices are 32-bit, so inputs of more than MAX_ROWS rows are
+     * rejected; sort larger data with ExternalSort.
+     */
+    class ParallelSort
+    {
+    public:
+        /** @brief Sort handle for one row. */
+        struct KeyIndex
+        {
+            uint64_t key;     /**< Order-preserving key (see RecordOrder). */
+            uint32_t index;   /**< Original row index. */
+        };
+
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t MIN_PARALLEL_ROWS = 1u << 15;  /**< Rows per worker below which sorting stays single-threaded. */
+        static constexpr unsigned RADIX_BITS = 8;              /**< Digit width of the radix sort. */
+        static constexpr size_t MAX_ROWS = UINT32_MAX;         /**< Largest input a KeyIndex can address. */
+        /** @} */
+
+        /** @name Permutations
+         *  @{ */
+
+        /**
+         * @brief Computes the stable sorted order of @p n Employees.
+         * @param threads Worker count, 0 = one per logical processor.
+         * @return order[i] is the index of the row that belongs at position i,
+         *         or std::nullopt if @p n exceeds MAX_ROWS.
+         */
+        static std::optional<std::vector<uint32_t>> order(const Employee* data, size_t n, SortKey key,
+                                                          size_t threads = 0);
+
+        /** @brief Computes the stable sorted order of the rows of @p table; std::nullopt past MAX_ROWS rows. */
+        static std::optional<std::vector<uint32_t>> order(const EmployeeColumns& table, SortKey key,
+                                                          size_t threads = 0);
+        /** @} */
+
+        /** @name In-place Sorting
+         *  @{ */
+
+        /**
+         * @brief Stably sorts @p n Employees.
+         *
+         * Each object is copied twice: gathered into a scratch array in
+         * sorted order, then copied back. Both passes run in parallel.
+         * @return false if @p n exceeds MAX_ROWS; @p data is left untouched.
+         */
+        static bool sort(Employee* data, size_t n, SortKey key, size_t threads = 0);
+
+        /** @brief Stably sorts the rows of @p table, gathering each column once. @return false past MAX_ROWS rows. */
+        static bool sort(EmployeeColumns& table, SortKey key, size_t threads = 0);
+        /** @} */
+
+        /** @name Primitives
+         *  @{ */
+
+        /**
+         * @brief Stable parallel LSD radix sort of pairs by the low @p key_bits bits of their key.
+         * @param items Pairs to sort; @p scratch is resized to match and used as the second buffer.
+         */
+        static void radix_sort(std::vector<KeyIndex>& items, std::vector<KeyIndex>& scratch,
+                               unsigned key_bits, size_t threads = 0);
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // PARALLEL_SORT_H
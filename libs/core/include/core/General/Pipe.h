@@ -0,0 +1,147 @@
+/**
+ * @file Pipe.h
+ * @brief RAII wrapper for anonymous and named pipes with record streaming.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef PIPE_H
+#define PIPE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include "Employee.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief One side of a Pipe. */
+    enum class PipeEnd
+    {
+        read,    /**< Bytes come out here. */
+        write    /**< Bytes go in here. */
+    };
+
+    /**
+     * @class Pipe
+     * @brief A move-only pair of File handles for the two ends of an anonymous pipe.
+     *
+     * The pipe buffer is set at creation. A large buffer lets a producer
+     * write whole record batches without waiting for every read on the other
+     * side. To feed a child process, make the child's end inheritable, pass
+     * it through STARTUPINFO (Process::create with inherit_handles), then
+     * close the parent's copy, so that the reader sees end-of-stream when
+     * the writer finishes.
+     *
+     * The streaming helpers are static and work on any pipe end, including
+     * named pipes and standard handles wrapped in File. Record writes are
+     * batched: Employees are serialized BATCH_RECORDS at a time and each
+     * batch goes out in one WriteFile call.
+     */
+    class Pipe
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr DWORD DEFAULT_BUFFER_SIZE = 1u << 20;   /**< Pipe buffer requested by default. */
+        static constexpr size_t BATCH_RECORDS = 16384;           /**< Records serialized per write (~400 KiB). */
+        static constexpr DWORD MAX_IO_SIZE = 1u << 30;           /**< Largest single ReadFile/WriteFile. */
+        /** @} */
+
+    private:
+        File read_;    /**< Read end. */
+        File write_;   /**< Write end. */
+
+        Pipe(File&& read, File&& write) noexcept;
+
+    public:
+        /** @name Lifecycle Management
+         *  @{ */
+
+        /** @brief Constructs an object with both ends closed. */
+        Pipe() noexcept;
+
+        Pipe(const Pipe&) = delete;
+        Pipe& operator=(const Pipe&) = delete;
+
+        /** @brief Move constructor. Transfers both ends. */
+        Pipe(Pipe&& other) noexcept = default;
+
+        /** @brief Move assignment. Closes the current ends first. */
+        Pipe& operator=(Pipe&& other) noexcept = default;
+
+        /**
+         * @brief Creates an anonymous pipe whose ends are not inheritable.
+         * @param buffer_size Requested pipe buffer in bytes; the system may round it.
+         */
+        static std::optional<Pipe> create(DWORD buffer_size = DEFAULT_BUFFER_SIZE) noexcept;
+        /** @} */
+
+        /** @name Ends
+         *  @{ */
+        const File& reader() const noexcept;   /**< @return The read end. */
+        const File& writer() const noexcept;   /**< @return The write end. */
+
+        /** @brief Hands one end over, e.g. to keep it after the Pipe is gone. */
+        File release(PipeEnd end) noexcept;
+
+        /** @brief Closes one end; closing the write end signals end-of-stream to readers. */
+        bool close(PipeEnd end) noexcept;
+
+        /** @brief Controls whether child processes inherit @p end. */
+        static bool set_inheritable(const File& end, bool inheritable) noexcept;
+        /** @} */
+
+        /** @name Named Pipes
+         *  @{ */
+
+        /**
+         * @brief Creates the server end of a one-instance byte-mode named pipe.
+         * @param name Pipe name, e.g. "\\\\.\\pipe\\employees".
+         * @param access PIPE_ACCESS_INBOUND, PIPE_ACCESS_OUTBOUND or PIPE_ACCESS_DUPLEX.
+         * @param buffer_size Requested buffer for each direction.
+         * @return An invalid File on failure.
+         */
+        static File create_named(const char* name, DWORD access,
+                                 DWORD buffer_size = DEFAULT_BUFFER_SIZE) noexcept;
+
+        /** @brief Waits for a client on a server end. @return true once a client is connected. */
+        static bool connect(const File& server) noexcept;
+
+        /** @brief Opens the client end of @p name with GENERIC_READ and/or GENERIC_WRITE @p access. */
+        static File open_named(const char* name, DWORD access) noexcept;
+        /** @} */
+
+        /** @name Streaming
+         *  @{ */
+
+        /** @brief Writes all @p size bytes, in MAX_IO_SIZE calls at most. */
+        static bool write_all(const File& end, const char* data, size_t size) noexcept;
+
+        /** @return Bytes read into @p buf, fewer than @p size only at end-of-stream or on error. */
+        static size_t read_full(const File& end, char* buf, size_t size) noexcept;
+
+        /** @brief Writes @p n compact records in one call. */
+        static bool write_records(const File& end, const char* records, size_t n) noexcept;
+
+        /** @brief Serializes and writes @p n Employees, BATCH_RECORDS per call. */
+        static bool write_employees(const File& end, const Employee* src, size_t n) noexcept;
+
+        /**
+         * @brief Reads whatever whole records are available, up to @p max, waiting for at least one.
+         * @return Records read; 0 at end-of-stream. A trailing partial record is dropped.
+         */
+        static size_t read_records(const File& end, char* out, size_t max) noexcept;
+
+        /** @brief Same as read_records(), deserialized into @p out. */
+        static size_t read_employees(const File& end, Employee* out, size_t max) noexcept;
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // PIPE_H
@@ -0,0 +1,166 @@
+/**
+ * @file Query.h
+ * @brief Batch filter, projection and aggregation over Employee columns and files.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @class Predicate
+     * @brief Row condition tree: id and hours ranges, name prefixes, AND and OR.
+     *
+     * Predicates are evaluated a batch of rows at a time into a selection
+     * bitmap (bit i of word i / 64 set when row i matches). Leaves compare a
+     * whole column slice with SIMD instructions where available; inner nodes
+     * combine child bitmaps word by word.
+     */
+    class Predicate
+    {
+    public:
+        /** @brief Node kind. */
+        enum class Kind
+        {
+            all,           /**< Matches every row. */
+            id_range,      /**< id_lo <= id <= id_hi. */
+            hours_range,   /**< hours_lo <= hours <= hours_hi; NaN never matches. */
+            name_prefix,   /**< Name starts with the given bytes. */
+            all_of,        /**< Every child matches. */
+            any_of         /**< At least one child matches. */
+        };
+
+    private:
+        Kind kind_;
+        Employee::ID_TYPE id_lo_, id_hi_;
+        double hours_lo_, hours_hi_;
+        std::string prefix_;
+        std::vector<Predicate> children_;
+
+        explicit Predicate(Kind kind) noexcept;
+
+    public:
+        /** @brief Constructs a predicate that matches every row. */
+        Predicate() noexcept;
+
+        /** @name Factories
+         *  @{ */
+        static Predicate all() noexcept;
+        static Predicate id_between(Employee::ID_TYPE lo, Employee::ID_TYPE hi) noexcept;
+        static Predicate hours_between(double lo, double hi) noexcept;
+        /** @param prefix At most Employee::BUFF_SIZE bytes; longer prefixes match nothing. */
+        static Predicate name_starts_with(const std::string& prefix);
+        /** @} */
+
+        /** @brief Conjunction of two predicates. */
+        friend Predicate operator&&(Predicate a, Predicate b);
+        /** @brief Disjunction of two predicates. */
+        friend Predicate operator||(Predicate a, Predicate b);
+
+        /** @return Node kind. */
+        Kind kind() const noexcept;
+
+        /**
+         * @brief Evaluates rows [first, first + n) of @p table.
+         * @param bits Destination bitmap of (n + 63) / 64 words; bits past n are zero.
+         */
+        void evaluate(const EmployeeColumns& table, size_t first, size_t n, uint64_t* bits) const;
+    };
+
+    /** @brief Aggregates over the matching rows. */
+    struct QueryTotals
+    {
+        uint64_t count = 0;                                            /**< Matching rows. */
+        double hours_sum = 0.0;                                        /**< Sum of hours. */
+        double hours_min = std::numeric_limits<double>::infinity();    /**< Smallest hours value. */
+        double hours_max = -std::numeric_limits<double>::infinity();   /**< Largest hours value. */
+    };
+
+    /** @brief Output of Query::run(): totals plus the projected columns. */
+    struct QueryResult
+    {
+        QueryTotals totals;                               /**< Always computed. */
+        std::vector<uint64_t> rows;                       /**< Row numbers, if COLUMN_ROW was selected. */
+        std::vector<Employee::ID_TYPE> ids;               /**< Ids, if COLUMN_ID was selected. */
+        std::vector<double> hours;                        /**< Hours, if COLUMN_HOURS was selected. */
+        std::vector<EmployeeColumns::Name> names;         /**< Names, if COLUMN_NAME was selected. */
+    };
+
+    /**
+     * @class Query
+     * @brief A filter, a projection and the totals of the matching rows.
+     *
+     * Rows are never materialized as Employee objects: the predicate runs
+     * over column batches, and only the selected columns of matching rows
+     * are copied out. Files are read in large batches and decoded straight
+     * into a reused column table.
+     *
+     * @code
+     * Query q;
+     * q.where(Predicate::hours_between(40, 60) && Predicate::name_starts_with("Iv"))
+     *  .select(Query::COLUMN_ID | Query::COLUMN_HOURS);
+     * QueryResult r = q.run(table);
+     * @endcode
+     */
+    class Query
+    {
+    public:
+        /** @name Projection Columns
+         *  @{ */
+        static constexpr unsigned COLUMN_ROW = 1;     /**< Row number in the table or file. */
+        static constexpr unsigned COLUMN_ID = 2;      /**< Employee id. */
+        static constexpr unsigned COLUMN_HOURS = 4;   /**< Employee hours. */
+        static constexpr unsigned COLUMN_NAME = 8;    /**< Employee name cell. */
+        /** @} */
+
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t BATCH_ROWS = 1024;          /**< Rows per predicate evaluation. */
+        static constexpr size_t FILE_BATCH_ROWS = 65536;    /**< Records per file read. */
+        /** @} */
+
+    private:
+        Predicate where_;     /**< Row filter. */
+        unsigned columns_;    /**< Projected columns. */
+
+        void scan_(const EmployeeColumns& table, uint64_t row_base, QueryResult& result) const;
+
+    public:
+        /** @brief Constructs a query that matches everything and projects nothing. */
+        Query() noexcept;
+
+        /** @brief Sets the row filter. */
+        Query& where(Predicate predicate);
+
+        /** @brief Sets the projected columns (a combination of COLUMN_* flags). */
+        Query& select(unsigned columns) noexcept;
+
+        /** @brief Runs the query over an in-memory table. */
+        QueryResult run(const EmployeeColumns& table) const;
+
+        /**
+         * @brief Runs the query over an Employee file (versioned or legacy).
+         * @return The result, or std::nullopt if the file cannot be read.
+         */
+        std::optional<QueryResult> run(const File& file) const;
+    };
+} // namespace core::General
+
+#endif // QUERY_H
@@ -0,0 +1,114 @@
+/**
+ * @file RangeLock.h
+ * @brief RAII guard for shared and exclusive byte-range locks on a File.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef RANGE_LOCK_H
+#define RANGE_LOCK_H
+
+#include <cstdint>
+#include <optional>
+#include "EmployeeFile.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Access requested by a RangeLock. */
+    enum class LockMode
+    {
+        shared,      /**< Many readers; blocks writers. */
+        exclusive    /**< One writer; blocks everyone else. */
+    };
+
+    /**
+     * @class RangeLock
+     * @brief Holds a File::lockRange() lock and releases it on destruction.
+     *
+     * Processes that modify the same Employee file lock only the checksum
+     * blocks they touch, so writers to different blocks never wait for each
+     * other. Each process (or thread) that wants its own lock needs its own
+     * handle, because a handle does not conflict with itself. Windows locks
+     * are mandatory: other handles cannot read or write a locked range, so
+     * all I/O on the range, including EmployeeStore::flush(), must go
+     * through the handle that holds the lock.
+     *
+     * Move-only. The File must outlive the guard.
+     */
+    class RangeLock
+    {
+    private:
+        const File* file_;   /**< Locked file, nullptr once released. */
+        uint64_t offset_;    /**< First locked byte. */
+        uint64_t length_;    /**< Locked bytes. */
+        LockMode mode_;      /**< Mode the range was locked in. */
+
+        RangeLock(const File& file, uint64_t offset, uint64_t length, LockMode mode) noexcept;
+
+    public:
+        /** @brief Constructs a guard that holds nothing. */
+        RangeLock() noexcept;
+
+        RangeLock(const RangeLock&) = delete;
+        RangeLock& operator=(const RangeLock&) = delete;
+
+        /** @brief Takes over the lock held by @p other. */
+        RangeLock(RangeLock&& other) noexcept;
+
+        /** @brief Releases the current lock, then takes over the one held by @p other. */
+        RangeLock& operator=(RangeLock&& other) noexcept;
+
+        /** @brief Releases the lock. */
+        ~RangeLock() noexcept;
+
+        /**
+         * @brief Locks [offset, offset + length) of @p file.
+         * @param timeout_ms 0 to fail at once, INFINITE to wait, otherwise the longest wait.
+         * @return The guard, or std::nullopt if the range could not be locked in time.
+         */
+        static std::optional<RangeLock> acquire(const File& file, uint64_t offset, uint64_t length,
+                                                LockMode mode, DWORD timeout_ms = INFINITE) noexcept;
+
+        /** @brief Same as acquire() with a zero timeout. */
+        static std::optional<RangeLock> try_acquire(const File& file, uint64_t offset, uint64_t length,
+                                                    LockMode mode) noexcept;
+
+        /**
+         * @brief Locks the checksum blocks that hold records [first, first + count).
+         *
+         * A block's checksum covers all of its records, so two writers in
+         * one block must not overlap: the range is widened to whole blocks
+         * (legacy files have none and lock just the records). The offsets
+         * come from @p header, so they are right for both layouts.
+         *
+         * Protocol for EmployeeStore writers, each on its own handle: lock
+         * the records, update them, call flush() and only then release.
+         * flush() then reads blocks only this lock covers and writes only
+         * their own entries of the checksum table, so the table needs no
+         * lock of its own.
+         */
+        static std::optional<RangeLock> records(const File& file, const EmployeeFileHeader& header,
+                                                uint64_t first, uint64_t count,
+                                                LockMode mode, DWORD timeout_ms = INFINITE) noexcept;
+
+        /** @brief Releases the lock early. @return false if nothing was held or the unlock failed. */
+        bool release() noexcept;
+
+        /** @return true while the guard holds a lock. */
+        bool owns() const noexcept;
+
+        /** @name Locked Range
+         *  @{ */
+        uint64_t offset() const noexcept;   /**< @return First locked byte. */
+        uint64_t length() const noexcept;   /**< @return Locked bytes. */
+        LockMode mode() const noexcept;     /**< @return Lock mode. */
+        /** @} */
+    };
+} // namespace core::General
+
+#endif // RANGE_LOCK_H
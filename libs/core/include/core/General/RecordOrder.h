@@ -0,0 +1,106 @@
+/**
+ * @file RecordOrder.h
+ * @brief Sort keys and comparisons over serialized Employee records.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef RECORD_ORDER_H
+#define RECORD_ORDER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include "Employee.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Employee field that defines a sort order. */
+    enum class SortKey
+    {
+        id,     /**< Ascending Employee::id(). */
+        hours,  /**< Ascending Employee::hours(), NaNs ordered by sign. */
+        name    /**< Byte-wise ascending name buffer. */
+    };
+
+    /**
+     * @class RecordOrder
+     * @brief Orders serialized records without deserializing them.
+     *
+     * Every key is reduced to a 64-bit prefix whose unsigned order matches
+     * the field order. For id and hours the prefix is the whole key; for
+     * names it holds the first 8 bytes, and compare() resolves ties.
+     */
+    class RecordOrder
+    {
+    public:
+        /** @name Record Layout
+         *  Byte offsets of the fields inside a serialized record.
+         *  @{ */
+        static constexpr size_t OFFSET_ID = Employee::Schema::offset<Employee::FIELD_ID>();
+        static constexpr size_t OFFSET_HOURS = Employee::Schema::offset<Employee::FIELD_HOURS>();
+        static constexpr size_t OFFSET_NAME = Employee::Schema::offset<Employee::FIELD_NAME>();
+        /** @} */
+
+        /**
+         * @brief Maps a double onto an unsigned key with the same ordering.
+         *
+         * Negative values have all bits flipped and positive values only the
+         * sign bit, so integer comparison orders the keys like the doubles
+         * (with -0.0 before +0.0 and NaNs at the ends).
+         */
+        static uint64_t hours_key(double value) noexcept
+        {
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            const uint64_t SIGN = 1ull << 63;
+            return (bits & SIGN) ? ~bits : (bits | SIGN);
+        }
+
+        /** @return The first 8 name bytes packed big-endian, so they compare like memcmp. */
+        static uint64_t name_prefix(const char* name) noexcept
+        {
+            uint64_t key = 0;
+            for(size_t i = 0; i < sizeof(uint64_t); i++)
+                key = (key << 8) | static_cast<unsigned char>(name[i]);
+            return key;
+        }
+
+        /** @return The order-preserving prefix of @p record under @p key. */
+        static uint64_t prefix(const char* record, SortKey key) noexcept
+        {
+            switch(key)
+            {
+            case SortKey::id:
+                return Employee::Schema::read<Employee::FIELD_ID>(record);
+            case SortKey::hours:
+                return hours_key(Employee::Schema::read<Employee::FIELD_HOURS>(record));
+            default:
+                return name_prefix(record + OFFSET_NAME);
+            }
+        }
+
+        /** @return true if the prefix alone decides the order for @p key. */
+        static constexpr bool prefix_is_exact(SortKey key) noexcept
+        {
+            return SortKey::name != key;
+        }
+
+        /** @return Negative, zero or positive like memcmp, comparing two records by @p key. */
+        static int compare(const char* a, const char* b, SortKey key) noexcept
+        {
+            if(prefix_is_exact(key))
+            {
+                uint64_t ka = prefix(a, key), kb = prefix(b, key);
+                return (ka < kb) ? -1 : (kb < ka ? 1 : 0);
+            }
+            return memcmp(a + OFFSET_NAME, b + OFFSET_NAME, Employee::BUFF_SIZE);
+        }
+    };
+} // namespace core::General
+
+#endif // RECORD_ORDER_H
@@ -0,0 +1,153 @@
+/**
+ * @file RecordSchema.h
+ * @brief Compile-time description of fixed-size binary record layouts.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef RECORD_SCHEMA_H
+#define RECORD_SCHEMA_H
+
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @struct Field
+     * @brief One record field: @p N consecutive values of trivially copyable type @p T.
+     */
+    template <class T, size_t N = 1>
+    struct Field
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Record fields must be trivially copyable");
+        static_assert(0 < N, "Record fields must not be empty");
+
+        typedef T type;                                  /**< Element type. */
+        static constexpr size_t COUNT = N;               /**< Number of elements. */
+        static constexpr size_t SIZE = sizeof(T) * N;    /**< Encoded size in bytes. */
+    };
+
+    /**
+     * @class RecordSchema
+     * @brief Packed, unpadded layout generated from a list of Field types.
+     *
+     * Offsets and the total size are compile-time constants, so every
+     * accessor reduces to a memcpy at a fixed offset that the compiler
+     * inlines into a plain (possibly unaligned) load or store. Fields are
+     * stored in declaration order using the host representation.
+     *
+     * @code
+     * typedef RecordSchema<Field<uint16_t>, Field<double>, Field<char, 15>> Schema;
+     * static_assert(Schema::SIZE == 25);
+     * double h = Schema::read<1>(record);
+     * @endcode
+     */
+    template <class... Fields>
+    class RecordSchema
+    {
+    private:
+        static constexpr std::array<size_t, sizeof...(Fields)> SIZES = { { Fields::SIZE... } };
+
+        template <size_t... I, class... Ptrs>
+        static void encode_(char* out, std::index_sequence<I...>, const Ptrs*... src) noexcept
+        {
+            (memcpy(out + offset<I>(), src, field<I>::SIZE), ...);
+        }
+
+        template <size_t... I, class... Ptrs>
+        static void decode_(const char* in, std::index_sequence<I...>, Ptrs*... dst) noexcept
+        {
+            (memcpy(dst, in + offset<I>(), field<I>::SIZE), ...);
+        }
+
+    public:
+        /** @brief Field descriptor at position @p I. */
+        template <size_t I>
+        using field = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+        /** @brief Element type of the field at position @p I. */
+        template <size_t I>
+        using value_type = typename field<I>::type;
+
+        static constexpr size_t FIELD_COUNT = sizeof...(Fields);   /**< Number of fields. */
+        static constexpr size_t SIZE = (Fields::SIZE + ... + 0);   /**< Encoded record size in bytes. */
+
+        /** @return Byte offset of field @p I inside a record. */
+        template <size_t I>
+        static constexpr size_t offset() noexcept
+        {
+            static_assert(I < FIELD_COUNT, "Field index out of range");
+            size_t o = 0;
+            for(size_t i = 0; i < I; i++)
+                o += SIZES[i];
+            return o;
+        }
+
+        /** @brief Reads the scalar field @p I of @p record. */
+        template <size_t I>
+        static value_type<I> read(const char* record) noexcept
+        {
+            static_assert(1 == field<I>::COUNT, "Use read_to() for array fields");
+            value_type<I> v;
+            memcpy(&v, record + offset<I>(), sizeof(v));
+            return v;
+        }
+
+        /** @brief Copies field @p I of @p record into @p dst (field<I>::COUNT elements). */
+        template <size_t I>
+        static void read_to(const char* record, value_type<I>* dst) noexcept
+        {
+            memcpy(dst, record + offset<I>(), field<I>::SIZE);
+        }
+
+        /** @brief Writes the scalar field @p I of @p record. */
+        template <size_t I>
+        static void write(char* record, const value_type<I>& v) noexcept
+        {
+            static_assert(1 == field<I>::COUNT, "Use write_from() for array fields");
+            memcpy(record + offset<I>(), &v, sizeof(v));
+        }
+
+        /** @brief Copies field<I>::COUNT elements from @p src into field @p I of @p record. */
+        template <size_t I>
+        static void write_from(char* record, const value_type<I>* src) noexcept
+        {
+            memcpy(record + offset<I>(), src, field<I>::SIZE);
+        }
+
+        /**
+         * @brief Encodes a whole record, one source pointer per field in order.
+         * @param out Destination of SIZE bytes.
+         */
+        template <class... Ptrs>
+        static void encode(char* out, const Ptrs*... src) noexcept
+        {
+            static_assert(sizeof...(Ptrs) == FIELD_COUNT, "Exactly one source per field");
+            static_assert((std::is_same<Ptrs, typename Fields::type>::value && ...), "Source types must match the fields");
+            encode_(out, std::index_sequence_for<Fields...>(), src...);
+        }
+
+        /**
+         * @brief Decodes a whole record, one destination pointer per field in order.
+         * @param in Source of SIZE bytes.
+         */
+        template <class... Ptrs>
+        static void decode(const char* in, Ptrs*... dst) noexcept
+        {
+            static_assert(sizeof...(Ptrs) == FIELD_COUNT, "Exactly one destination per field");
+            static_assert((std::is_same<Ptrs, typename Fields::type>::value && ...), "Destination types must match the fields");
+            decode_(in, std::index_sequence_for<Fields...>(), dst...);
+        }
+    };
+} // namespace core::General
+
+#endif // RECORD_SCHEMA_H
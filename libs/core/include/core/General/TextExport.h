@@ -0,0 +1,75 @@
+/**
+ * @file TextExport.h
+ * @brief Parallel binary Employee record to CSV/TSV/JSON-lines export.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef TEXT_EXPORT_H
+#define TEXT_EXPORT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include "File.h"
+#include "TextFormat.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Tuning knobs for TextExport::run(). */
+    struct TextExportOptions
+    {
+        TextFormat format = TextFormat::csv;  /**< Output layout. */
+        bool write_header = false;            /**< Emit "id,name,hours" first (csv and tsv only). */
+        size_t threads = 0;                   /**< Formatter threads; 0 means one per logical processor. */
+        size_t chunk_records = 65536;         /**< Records formatted by one thread per round. */
+    };
+
+    /**
+     * @class TextExport
+     * @brief Formats Employee records as text lines.
+     *
+     * Every round, each thread reads its own contiguous range of records and
+     * formats it with std::to_chars into a private buffer; the buffers are
+     * then written in input order through one BufferedWriter, so the output
+     * is byte-identical to a single-threaded run.
+     *
+     * Hours use the shortest representation that parses back to the same
+     * double. CSV quotes names that contain a delimiter or quote; TSV cannot
+     * escape, so tabs in names become spaces. TextImport reads one record
+     * per line, so both formats also turn line breaks in names into spaces.
+     * An export followed by TextImport therefore reproduces the records,
+     * except that those characters come back as spaces. JSON strings escape
+     * quotes, backslashes and control characters, other bytes are copied
+     * as-is, and non-finite hours are written as null.
+     */
+    class TextExport
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t MAX_LINE = 192;            /**< Upper bound of one formatted line. */
+        static constexpr size_t MIN_CHUNK_RECORDS = 1024;  /**< Smallest accepted chunk. */
+        /** @} */
+
+        /**
+         * @brief Exports the Employee file @p input (versioned or legacy) to @p output.
+         * @return Number of records written, or std::nullopt on failure.
+         */
+        static std::optional<uint64_t> run(const File& input, const File& output,
+                                           const TextExportOptions& options = {});
+
+        /**
+         * @brief Formats one serialized record as a line ending in '\n'.
+         * @param out Destination of at least MAX_LINE bytes.
+         * @return Number of bytes written.
+         */
+        static size_t format_record(const char* record, TextFormat format, char* out) noexcept;
+    };
+} // namespace core::General
+
+#endif // TEXT_EXPORT_H
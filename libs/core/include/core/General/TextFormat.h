@@ -0,0 +1,34 @@
+/**
+ * @file TextFormat.h
+ * @brief Delimited text formats used to exchange Employee records.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef TEXT_FORMAT_H
+#define TEXT_FORMAT_H
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /**
+     * @brief Text layout of one Employee per line: id, name, hours.
+     *
+     * Lines end with '\n'; a preceding '\r' is accepted on input.
+     */
+    enum class TextFormat
+    {
+        csv,   /**< Comma-separated; names may be double-quoted, with "" as an escaped quote. */
+        tsv,   /**< Tab-separated; names are never quoted. */
+        jsonl  /**< One JSON object per line: {"id":..,"name":"..","hours":..}. Export only. */
+    };
+
+    /** @return Field separator of @p format. */
+    constexpr char text_delimiter(TextFormat format) noexcept
+    { return TextFormat::tsv == format ? '\t' : ','; }
+} // namespace core::General
+
+#endif // TEXT_FORMAT_H
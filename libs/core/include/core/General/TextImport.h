@@ -0,0 +1,96 @@
+/**
+ * @file TextImport.h
+ * @brief Parallel CSV/TSV to binary Employee record import.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef TEXT_IMPORT_H
+#define TEXT_IMPORT_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "File.h"
+#include "TextFormat.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief Tuning knobs for TextImport::run(). */
+    struct TextImportOptions
+    {
+        TextFormat format = TextFormat::csv;  /**< Input layout: csv or tsv. */
+        bool skip_header = false;             /**< Ignore the first line. */
+        bool headerless_output = false;       /**< Write bare records instead of a versioned EmployeeFile. */
+        size_t threads = 0;                   /**< Parser threads; 0 means one per logical processor. */
+        size_t chunk_size = 4u << 20;         /**< Bytes of input parsed by one thread per round. */
+    };
+
+    /** @brief Counters reported by an import. */
+    struct TextImportResult
+    {
+        uint64_t lines = 0;            /**< Lines seen, including blank and rejected ones. */
+        uint64_t records = 0;          /**< Records written. */
+        uint64_t bad_lines = 0;        /**< Lines that could not be parsed. */
+        uint64_t first_bad_line = 0;   /**< 1-based number of the first bad line, or 0. */
+    };
+
+    /**
+     * @class TextImport
+     * @brief Parses "id,name,hours" lines into Employee records.
+     *
+     * Input is read in large rounds. Each round is cut after its last
+     * newline and split into per-thread slices on newline boundaries; the
+     * threads parse their slices into private record buffers, which are then
+     * appended to the output in input order. Delimiters are located with
+     * memchr and numbers are converted with std::from_chars, so a line is
+     * never copied or tokenized into temporaries.
+     *
+     * A line is rejected if the id is not an integer in
+     * [Employee::ID_MIN, Employee::ID_MAX], the name is longer than
+     * Employee::BUFF_SIZE, the hours value is not a number, or there are
+     * extra fields. Blank lines are skipped.
+     */
+    class TextImport
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t MIN_CHUNK_SIZE = 64u << 10;   /**< Smallest accepted chunk size. */
+        /** @} */
+
+        /**
+         * @brief Imports the text file @p input into @p output.
+         * @param input Readable text file.
+         * @param output Writable, empty destination file.
+         * @return The counters, or std::nullopt if reading or writing failed
+         *         or @p options asks for an export-only format.
+         */
+        static std::optional<TextImportResult> run(const File& input, const File& output,
+                                                   const TextImportOptions& options = {});
+
+        /**
+         * @brief Parses one line into a serialized record.
+         * @param begin First character of the line.
+         * @param end One past the last character, excluding '\n'.
+         * @param format Input layout.
+         * @param record Destination of Employee::SERIALIZED_SIZE bytes.
+         * @return false if the line is malformed; @p record is then unspecified.
+         */
+        static bool parse_line(const char* begin, const char* end, TextFormat format, char* record) noexcept;
+
+        /**
+         * @brief Parses every line of [begin, end) and appends the records to @p records.
+         * @param result Line and error counters to update; first_bad_line is relative to @p begin.
+         */
+        static void parse(const char* begin, const char* end, TextFormat format,
+                          std::vector<char>& records, TextImportResult& result);
+    };
+} // namespace core::General
+
+#endif // TEXT_IMPORT_H
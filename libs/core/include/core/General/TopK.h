@@ -0,0 +1,79 @@
+/**
+ * @file TopK.h
+ * @brief Parallel top-K selection of Employee records by hours.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <cstdint>
+#include <cstddef>
+#include <optional>
+#include <vector>
+#include "Employee.h"
+#include "EmployeeColumns.h"
+#include "File.h"
+
+/**
+ * @namespace core::General
+ * @brief Main namespace for general-purpose core utilities.
+ */
+namespace core::General
+{
+    /** @brief One selected record and its position in the input. */
+    struct TopKEntry
+    {
+        uint64_t row;         /**< Row in the table or record index in the file. */
+        Employee employee;    /**< The record. */
+    };
+
+    /** @brief Options for TopK::by_hours(). */
+    struct TopKOptions
+    {
+        size_t threads = 0;       /**< Worker threads; 0 means one per logical processor. */
+        bool map_file = true;     /**< Scan native-layout files through a memory mapping. */
+    };
+
+    /**
+     * @class TopK
+     * @brief Selects the K records with the most hours without sorting the input.
+     *
+     * The input is split into one contiguous range per thread. Every thread
+     * keeps a bounded min-heap of its K best rows. Once a heap is full, its
+     * minimum is a lower bound for the global answer. That bound is
+     * published through a shared atomic and re-read once per batch, so every
+     * thread can reject most rows with a single comparison. The heaps are
+     * merged at the end.
+     *
+     * Native-layout files are scanned through a read-only mapping, reading
+     * only the hours field of each record in place. Other files are read in
+     * batches through EmployeeFileReader.
+     *
+     * Rows whose hours are NaN are never selected. The result is ordered by
+     * hours descending, and ties go to the lower row.
+     */
+    class TopK
+    {
+    public:
+        /** @name Constants
+         *  @{ */
+        static constexpr size_t BATCH_ROWS = 65536;            /**< Rows between threshold refreshes; records per read. */
+        static constexpr size_t MIN_ROWS_PER_THREAD = 65536;   /**< Smaller inputs use fewer threads. */
+        /** @} */
+
+        /** @return Up to @p k rows of @p table with the most hours. */
+        static std::vector<TopKEntry> by_hours(const EmployeeColumns& table, size_t k,
+                                               const TopKOptions& opts = TopKOptions());
+
+        /**
+         * @brief Selects from an Employee file (versioned or legacy).
+         * @return Up to @p k records, or std::nullopt if the file cannot be read.
+         */
+        static std::optional<std::vector<TopKEntry>> by_hours(const File& file, size_t k,
+                                                              const TopKOptions& opts = TopKOptions());
+    };
+} // namespace core::General
+
+#endif // TOP_K_H
@@ -0,0 +1,53 @@
+/**
+ * @file AlignedEmployee.cpp
+ * @brief Conversions between the compact and the aligned Employee record layouts.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/AlignedEmployee.h>
+#include <cstring>
+
+namespace core::General
+{
+    AlignedEmployee AlignedEmployee::from_record(const char* record) noexcept
+    {
+        AlignedEmployee a = {};
+        Employee::Schema::decode(record, &a.id, &a.hours, a.name);
+        return a;
+    }
+
+    AlignedEmployee AlignedEmployee::from_employee(const Employee& e) noexcept
+    {
+        AlignedEmployee a = {};
+        a.hours = e.hours();
+        a.id = e.id();
+        memcpy(a.name, e.name(), Employee::BUFF_SIZE);
+        return a;
+    }
+
+    void AlignedEmployee::to_record(char* record) const noexcept
+    {
+        Employee::Schema::encode(record, &id, &hours, name);
+    }
+
+    Employee AlignedEmployee::employee() const
+    {
+        char record[Employee::SERIALIZED_SIZE];
+        to_record(record);
+        return Employee::deserialize(record);
+    }
+
+    void AlignedEmployee::from_records(const char* records, size_t n, AlignedEmployee* out) noexcept
+    {
+        for(size_t i = 0; i < n; i++, records += Employee::SERIALIZED_SIZE)
+            out[i] = from_record(records);
+    }
+
+    void AlignedEmployee::to_records(const AlignedEmployee* in, size_t n, char* out) noexcept
+    {
+        for(size_t i = 0; i < n; i++, out += Employee::SERIALIZED_SIZE)
+            in[i].to_record(out);
+    }
+
+} // namespace core::General
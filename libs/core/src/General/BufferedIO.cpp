@@ -0,0 +1,179 @@
+/**
+ * @file BufferedIO.cpp
+ * @brief Implementation of the buffered sequential reader and writer.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/BufferedIO.h>
+#include <algorithm>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        // A single ReadFile/WriteFile call moves at most a DWORD worth of bytes
+        constexpr size_t MAX_IO_CHUNK = 1u << 30;
+    }
+
+    // --- BufferedReader ---
+
+    BufferedReader::BufferedReader(const File& file, uint64_t begin, uint64_t end, size_t buffer_size)
+        : file_(&file), next_(begin), end_(std::max(begin, end)),
+          buf_(std::max<size_t>(buffer_size, 1)), head_(0), tail_(0), ok_(true)
+    {
+    }
+
+    const char* BufferedReader::peek(size_t n) noexcept
+    {
+        if(tail_ - head_ >= n)
+            return buf_.data() + head_;
+        if(!ok_ || n > buf_.size() || remaining() < n)
+            return nullptr;
+
+        // Slide the unread tail to the front, then top the buffer up
+        size_t left = tail_ - head_;
+        memmove(buf_.data(), buf_.data() + head_, left);
+        head_ = 0;
+        tail_ = left;
+
+        size_t want = static_cast<size_t>(std::min<uint64_t>(buf_.size() - tail_, end_ - next_));
+        if(!file_->readAt(buf_.data() + tail_, static_cast<DWORD>(want), next_))
+        {
+            ok_ = false;
+            return nullptr;
+        }
+        next_ += want;
+        tail_ += want;
+        return buf_.data();
+    }
+
+    void BufferedReader::skip(size_t n) noexcept
+    {
+        head_ += std::min(n, tail_ - head_);
+    }
+
+    bool BufferedReader::read(char* dst, size_t n) noexcept
+    {
+        // Serve what is buffered, then go straight to the file for the rest
+        size_t buffered = std::min(n, tail_ - head_);
+        memcpy(dst, buf_.data() + head_, buffered);
+        head_ += buffered;
+        dst += buffered;
+        n -= buffered;
+
+        if(0 == n) return true;
+        if(!ok_ || end_ - next_ < n) return false;
+        if(n < buf_.size())
+        {
+            const char* p = peek(n);
+            if(nullptr == p) return false;
+            memcpy(dst, p, n);
+            skip(n);
+            return true;
+        }
+
+        while(0 < n)
+        {
+            size_t chunk = std::min(n, MAX_IO_CHUNK);
+            if(!file_->readAt(dst, static_cast<DWORD>(chunk), next_))
+                return ok_ = false;
+            next_ += chunk;
+            dst += chunk;
+            n -= chunk;
+        }
+        return true;
+    }
+
+    uint64_t BufferedReader::remaining() const noexcept
+    {
+        return (end_ - next_) + (tail_ - head_);
+    }
+
+    bool BufferedReader::good() const noexcept
+    { return ok_; }
+
+    // --- BufferedWriter ---
+
+    BufferedWriter::BufferedWriter(const File& file, uint64_t offset, size_t buffer_size)
+        : file_(&file), offset_(offset), buf_(std::max<size_t>(buffer_size, 1)), used_(0), ok_(true)
+    {
+    }
+
+    BufferedWriter::BufferedWriter(BufferedWriter&& other) noexcept
+        : file_(other.file_), offset_(other.offset_), buf_(std::move(other.buf_)),
+          used_(other.used_), ok_(other.ok_)
+    {
+        other.used_ = 0;
+        other.ok_ = false;
+    }
+
+    BufferedWriter::~BufferedWriter() noexcept
+    {
+        flush();
+    }
+
+    bool BufferedWriter::write(const char* src, size_t n) noexcept
+    {
+        if(!ok_) return false;
+
+        if(used_ + n <= buf_.size())
+        {
+            memcpy(buf_.data() + used_, src, n);
+            used_ += n;
+            return true;
+        }
+
+        if(!flush()) return false;
+
+        // Blocks at least as large as the buffer are written through unchanged
+        if(n >= buf_.size())
+        {
+            while(0 < n)
+            {
+                size_t chunk = std::min(n, MAX_IO_CHUNK);
+                if(!file_->writeAt(src, static_cast<DWORD>(chunk), offset_))
+                    return ok_ = false;
+                offset_ += chunk;
+                src += chunk;
+                n -= chunk;
+            }
+            return true;
+        }
+
+        memcpy(buf_.data(), src, n);
+        used_ = n;
+        return true;
+    }
+
+    char* BufferedWriter::reserve(size_t n) noexcept
+    {
+        if(!ok_ || n > buf_.size()) return nullptr;
+        if(used_ + n > buf_.size() && !flush())
+            return nullptr;
+
+        char* p = buf_.data() + used_;
+        used_ += n;
+        return p;
+    }
+
+    bool BufferedWriter::flush() noexcept
+    {
+        if(0 == used_) return ok_;
+        if(ok_)
+        {
+            ok_ = file_->writeAt(buf_.data(), static_cast<DWORD>(used_), offset_);
+            offset_ += used_;
+        }
+        used_ = 0;
+        return ok_;
+    }
+
+    uint64_t BufferedWriter::offset() const noexcept
+    { return offset_ + used_; }
+
+    bool BufferedWriter::good() const noexcept
+    { return ok_; }
+
+} // namespace core::General
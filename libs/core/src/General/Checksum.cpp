@@ -0,0 +1,93 @@
+/**
+ * @file Checksum.cpp
+ * @brief Implementation of CRC-32C with a hardware and a table-driven path.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/Checksum.h>
+#include <cstring>
+
+#if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+#include <nmmintrin.h>
+#define CORE_HAS_CRC32_INSTRUCTION 1
+#if defined(_M_X64) || defined(__x86_64__)
+#define CORE_HAS_CRC32_U64 1   // The 64-bit form only exists in x64 code
+#endif
+#endif
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr uint32_t POLY = 0x82F63B78u; // Reflected Castagnoli polynomial
+
+#ifndef CORE_HAS_CRC32_INSTRUCTION
+        /** @brief Slice-by-8 lookup tables, built once on first use. */
+        struct Tables
+        {
+            uint32_t t[8][256];
+
+            Tables() noexcept
+            {
+                for(uint32_t i = 0; i < 256; i++)
+                {
+                    uint32_t c = i;
+                    for(int k = 0; k < 8; k++)
+                        c = (c & 1) ? (c >> 1) ^ POLY : (c >> 1);
+                    t[0][i] = c;
+                }
+                for(uint32_t i = 0; i < 256; i++)
+                    for(int s = 1; s < 8; s++)
+                        t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+            }
+        };
+
+        const Tables& tables() noexcept
+        {
+            static const Tables instance;
+            return instance;
+        }
+#endif
+    } // namespace
+
+    uint32_t Checksum::crc32c(const void* data, size_t size, uint32_t crc) noexcept
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        crc = ~crc;
+
+#if defined(CORE_HAS_CRC32_U64)
+        for(; size >= 8; size -= 8, p += 8)
+        {
+            uint64_t v;
+            memcpy(&v, p, sizeof(v));
+            crc = static_cast<uint32_t>(_mm_crc32_u64(crc, v));
+        }
+        for(; size; --size, ++p)
+            crc = _mm_crc32_u8(crc, *p);
+#elif defined(CORE_HAS_CRC32_INSTRUCTION)
+        for(; size >= 4; size -= 4, p += 4)
+        {
+            uint32_t v;
+            memcpy(&v, p, sizeof(v));
+            crc = _mm_crc32_u32(crc, v);
+        }
+        for(; size; --size, ++p)
+            crc = _mm_crc32_u8(crc, *p);
+#else
+        const Tables& tb = tables();
+        for(; size >= 8; size -= 8, p += 8)
+        {
+            // Little-endian word load; the table layout assumes byte 0 is lowest
+            uint32_t lo = crc ^ (uint32_t(p[0]) | uint32_t(p[1]) << 8 | uint32_t(p[2]) << 16 | uint32_t(p[3]) << 24);
+            uint32_t hi = uint32_t(p[4]) | uint32_t(p[5]) << 8 | uint32_t(p[6]) << 16 | uint32_t(p[7]) << 24;
+            crc = tb.t[7][lo & 0xFF] ^ tb.t[6][(lo >> 8) & 0xFF] ^ tb.t[5][(lo >> 16) & 0xFF] ^ tb.t[4][lo >> 24]
+                ^ tb.t[3][hi & 0xFF] ^ tb.t[2][(hi >> 8) & 0xFF] ^ tb.t[1][(hi >> 16) & 0xFF] ^ tb.t[0][hi >> 24];
+        }
+        for(; size; --size, ++p)
+            crc = (crc >> 8) ^ tb.t[0][(crc ^ *p) & 0xFF];
+#endif
+        return ~crc;
+    }
+
+} // namespace core::General
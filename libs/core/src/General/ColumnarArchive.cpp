@@ -0,0 +1,571 @@
+/**
+ * @file ColumnarArchive.cpp
+ * @brief Implementation of the compressed columnar archive.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/ColumnarArchive.h>
+#include <core/General/Bits.h>
+#include <core/General/Checksum.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace core::General
+{
+    namespace
+    {
+        typedef EmployeeColumns::Name Name;
+
+        /** @brief Fixed-size archive header stored at offset 0. */
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t block_rows;
+            uint32_t directory_crc;     /**< CRC-32C of the whole block directory. */
+            uint64_t rows;
+            uint64_t block_count;
+            uint64_t directory_offset;
+        };
+
+        constexpr size_t HEADER_SIZE = sizeof(Header);
+        static_assert(40 == sizeof(Header), "Header must have no padding");
+        static_assert(40 == sizeof(ColumnarArchive::BlockInfo), "BlockInfo must have no padding");
+
+        /** @brief Hours encodings. */
+        enum HoursMode : uint8_t { HOURS_RAW = 0, HOURS_XOR = 1 };
+
+        inline uint64_t low_mask(unsigned n) noexcept
+        { return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1; }
+
+        /** @brief Appends little-endian bit fields to a byte vector. */
+        class BitWriter
+        {
+        private:
+            std::vector<char>& out_;
+            uint64_t acc_ = 0;
+            unsigned used_ = 0;
+
+            void emit_(uint64_t word, unsigned bytes)
+            {
+                for(unsigned i = 0; i < bytes; i++)
+                    out_.push_back(static_cast<char>(word >> (8 * i)));
+            }
+
+        public:
+            explicit BitWriter(std::vector<char>& out) noexcept : out_(out) {}
+
+            /** @brief Appends the low @p n bits of @p v (n <= 64). */
+            void put(uint64_t v, unsigned n)
+            {
+                if(0 == n) return;
+                v &= low_mask(n);
+                acc_ |= v << used_;
+                unsigned total = used_ + n;
+                if(total >= 64)
+                {
+                    emit_(acc_, 8);
+                    acc_ = 0 == used_ ? 0 : v >> (64 - used_);
+                    total -= 64;
+                }
+                used_ = total;
+            }
+
+            /** @brief Pads to a byte boundary and flushes pending bits. */
+            void align()
+            {
+                emit_(acc_, (used_ + 7) / 8);
+                acc_ = 0;
+                used_ = 0;
+            }
+        };
+
+        /** @brief Reads little-endian bit fields written by BitWriter. */
+        class BitReader
+        {
+        private:
+            const unsigned char* data_;
+            size_t size_;
+            uint64_t pos_ = 0;   // In bits
+
+            uint64_t load_(size_t byte) const noexcept
+            {
+                uint64_t w = 0;
+                size_t n = byte < size_ ? std::min<size_t>(8, size_ - byte) : 0;
+                for(size_t i = 0; i < n; i++)
+                    w |= uint64_t(data_[byte + i]) << (8 * i);
+                return w;
+            }
+
+        public:
+            BitReader(const char* data, size_t size) noexcept
+                : data_(reinterpret_cast<const unsigned char*>(data)), size_(size) {}
+
+            /** @brief Reads @p n bits (n <= 64). Reads past the end yield zeros and clear ok(). */
+            uint64_t get(unsigned n) noexcept
+            {
+                if(0 == n) return 0;
+                if(n > 56)
+                {
+                    uint64_t lo = get(32);
+                    return lo | (get(n - 32) << 32);
+                }
+                uint64_t w = load_(static_cast<size_t>(pos_ >> 3)) >> (pos_ & 7);
+                pos_ += n;
+                return w & low_mask(n);
+            }
+
+            /** @brief Skips to the next byte boundary. */
+            void align() noexcept { pos_ = (pos_ + 7) & ~uint64_t(7); }
+
+            /** @return Current position in bytes; valid after align(). */
+            size_t byte_offset() const noexcept { return static_cast<size_t>(pos_ >> 3); }
+
+            /** @brief Moves to byte @p offset. */
+            void seek(size_t offset) noexcept { pos_ = uint64_t(offset) * 8; }
+
+            /** @return true if no read went past the end. */
+            bool ok() const noexcept { return pos_ <= uint64_t(size_) * 8; }
+        };
+
+        struct NameHash
+        {
+            size_t operator()(const Name& n) const noexcept
+            {
+                uint64_t h = 1469598103934665603ull;   // FNV-1a
+                for(char c : n)
+                    h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+                return static_cast<size_t>(h);
+            }
+        };
+
+        inline uint64_t double_bits(double d) noexcept
+        {
+            uint64_t b;
+            memcpy(&b, &d, sizeof(b));
+            return b;
+        }
+
+        inline double bits_double(uint64_t b) noexcept
+        {
+            double d;
+            memcpy(&d, &b, sizeof(d));
+            return d;
+        }
+
+        // --- Column encoders; every column starts on a byte boundary ---
+
+        void encode_ids(const Employee::ID_TYPE* ids, size_t n, BitWriter& w)
+        {
+            uint32_t widest = 0;
+            for(size_t i = 1; i < n; i++)
+            {
+                int32_t d = int32_t(ids[i]) - int32_t(ids[i - 1]);
+                widest |= (uint32_t(d) << 1) ^ uint32_t(d >> 31);
+            }
+            unsigned width = Bits::width(widest);
+            w.put(ids[0], 8 * sizeof(Employee::ID_TYPE));
+            w.put(width, 8);
+            for(size_t i = 1; i < n; i++)
+            {
+                int32_t d = int32_t(ids[i]) - int32_t(ids[i - 1]);
+                w.put((uint32_t(d) << 1) ^ uint32_t(d >> 31), width);
+            }
+            w.align();
+        }
+
+        void decode_ids(BitReader& r, size_t n, Employee::ID_TYPE* ids)
+        {
+            ids[0] = static_cast<Employee::ID_TYPE>(r.get(8 * sizeof(Employee::ID_TYPE)));
+            unsigned width = static_cast<unsigned>(r.get(8));
+            for(size_t i = 1; i < n; i++)
+            {
+                uint32_t z = static_cast<uint32_t>(r.get(width));
+                int32_t d = int32_t(z >> 1) ^ -int32_t(z & 1);
+                ids[i] = static_cast<Employee::ID_TYPE>(int32_t(ids[i - 1]) + d);
+            }
+            r.align();
+        }
+
+        void encode_names(const Name* names, size_t n, std::vector<char>& out)
+        {
+            std::unordered_map<Name, uint32_t, NameHash> dict;
+            std::vector<uint32_t> codes(n);
+            std::vector<const Name*> entries;
+            for(size_t i = 0; i < n; i++)
+            {
+                auto it = dict.emplace(names[i], static_cast<uint32_t>(entries.size())).first;
+                if(it->second == entries.size())
+                    entries.push_back(&names[i]);
+                codes[i] = it->second;
+            }
+
+            BitWriter w(out);
+            w.put(entries.size(), 32);
+            w.align();
+            for(const Name* e : entries)
+                out.insert(out.end(), e->begin(), e->end());
+
+            unsigned width = Bits::width(entries.size() - 1);
+            w.put(width, 8);
+            for(uint32_t c : codes)
+                w.put(c, width);
+            w.align();
+        }
+
+        bool decode_names(BitReader& r, const char* block, size_t size, size_t n, Name* names)
+        {
+            uint32_t entries = static_cast<uint32_t>(r.get(32));
+            size_t dict_at = r.byte_offset();
+            if(0 == entries || entries > n || dict_at + size_t(entries) * Employee::BUFF_SIZE > size)
+                return false;
+            r.seek(dict_at + size_t(entries) * Employee::BUFF_SIZE);
+
+            unsigned width = static_cast<unsigned>(r.get(8));
+            for(size_t i = 0; i < n; i++)
+            {
+                uint32_t c = static_cast<uint32_t>(r.get(width));
+                if(c >= entries) return false;
+                memcpy(names[i].data(), block + dict_at + size_t(c) * Employee::BUFF_SIZE, Employee::BUFF_SIZE);
+            }
+            r.align();
+            return true;
+        }
+
+        /**
+         * @brief Gorilla XOR encoding: each value is XORed with its predecessor and
+         *        only the meaningful bits of the result are stored.
+         *
+         * Control codes: 0 = same value; 10 = meaningful bits fit the previous
+         * window; 11 = new window (5 bits leading zeros, 6 bits length - 1).
+         */
+        void encode_hours_xor(const double* hours, size_t n, BitWriter& w)
+        {
+            uint64_t prev = double_bits(hours[0]);
+            w.put(prev, 64);
+            unsigned lead = 64, trail = 0;   // No window yet
+            for(size_t i = 1; i < n; i++)
+            {
+                uint64_t cur = double_bits(hours[i]);
+                uint64_t x = cur ^ prev;
+                prev = cur;
+                if(0 == x)
+                {
+                    w.put(0, 1);
+                    continue;
+                }
+                unsigned l = std::min(Bits::leading_zeros(x), 31u);
+                unsigned t = Bits::trailing_zeros(x);
+                if(lead <= l && trail <= t)
+                {
+                    w.put(0b01, 2);
+                    w.put(x >> trail, 64 - lead - trail);
+                }
+                else
+                {
+                    lead = l;
+                    trail = t;
+                    unsigned len = 64 - lead - trail;
+                    w.put(0b11, 2);
+                    w.put(lead, 5);
+                    w.put(len - 1, 6);
+                    w.put(x >> trail, len);
+                }
+            }
+            w.align();
+        }
+
+        void decode_hours_xor(BitReader& r, size_t n, double* hours)
+        {
+            uint64_t prev = r.get(64);
+            hours[0] = bits_double(prev);
+            unsigned lead = 0, len = 0;
+            for(size_t i = 1; i < n; i++)
+            {
+                if(0 != r.get(1))
+                {
+                    if(0 != r.get(1))
+                    {
+                        lead = static_cast<unsigned>(r.get(5));
+                        len = static_cast<unsigned>(r.get(6)) + 1;
+                    }
+                    if(lead + len > 64)
+                        len = 64 - lead;   // Corrupt stream; the block checksum already failed
+                    prev ^= r.get(len) << (64 - lead - len);
+                }
+                hours[i] = bits_double(prev);
+            }
+            r.align();
+        }
+
+        /** @brief Encodes one block of rows [first, first + n) of @p t into @p out. */
+        void encode_block(const EmployeeColumns& t, size_t first, size_t n, std::vector<char>& out)
+        {
+            out.clear();
+            BitWriter w(out);
+            encode_ids(t.ids().data() + first, n, w);
+            encode_names(t.names().data() + first, n, out);
+
+            size_t hours_at = out.size();
+            out.push_back(static_cast<char>(HOURS_XOR));
+            encode_hours_xor(t.hours().data() + first, n, w);
+            if(out.size() - hours_at - 1 >= n * sizeof(double))
+            {
+                // Noisy values: XOR coding made things bigger, store them raw
+                out.resize(hours_at);
+                out.push_back(static_cast<char>(HOURS_RAW));
+                const char* raw = reinterpret_cast<const char*>(t.hours().data() + first);
+                out.insert(out.end(), raw, raw + n * sizeof(double));
+            }
+        }
+
+        bool decode_block(const char* block, size_t size, size_t n, size_t at, EmployeeColumns& out)
+        {
+            BitReader r(block, size);
+            decode_ids(r, n, out.ids().data() + at);
+            if(!decode_names(r, block, size, n, out.names().data() + at))
+                return false;
+
+            size_t hours_at = r.byte_offset();
+            if(hours_at >= size)
+                return false;
+            double* hours = out.hours().data() + at;
+            if(HOURS_RAW == static_cast<uint8_t>(block[hours_at]))
+            {
+                if(hours_at + 1 + n * sizeof(double) != size)
+                    return false;
+                memcpy(hours, block + hours_at + 1, n * sizeof(double));
+                return true;
+            }
+            if(HOURS_XOR != static_cast<uint8_t>(block[hours_at]))
+                return false;
+            r.seek(hours_at + 1);
+            decode_hours_xor(r, n, hours);
+            return r.ok() && r.byte_offset() == size;
+        }
+    } // namespace
+
+    // --- ColumnarArchive ---
+
+    ColumnarArchive::ColumnarArchive() noexcept
+        : rows_(0)
+    {
+    }
+
+    std::optional<ColumnarArchive> ColumnarArchive::open(File&& file)
+    {
+        std::optional<uint64_t> size = file.getFileSize64();
+        Header h;
+        if(!size.has_value() || size.value() < HEADER_SIZE
+            || !file.readAt(reinterpret_cast<char*>(&h), HEADER_SIZE, 0))
+            return std::nullopt;
+
+        if(MAGIC != h.magic || VERSION != h.version || 0 == h.block_rows
+            || h.directory_offset < HEADER_SIZE || h.directory_offset > size.value()
+            || h.block_count > (size.value() - h.directory_offset) / sizeof(BlockInfo)
+            || h.directory_offset + h.block_count * sizeof(BlockInfo) != size.value())
+            return std::nullopt;
+
+        ColumnarArchive archive;
+        archive.blocks_.resize(static_cast<size_t>(h.block_count));
+        size_t bytes = archive.blocks_.size() * sizeof(BlockInfo);
+        if(0 != bytes && !file.readAt(reinterpret_cast<char*>(archive.blocks_.data()),
+                                      static_cast<DWORD>(bytes), h.directory_offset))
+            return std::nullopt;
+        if(h.directory_crc != Checksum::crc32c(archive.blocks_.data(), bytes))
+            return std::nullopt;
+
+        uint64_t rows = 0;
+        for(const BlockInfo& b : archive.blocks_)
+        {
+            if(0 == b.rows || b.rows > h.block_rows || b.offset < HEADER_SIZE
+                || b.offset + b.size > h.directory_offset)
+                return std::nullopt;
+            rows += b.rows;
+        }
+        if(rows != h.rows)
+            return std::nullopt;
+
+        archive.rows_ = rows;
+        archive.file_ = std::move(file);
+        return archive;
+    }
+
+    uint64_t ColumnarArchive::size() const noexcept
+    { return rows_; }
+
+    size_t ColumnarArchive::block_count() const noexcept
+    { return blocks_.size(); }
+
+    const ColumnarArchive::BlockInfo& ColumnarArchive::block(size_t b) const noexcept
+    { return blocks_[b]; }
+
+    bool ColumnarArchive::read_block(size_t b, EmployeeColumns& out) const
+    {
+        if(b >= blocks_.size())
+            return false;
+        const BlockInfo& info = blocks_[b];
+        std::vector<char> buf(info.size);
+        if(!file_.readAt(buf.data(), info.size, info.offset)
+            || info.crc != Checksum::crc32c(buf.data(), buf.size()))
+            return false;
+
+        size_t at = out.size();
+        out.resize(at + info.rows);
+        if(!decode_block(buf.data(), buf.size(), info.rows, at, out))
+        {
+            out.resize(at);
+            return false;
+        }
+        return true;
+    }
+
+    bool ColumnarArchive::read_all(EmployeeColumns& out) const
+    {
+        out.reserve(out.size() + static_cast<size_t>(rows_));
+        for(size_t b = 0; b < blocks_.size(); b++)
+            if(!read_block(b, out)) return false;
+        return true;
+    }
+
+    bool ColumnarArchive::scan_hours(double lo, double hi, EmployeeColumns& out, size_t* blocks_read) const
+    {
+        size_t decoded = 0;
+        for(size_t b = 0; b < blocks_.size(); b++)
+        {
+            const BlockInfo& info = blocks_[b];
+            if(!(info.hours_min <= hi && lo <= info.hours_max))
+                continue;
+
+            // Decode straight into the output, then compact the rows that match
+            size_t at = out.size();
+            if(!read_block(b, out))
+                return false;
+            decoded++;
+
+            size_t kept = at;
+            for(size_t i = at; i < out.size(); i++)
+            {
+                double h = out.hours()[i];
+                if(!(lo <= h && h <= hi)) continue;
+                if(kept != i)
+                {
+                    out.ids()[kept] = out.ids()[i];
+                    out.hours()[kept] = h;
+                    out.names()[kept] = out.names()[i];
+                }
+                kept++;
+            }
+            out.resize(kept);
+        }
+        if(nullptr != blocks_read)
+            *blocks_read = decoded;
+        return true;
+    }
+
+    // --- ColumnarArchiveWriter ---
+
+    ColumnarArchiveWriter::ColumnarArchiveWriter(const File& file, uint32_t block_rows)
+        : file_(&file), block_rows_(std::max<uint32_t>(block_rows, 1)), offset_(HEADER_SIZE),
+          rows_(0), ok_(file.is_opened()), finished_(false)
+    {
+        pending_.reserve(block_rows_);
+    }
+
+    bool ColumnarArchiveWriter::flush_block_()
+    {
+        size_t n = pending_.size();
+        if(0 == n)
+            return ok_;
+
+        ColumnarArchive::BlockInfo info = {};
+        const auto& ids = pending_.ids();
+        const auto& hours = pending_.hours();
+        auto id_range = std::minmax_element(ids.begin(), ids.end());
+        info.id_min = *id_range.first;
+        info.id_max = *id_range.second;
+        info.hours_min = std::numeric_limits<double>::infinity();
+        info.hours_max = -std::numeric_limits<double>::infinity();
+        for(double h : hours)
+        {
+            // Comparisons with NaN are false, so NaN never widens the range
+            if(h < info.hours_min) info.hours_min = h;
+            if(h > info.hours_max) info.hours_max = h;
+        }
+
+        encode_block(pending_, 0, n, encoded_);
+        info.offset = offset_;
+        info.size = static_cast<uint32_t>(encoded_.size());
+        info.rows = static_cast<uint32_t>(n);
+        info.crc = Checksum::crc32c(encoded_.data(), encoded_.size());
+
+        ok_ = ok_ && file_->writeAt(encoded_.data(), info.size, offset_);
+        offset_ += info.size;
+        blocks_.push_back(info);
+        pending_.clear();
+        return ok_;
+    }
+
+    bool ColumnarArchiveWriter::append(const Employee& e)
+    {
+        if(finished_)
+            return false;
+        pending_.push_back(e);
+        rows_++;
+        return pending_.size() < block_rows_ || flush_block_();
+    }
+
+    bool ColumnarArchiveWriter::append_records(const char* records, size_t n)
+    {
+        if(finished_)
+            return false;
+        for(size_t i = 0; i < n; i++)
+        {
+            pending_.push_back_record(records + i * Employee::SERIALIZED_SIZE);
+            rows_++;
+            if(pending_.size() == block_rows_ && !flush_block_())
+                return false;
+        }
+        return ok_;
+    }
+
+    bool ColumnarArchiveWriter::append(const EmployeeColumns& table)
+    {
+        if(finished_)
+            return false;
+        for(size_t i = 0; i < table.size(); i++)
+        {
+            pending_.ids().push_back(table.ids()[i]);
+            pending_.hours().push_back(table.hours()[i]);
+            pending_.names().push_back(table.names()[i]);
+            rows_++;
+            if(pending_.size() == block_rows_ && !flush_block_())
+                return false;
+        }
+        return ok_;
+    }
+
+    bool ColumnarArchiveWriter::finish()
+    {
+        if(finished_ || !flush_block_())
+            return false;
+        finished_ = true;
+
+        size_t bytes = blocks_.size() * sizeof(ColumnarArchive::BlockInfo);
+        Header h = { ColumnarArchive::MAGIC, ColumnarArchive::VERSION, block_rows_,
+                     Checksum::crc32c(blocks_.data(), bytes), rows_, blocks_.size(), offset_ };
+        if(0 != bytes && !file_->writeAt(reinterpret_cast<const char*>(blocks_.data()),
+                                         static_cast<DWORD>(bytes), offset_))
+            return false;
+        // Header last: an interrupted archive has no magic and never opens
+        return file_->writeAt(reinterpret_cast<const char*>(&h), HEADER_SIZE, 0);
+    }
+
+    uint64_t ColumnarArchiveWriter::count() const noexcept
+    { return rows_; }
+
+} // namespace core::General
@@ -0,0 +1,237 @@
+/**
+ * @file DatasetGenerator.cpp
+ * @brief Implementation of the synthetic Employee dataset generator.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/DatasetGenerator.h>
+#include <core/General/AlignedEmployee.h>
+#include <core/General/Parallel.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr uint32_t MAX_NAME_CARDINALITY = 1u << 20;   // 15 MiB name table; names stay within BUFF_SIZE
+        constexpr double PI = 3.14159265358979323846;
+
+        // Surname stems of at most 9 characters; a numeric suffix of up to 5 digits makes them distinct
+        const char* const STEMS[] = {
+            "Ivanov", "Smirnov", "Kuznetsov", "Popov", "Vasiliev", "Petrov", "Sokolov", "Mikhailov",
+            "Novikov", "Fedorov", "Morozov", "Volkov", "Alekseev", "Lebedev", "Semenov", "Egorov",
+            "Pavlov", "Kozlov", "Stepanov", "Nikolaev", "Orlov", "Andreev", "Makarov", "Nikitin",
+            "Zakharov", "Zaitsev", "Soloviev", "Borisov", "Yakovlev", "Grigoriev", "Romanov", "Vorobiev"
+        };
+        constexpr uint32_t STEM_COUNT = sizeof(STEMS) / sizeof(STEMS[0]);
+
+        inline uint64_t mix_(uint64_t z) noexcept
+        {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        /** @brief splitmix64 step. */
+        inline uint64_t next_(uint64_t& state) noexcept
+        {
+            state += 0x9E3779B97F4A7C15ull;
+            return mix_(state);
+        }
+
+        /** @return A uniform double in [0, 1). */
+        inline double unit_(uint64_t& state) noexcept
+        {
+            return double(next_(state) >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+        /** @return A uniform integer in [0, n) by multiply-shift. */
+        inline uint32_t below_(uint64_t& state, uint32_t n) noexcept
+        {
+            return static_cast<uint32_t>(((next_(state) >> 32) * n) >> 32);
+        }
+
+        /** @return log1p(x) / x, accurate near 0. */
+        inline double helper1_(double x) noexcept
+        {
+            if(std::fabs(x) > 1e-8)
+                return std::log1p(x) / x;
+            return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+        }
+
+        /** @return expm1(x) / x, accurate near 0. */
+        inline double helper2_(double x) noexcept
+        {
+            if(std::fabs(x) > 1e-8)
+                return std::expm1(x) / x;
+            return 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+        }
+    } // namespace
+
+    DatasetGenerator::DatasetGenerator(const DatasetOptions& opts)
+        : opts_(opts)
+    {
+        opts_.id_range = std::clamp<uint32_t>(opts_.id_range, 1, uint32_t(Employee::ID_MAX) + 1);
+        opts_.name_cardinality = std::clamp<uint32_t>(opts_.name_cardinality, 1, MAX_NAME_CARDINALITY);
+        if(!(opts_.zipf_skew > 0.0))
+            opts_.zipf_skew = 1.0;
+        if(!(opts_.hours_max >= opts_.hours_min))
+            opts_.hours_max = opts_.hours_min;
+        if(!(opts_.hours_stddev >= 0.0))
+            opts_.hours_stddev = 0.0;
+        if(!(opts_.hours_step >= 0.0))
+            opts_.hours_step = 0.0;
+        if(0 == opts_.block_records)
+            opts_.block_records = EmployeeFileHeader::DEFAULT_BLOCK_RECORDS;
+        opts_.threads = Parallel::workers(opts_.threads);
+
+        names_.resize(opts_.name_cardinality);
+        for(uint32_t i = 0; i < opts_.name_cardinality; i++)
+        {
+            std::string s = STEMS[i % STEM_COUNT];
+            if(i >= STEM_COUNT)
+                s += std::to_string(i / STEM_COUNT);
+            names_[i].fill('\0');
+            memcpy(names_[i].data(), s.data(), std::min(s.size(), names_[i].size()));
+        }
+
+        const double n = double(opts_.id_range);
+        zipf_h_x1_ = zipf_h_integral_(1.5) - 1.0;
+        zipf_h_n_ = zipf_h_integral_(n + 0.5);
+        zipf_s_ = 2.0 - zipf_h_integral_inverse_(zipf_h_integral_(2.5) - zipf_h_(2.0));
+    }
+
+    const DatasetOptions& DatasetGenerator::options() const noexcept
+    { return opts_; }
+
+    std::string DatasetGenerator::name(uint32_t i) const
+    {
+        const auto& n = names_[i % names_.size()];
+        return std::string(n.data(), strnlen(n.data(), n.size()));
+    }
+
+    double DatasetGenerator::zipf_h_(double x) const noexcept
+    {
+        return std::exp(-opts_.zipf_skew * std::log(x));
+    }
+
+    double DatasetGenerator::zipf_h_integral_(double x) const noexcept
+    {
+        const double log_x = std::log(x);
+        return helper2_((1.0 - opts_.zipf_skew) * log_x) * log_x;
+    }
+
+    double DatasetGenerator::zipf_h_integral_inverse_(double x) const noexcept
+    {
+        double t = x * (1.0 - opts_.zipf_skew);
+        if(t < -1.0)
+            t = -1.0;   // Rounding can push t just past the pole of log1p
+        return std::exp(helper1_(t) * x);
+    }
+
+    uint64_t DatasetGenerator::zipf_(uint64_t& state) const noexcept
+    {
+        // Rejection-inversion (Hormann and Derflinger): invert the integral of
+        // a continuous hat function, round, and accept with a cheap test that
+        // passes almost always
+        const uint64_t n = opts_.id_range;
+        for(;;)
+        {
+            const double u = zipf_h_n_ + unit_(state) * (zipf_h_x1_ - zipf_h_n_);
+            const double x = zipf_h_integral_inverse_(u);
+            uint64_t k = static_cast<uint64_t>(x + 0.5);
+            if(k < 1)       k = 1;
+            else if(k > n)  k = n;
+
+            if(double(k) - x <= zipf_s_ || u >= zipf_h_integral_(double(k) + 0.5) - zipf_h_(double(k)))
+                return k - 1;
+        }
+    }
+
+    void DatasetGenerator::generate(uint64_t first, size_t n, char* records) const noexcept
+    {
+        typedef Employee::Schema S;
+        const uint64_t seed = mix_(opts_.seed ^ 0x6A09E667F3BCC908ull);
+        for(size_t i = 0; i < n; i++)
+        {
+            const uint64_t index = first + i;
+            uint64_t state = mix_(seed + index * 0x9E3779B97F4A7C15ull);
+            char* record = records + i * Employee::SERIALIZED_SIZE;
+
+            uint64_t id;
+            switch(opts_.ids)
+            {
+            case IdDistribution::sequential: id = index % opts_.id_range; break;
+            case IdDistribution::zipf:       id = zipf_(state); break;
+            default:                         id = below_(state, opts_.id_range); break;
+            }
+
+            double hours;
+            switch(opts_.hours)
+            {
+            case HoursDistribution::normal:
+            {
+                // Box-Muller; 1 - u keeps the logarithm finite
+                const double r = std::sqrt(-2.0 * std::log(1.0 - unit_(state)));
+                hours = opts_.hours_mean + opts_.hours_stddev * r * std::cos(2.0 * PI * unit_(state));
+                break;
+            }
+            case HoursDistribution::exponential:
+                hours = -opts_.hours_mean * std::log(1.0 - unit_(state));
+                break;
+            default:
+                hours = opts_.hours_min + unit_(state) * (opts_.hours_max - opts_.hours_min);
+                break;
+            }
+            if(opts_.hours_step > 0.0)
+                hours = std::round(hours / opts_.hours_step) * opts_.hours_step;
+
+            S::write<Employee::FIELD_ID>(record, static_cast<Employee::ID_TYPE>(id));
+            S::write<Employee::FIELD_HOURS>(record, hours);
+            S::write_from<Employee::FIELD_NAME>(record, names_[below_(state, opts_.name_cardinality)].data());
+        }
+    }
+
+    bool DatasetGenerator::write(const File& out) const
+    {
+        EmployeeFileWriter writer(out, opts_.block_records, opts_.buffer_size, opts_.layout);
+        const bool aligned = EmployeeLayout::aligned == opts_.layout;
+        const size_t workers = opts_.threads;
+
+        std::vector<std::vector<char>> compact(workers);
+        std::vector<std::vector<AlignedEmployee>> converted(aligned ? workers : 0);
+        std::vector<size_t> counts(workers);
+        for(uint64_t base = 0; base < opts_.records; base += uint64_t(workers) * CHUNK_RECORDS)
+        {
+            Parallel::run(workers, [&](size_t w)
+            {
+                const uint64_t first = base + uint64_t(w) * CHUNK_RECORDS;
+                counts[w] = first < opts_.records
+                          ? static_cast<size_t>(std::min<uint64_t>(CHUNK_RECORDS, opts_.records - first)) : 0;
+                if(0 == counts[w])
+                    return;
+                compact[w].resize(CHUNK_RECORDS * Employee::SERIALIZED_SIZE);
+                generate(first, counts[w], compact[w].data());
+                // Convert on the worker so the writing thread only copies
+                if(aligned)
+                {
+                    converted[w].resize(CHUNK_RECORDS);
+                    AlignedEmployee::from_records(compact[w].data(), counts[w], converted[w].data());
+                }
+            });
+
+            for(size_t w = 0; w < workers && 0 != counts[w]; w++)
+            {
+                bool ok = aligned ? writer.append_aligned(converted[w].data(), counts[w])
+                                  : writer.append_records(compact[w].data(), counts[w]);
+                if(!ok)
+                    return false;
+            }
+        }
+        return writer.finish();
+    }
+
+} // namespace core::General
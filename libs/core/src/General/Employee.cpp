@@ -56,36 +56,28 @@ namespace core::General
     std::array<char, Employee::SERIALIZED_SIZE> Employee::serialize() const noexcept
     {
         std::array<char, SERIALIZED_SIZE> m;
-        size_t i = 0;
-
-        // Build binary layout: [ID][Hours][NameBuffer]
-        memcpy(&m[i], &id_, sizeof(ID_TYPE)); 
-        i += sizeof(ID_TYPE);
-
-        memcpy(&m[i], &hours_, sizeof(double)); 
-        i += sizeof(double);
-
-        // Name buffer is copied as a raw block of BUFF_SIZE
-        memcpy(&m[i], name_, BUFF_SIZE);
-
+        // Field offsets come from Schema, so the layout is described in one place
+        Schema::encode(m.data(), &id_, &hours_, name_);
         return m;
     }
 
     Employee Employee::deserialize(const char* m)
     {
         Employee output;
-        size_t i = 0;
-
-        // Extract fields in the exact same sequence as serialize()
-        memcpy(&output.id_, &m[i], sizeof(ID_TYPE)); 
-        i += sizeof(ID_TYPE);
-
-        memcpy(&output.hours_, &m[i], sizeof(double)); 
-        i += sizeof(double);
+        Schema::decode(m, &output.id_, &output.hours_, output.name_);
+        return output;
+    }
 
-        memcpy(output.name_, &m[i], BUFF_SIZE);
+    void Employee::serialize_batch(const Employee* src, size_t n, char* out) noexcept
+    {
+        for(size_t i = 0; i < n; i++, out += SERIALIZED_SIZE)
+            Schema::encode(out, &src[i].id_, &src[i].hours_, src[i].name_);
+    }
 
-        return output;
+    void Employee::deserialize_batch(const char* in, size_t n, Employee* out) noexcept
+    {
+        for(size_t i = 0; i < n; i++, in += SERIALIZED_SIZE)
+            Schema::decode(in, &out[i].id_, &out[i].hours_, out[i].name_);
     }
 
 } // namespace core::General
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @file EmployeeColumns.cpp
+ * @brief Implementation of the column-oriented Employee table.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/EmployeeColumns.h>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        template <class T>
+        void gather(std::vector<T>& column, const std::vector<uint32_t>& order)
+        {
+            std::vector<T> out(order.size());
+            for(size_t i = 0; i < order.size(); i++)
+                out[i] = column[order[i]];
+            column.swap(out);
+        }
+    }
+
+    EmployeeColumns EmployeeColumns::from_records(const char* records, size_t n)
+    {
+        EmployeeColumns t;
+        t.reserve(n);
+        for(size_t i = 0; i < n; i++)
+            t.push_back_record(records + i * Employee::SERIALIZED_SIZE);
+        return t;
+    }
+
+    size_t EmployeeColumns::size() const noexcept
+    { return ids_.size(); }
+
+    bool EmployeeColumns::empty() const noexcept
+    { return ids_.empty(); }
+
+    void EmployeeColumns::reserve(size_t n)
+    {
+        ids_.reserve(n);
+        hours_.reserve(n);
+        names_.reserve(n);
+    }
+
+    void EmployeeColumns::resize(size_t n)
+    {
+        ids_.resize(n, static_cast<Employee::ID_TYPE>(Employee::ID_MIN));
+        hours_.resize(n, 0.0);
+        names_.resize(n, Name{});
+    }
+
+    void EmployeeColumns::clear() noexcept
+    {
+        ids_.clear();
+        hours_.clear();
+        names_.clear();
+    }
+
+    void EmployeeColumns::push_back(const Employee& e)
+    {
+        Name name;
+        memcpy(name.data(), e.name(), Employee::BUFF_SIZE);
+        ids_.push_back(e.id());
+        hours_.push_back(e.hours());
+        names_.push_back(name);
+    }
+
+    void EmployeeColumns::push_back_record(const char* record)
+    {
+        Name name;
+        Employee::Schema::read_to<Employee::FIELD_NAME>(record, name.data());
+        ids_.push_back(Employee::Schema::read<Employee::FIELD_ID>(record));
+        hours_.push_back(Employee::Schema::read<Employee::FIELD_HOURS>(record));
+        names_.push_back(name);
+    }
+
+    Employee EmployeeColumns::employee(size_t i) const noexcept
+    {
+        Employee e;
+        e.id() = ids_[i];
+        e.hours() = hours_[i];
+        memcpy(e.name(), names_[i].data(), Employee::BUFF_SIZE);
+        return e;
+    }
+
+    void EmployeeColumns::serialize_row(size_t i, char* out) const noexcept
+    {
+        Employee::Schema::encode(out, &ids_[i], &hours_[i], names_[i].data());
+    }
+
+    const std::vector<Employee::ID_TYPE>& EmployeeColumns::ids() const noexcept
+    { return ids_; }
+
+    const std::vector<double>& EmployeeColumns::hours() const noexcept
+    { return hours_; }
+
+    const std::vector<EmployeeColumns::Name>& EmployeeColumns::names() const noexcept
+    { return names_; }
+
+    std::vector<Employee::ID_TYPE>& EmployeeColumns::ids() noexcept
+    { return ids_; }
+
+    std::vector<double>& EmployeeColumns::hours() noexcept
+    { return hours_; }
+
+    std::vector<EmployeeColumns::Name>& EmployeeColumns::names() noexcept
+    { return names_; }
+
+    void EmployeeColumns::permute(const std::vector<uint32_t>& order)
+    {
+        gather(ids_, order);
+        gather(hours_, order);
+        gather(names_, order);
+    }
+
+} // namespace core::General
@@ -0,0 +1,517 @@
+/**
+ * @file EmployeeFile.cpp
+ * @brief Implementation of the versioned Employee file header, writer and reader.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/EmployeeFile.h>
+#include <core/General/Checksum.h>
+#include <algorithm>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t RECORD = Employee::SERIALIZED_SIZE;
+        constexpr uint32_t CRC_OFFSET = EmployeeFileHeader::SIZE - sizeof(uint32_t);
+        constexpr size_t MAX_READ_RECORDS = (64u << 20) / RECORD;   // Keeps one readAt() well below a DWORD
+        constexpr size_t CONVERT_RECORDS = 256;                      // Records per layout conversion on the stack
+
+        /** @brief On-disk field offsets inside the 64-byte header. */
+        enum HeaderOffset : size_t
+        {
+            H_MAGIC = 0, H_VERSION = 4, H_ENDIAN = 6, H_FLAGS = 8, H_HEADER_SIZE = 12,
+            H_RECORD_SIZE = 16, H_BLOCK_RECORDS = 20, H_COUNT = 24, H_DATA = 32,
+            H_TABLE = 40, H_BLOCKS = 48, H_RESERVED = 56
+        };
+
+        inline uint16_t swap16(uint16_t v) noexcept
+        { return static_cast<uint16_t>((v >> 8) | (v << 8)); }
+
+        inline uint32_t swap32(uint32_t v) noexcept
+        { return (v >> 24) | ((v >> 8) & 0xFF00u) | ((v << 8) & 0xFF0000u) | (v << 24); }
+
+        inline uint64_t swap64(uint64_t v) noexcept
+        { return (uint64_t(swap32(static_cast<uint32_t>(v))) << 32) | swap32(static_cast<uint32_t>(v >> 32)); }
+
+        /** @brief Reads a header field, converting from the writer's byte order if needed. */
+        template <class T>
+        T get(const char* buf, size_t offset, bool host_order) noexcept
+        {
+            T v;
+            memcpy(&v, buf + offset, sizeof(v));
+            if(host_order) return v;
+            if constexpr(sizeof(T) == 2) return swap16(v);
+            else if constexpr(sizeof(T) == 4) return swap32(v);
+            else return swap64(v);
+        }
+
+        template <class T>
+        void put(char* buf, size_t offset, T v) noexcept
+        {
+            memcpy(buf + offset, &v, sizeof(v));
+        }
+
+        /** @brief Converts records written on an opposite-endian host in place. */
+        void swap_records(char* records, size_t n) noexcept
+        {
+            typedef Employee::Schema S;
+            for(size_t i = 0; i < n; i++)
+            {
+                char* r = records + i * RECORD;
+                S::write<Employee::FIELD_ID>(r, swap16(S::read<Employee::FIELD_ID>(r)));
+                uint64_t bits;
+                memcpy(&bits, r + S::offset<Employee::FIELD_HOURS>(), sizeof(bits));
+                bits = swap64(bits);
+                memcpy(r + S::offset<Employee::FIELD_HOURS>(), &bits, sizeof(bits));
+            }
+        }
+
+        /** @brief Converts aligned records written on an opposite-endian host in place. */
+        void swap_aligned(AlignedEmployee* records, size_t n) noexcept
+        {
+            for(size_t i = 0; i < n; i++)
+            {
+                records[i].id = swap16(records[i].id);
+                uint64_t bits;
+                memcpy(&bits, &records[i].hours, sizeof(bits));
+                bits = swap64(bits);
+                memcpy(&records[i].hours, &bits, sizeof(bits));
+            }
+        }
+
+        /** @return Record size implied by the layout flags. */
+        inline uint32_t record_size_for(uint32_t flags) noexcept
+        {
+            return 0 != (flags & EmployeeFileHeader::FLAG_ALIGNED) ? static_cast<uint32_t>(AlignedEmployee::SIZE)
+                                                                  : static_cast<uint32_t>(RECORD);
+        }
+
+        /** @brief Reads the first four bytes of @p file, if it has that many. */
+        std::optional<uint32_t> leading_word(const File& file, uint64_t size) noexcept
+        {
+            uint32_t word;
+            if(size < sizeof(word) || !file.readAt(reinterpret_cast<char*>(&word), sizeof(word), 0))
+                return std::nullopt;
+            return word;
+        }
+    } // namespace
+
+    // --- EmployeeFileHeader ---
+
+    std::optional<EmployeeFileHeader> EmployeeFileHeader::read(const File& file) noexcept
+    {
+        std::optional<uint64_t> size = file.getFileSize64();
+        if(!size.has_value() || size.value() < SIZE)
+            return std::nullopt;
+
+        char buf[SIZE];
+        if(!file.readAt(buf, SIZE, 0))
+            return std::nullopt;
+
+        EmployeeFileHeader h;
+        uint32_t magic = get<uint32_t>(buf, H_MAGIC, true);
+        if(MAGIC == magic) h.host_order = true;
+        else if(swap32(MAGIC) == magic) h.host_order = false;
+        else return std::nullopt;
+
+        if(ENDIAN_MARKER != get<uint16_t>(buf, H_ENDIAN, h.host_order)
+            || get<uint32_t>(buf, CRC_OFFSET, h.host_order) != Checksum::crc32c(buf, CRC_OFFSET))
+            return std::nullopt;
+
+        h.version = get<uint16_t>(buf, H_VERSION, h.host_order);
+        h.flags = get<uint32_t>(buf, H_FLAGS, h.host_order);
+        h.record_size = get<uint32_t>(buf, H_RECORD_SIZE, h.host_order);
+        h.block_records = get<uint32_t>(buf, H_BLOCK_RECORDS, h.host_order);
+        h.record_count = get<uint64_t>(buf, H_COUNT, h.host_order);
+        h.data_offset = get<uint64_t>(buf, H_DATA, h.host_order);
+        h.table_offset = get<uint64_t>(buf, H_TABLE, h.host_order);
+        h.block_count = get<uint64_t>(buf, H_BLOCKS, h.host_order);
+
+        // Everything below is arithmetic on the header and the file size; nothing else is read
+        if(0 == h.version || h.version > VERSION || 0 != (h.flags & ~KNOWN_FLAGS)
+            || SIZE != get<uint32_t>(buf, H_HEADER_SIZE, h.host_order)
+            || record_size_for(h.flags) != h.record_size || 0 == h.block_records
+            || h.data_offset < SIZE || h.data_offset > size.value()
+            || h.record_count > (size.value() - h.data_offset) / h.record_size
+            || h.block_count != (h.record_count + h.block_records - 1) / h.block_records
+            || h.table_offset != h.data_offset + h.record_count * h.record_size
+            || h.file_size() != size.value())
+            return std::nullopt;
+        return h;
+    }
+
+    bool EmployeeFileHeader::write(const File& file) const noexcept
+    {
+        char buf[SIZE] = {};
+        put<uint32_t>(buf, H_MAGIC, MAGIC);
+        put<uint16_t>(buf, H_VERSION, version);
+        put<uint16_t>(buf, H_ENDIAN, ENDIAN_MARKER);
+        put<uint32_t>(buf, H_FLAGS, flags);
+        put<uint32_t>(buf, H_HEADER_SIZE, SIZE);
+        put<uint32_t>(buf, H_RECORD_SIZE, record_size);
+        put<uint32_t>(buf, H_BLOCK_RECORDS, block_records);
+        put<uint64_t>(buf, H_COUNT, record_count);
+        put<uint64_t>(buf, H_DATA, data_offset);
+        put<uint64_t>(buf, H_TABLE, table_offset);
+        put<uint64_t>(buf, H_BLOCKS, block_count);
+        put<uint32_t>(buf, H_RESERVED, 0);
+        put<uint32_t>(buf, CRC_OFFSET, Checksum::crc32c(buf, CRC_OFFSET));
+        return file.writeAt(buf, SIZE, 0);
+    }
+
+    uint64_t EmployeeFileHeader::record_offset(uint64_t i) const noexcept
+    { return data_offset + i * record_size; }
+
+    EmployeeLayout EmployeeFileHeader::layout() const noexcept
+    { return 0 != (flags & FLAG_ALIGNED) ? EmployeeLayout::aligned : EmployeeLayout::compact; }
+
+    bool EmployeeFileHeader::native_layout() const noexcept
+    { return host_order && 0 == flags && RECORD == record_size; }
+
+    bool EmployeeFileHeader::aligned_layout() const noexcept
+    { return host_order && FLAG_ALIGNED == flags && AlignedEmployee::SIZE == record_size; }
+
+    uint64_t EmployeeFileHeader::file_size() const noexcept
+    { return table_offset + block_count * sizeof(uint32_t); }
+
+    // --- EmployeeFileWriter ---
+
+    EmployeeFileWriter::EmployeeFileWriter(const File& file, uint32_t block_records, size_t buffer_size,
+                                           EmployeeLayout layout)
+        : file_(&file), out_(file, EmployeeFileHeader::SIZE, buffer_size),
+          crc_(0), in_block_(0), finished_(false)
+    {
+        header_.block_records = std::max<uint32_t>(block_records, 1);
+        if(EmployeeLayout::aligned == layout)
+        {
+            header_.flags = EmployeeFileHeader::FLAG_ALIGNED;
+            header_.record_size = AlignedEmployee::SIZE;
+        }
+    }
+
+    template <class Convert>
+    bool EmployeeFileWriter::append_converted_(size_t n, Convert&& convert) noexcept
+    {
+        if(finished_)
+            return false;
+        // Convert straight into the write buffer, one slice at a time
+        constexpr size_t SLICE = 1024;
+        const size_t size = header_.record_size;
+        for(size_t done = 0; done < n; )
+        {
+            size_t take = std::min(n - done, SLICE);
+            char* dst = out_.reserve(take * size);
+            if(nullptr == dst)
+            {
+                // Buffer smaller than a slice: convert into scratch and copy
+                std::vector<char> scratch(take * size);
+                convert(scratch.data(), done, take);
+                if(!out_.write(scratch.data(), scratch.size()))
+                    return false;
+                account_(scratch.data(), take);
+            }
+            else
+            {
+                convert(dst, done, take);
+                account_(dst, take);
+            }
+            done += take;
+        }
+        return out_.good();
+    }
+
+    bool EmployeeFileWriter::append(const Employee& e) noexcept
+    {
+        return append(&e, 1);
+    }
+
+    bool EmployeeFileWriter::append(const Employee* src, size_t n) noexcept
+    {
+        if(RECORD == header_.record_size)
+            return append_converted_(n, [src](char* dst, size_t first, size_t take) {
+                Employee::serialize_batch(src + first, take, dst);
+            });
+        return append_converted_(n, [src](char* dst, size_t first, size_t take) {
+            for(size_t i = 0; i < take; i++)
+            {
+                AlignedEmployee a = AlignedEmployee::from_employee(src[first + i]);
+                memcpy(dst + i * AlignedEmployee::SIZE, &a, AlignedEmployee::SIZE);
+            }
+        });
+    }
+
+    bool EmployeeFileWriter::append_records(const char* records, size_t n) noexcept
+    {
+        if(RECORD != header_.record_size)
+            return append_converted_(n, [records](char* dst, size_t first, size_t take) {
+                for(size_t i = 0; i < take; i++)
+                {
+                    AlignedEmployee a = AlignedEmployee::from_record(records + (first + i) * RECORD);
+                    memcpy(dst + i * AlignedEmployee::SIZE, &a, AlignedEmployee::SIZE);
+                }
+            });
+        if(finished_ || !out_.write(records, n * RECORD))
+            return false;
+        account_(records, n);
+        return true;
+    }
+
+    bool EmployeeFileWriter::append_aligned(const AlignedEmployee* records, size_t n) noexcept
+    {
+        if(RECORD == header_.record_size)
+            return append_converted_(n, [records](char* dst, size_t first, size_t take) {
+                AlignedEmployee::to_records(records + first, take, dst);
+            });
+        const char* bytes = reinterpret_cast<const char*>(records);
+        if(finished_ || !out_.write(bytes, n * AlignedEmployee::SIZE))
+            return false;
+        account_(bytes, n);
+        return true;
+    }
+
+    void EmployeeFileWriter::account_(const char* records, size_t n) noexcept
+    {
+        header_.record_count += n;
+        while(0 != n)
+        {
+            size_t take = std::min<size_t>(n, header_.block_records - in_block_);
+            crc_ = Checksum::crc32c(records, take * header_.record_size, crc_);
+            in_block_ += static_cast<uint32_t>(take);
+            records += take * header_.record_size;
+            n -= take;
+
+            if(in_block_ == header_.block_records)
+            {
+                checksums_.push_back(crc_);
+                crc_ = 0;
+                in_block_ = 0;
+            }
+        }
+    }
+
+    bool EmployeeFileWriter::finish() noexcept
+    {
+        if(finished_)
+            return false;
+        finished_ = true;
+        if(0 != in_block_)
+            checksums_.push_back(crc_);
+
+        header_.table_offset = header_.record_offset(header_.record_count);
+        header_.block_count = checksums_.size();
+        if(!out_.write(reinterpret_cast<const char*>(checksums_.data()), checksums_.size() * sizeof(uint32_t))
+            || !out_.flush())
+            return false;
+        // Header last: a crash before this point leaves a file that never validates
+        return header_.write(*file_);
+    }
+
+    uint64_t EmployeeFileWriter::count() const noexcept
+    { return header_.record_count; }
+
+    // --- EmployeeFileReader ---
+
+    EmployeeFileReader::EmployeeFileReader(const File& file, const EmployeeFileHeader& header, bool versioned) noexcept
+        : file_(&file), header_(header), versioned_(versioned)
+    {
+    }
+
+    std::optional<EmployeeFileReader> EmployeeFileReader::open(const File& file) noexcept
+    {
+        if(std::optional<EmployeeFileHeader> h = EmployeeFileHeader::read(file))
+            return EmployeeFileReader(file, h.value(), true);
+
+        std::optional<uint64_t> size = file.getFileSize64();
+        if(!size.has_value())
+            return std::nullopt;
+
+        // A file that carries the magic but failed validation is damaged, not legacy
+        std::optional<uint32_t> word = leading_word(file, size.value());
+        if(word.has_value() && (EmployeeFileHeader::MAGIC == word.value()
+                                || swap32(EmployeeFileHeader::MAGIC) == word.value()))
+            return std::nullopt;
+        if(0 != size.value() % RECORD)
+            return std::nullopt;
+
+        EmployeeFileHeader legacy;
+        legacy.record_count = size.value() / RECORD;
+        legacy.data_offset = 0;
+        legacy.table_offset = size.value();
+        legacy.block_count = 0;
+        return EmployeeFileReader(file, legacy, false);
+    }
+
+    const EmployeeFileHeader& EmployeeFileReader::header() const noexcept
+    { return header_; }
+
+    bool EmployeeFileReader::versioned() const noexcept
+    { return versioned_; }
+
+    uint64_t EmployeeFileReader::size() const noexcept
+    { return header_.record_count; }
+
+    bool EmployeeFileReader::zero_copy() const noexcept
+    { return header_.native_layout(); }
+
+    bool EmployeeFileReader::read(uint64_t first, size_t n, char* out) const noexcept
+    {
+        if(first > header_.record_count || n > header_.record_count - first)
+            return false;
+        if(EmployeeLayout::aligned == header_.layout())
+        {
+            AlignedEmployee chunk[CONVERT_RECORDS];
+            for(size_t done = 0; done < n; )
+            {
+                size_t take = std::min(n - done, CONVERT_RECORDS);
+                if(!read_aligned(first + done, take, chunk))
+                    return false;
+                AlignedEmployee::to_records(chunk, take, out + done * RECORD);
+                done += take;
+            }
+            return true;
+        }
+        for(size_t done = 0; done < n; )
+        {
+            size_t take = std::min(n - done, MAX_READ_RECORDS);
+            if(!file_->readAt(out + done * RECORD, static_cast<DWORD>(take * RECORD),
+                              header_.record_offset(first + done)))
+                return false;
+            done += take;
+        }
+        if(!header_.host_order)
+            swap_records(out, n);
+        return true;
+    }
+
+    bool EmployeeFileReader::read_aligned(uint64_t first, size_t n, AlignedEmployee* out) const noexcept
+    {
+        if(first > header_.record_count || n > header_.record_count - first)
+            return false;
+        if(EmployeeLayout::compact == header_.layout())
+        {
+            char chunk[CONVERT_RECORDS * RECORD];
+            for(size_t done = 0; done < n; )
+            {
+                size_t take = std::min(n - done, CONVERT_RECORDS);
+                if(!read(first + done, take, chunk))
+                    return false;
+                AlignedEmployee::from_records(chunk, take, out + done);
+                done += take;
+            }
+            return true;
+        }
+
+        for(size_t done = 0; done < n; )
+        {
+            size_t take = std::min(n - done, MAX_READ_RECORDS);
+            if(!file_->readAt(reinterpret_cast<char*>(out + done), static_cast<DWORD>(take * AlignedEmployee::SIZE),
+                              header_.record_offset(first + done)))
+                return false;
+            done += take;
+        }
+        if(!header_.host_order)
+            swap_aligned(out, n);
+        return true;
+    }
+
+    std::optional<Employee> EmployeeFileReader::at(uint64_t i) const noexcept
+    {
+        char rec[RECORD];
+        if(!read(i, 1, rec))
+            return std::nullopt;
+        return Employee::deserialize(rec);
+    }
+
+    bool EmployeeFileReader::verify_block(uint64_t b) const
+    {
+        if(!versioned_)
+            return true;
+        if(b >= header_.block_count)
+            return false;
+
+        uint32_t stored;
+        if(!file_->readAt(reinterpret_cast<char*>(&stored), sizeof(stored),
+                          header_.table_offset + b * sizeof(uint32_t)))
+            return false;
+        if(!header_.host_order)
+            stored = swap32(stored);
+
+        // Checksums cover the bytes as stored, so no conversion is needed here
+        uint64_t first = b * header_.block_records;
+        size_t n = static_cast<size_t>(std::min<uint64_t>(header_.block_records, header_.record_count - first));
+        std::vector<char> block(n * header_.record_size);
+        return file_->readAt(block.data(), static_cast<DWORD>(block.size()), header_.record_offset(first))
+            && stored == Checksum::crc32c(block.data(), block.size());
+    }
+
+    bool EmployeeFileReader::verify() const
+    {
+        if(!versioned_)
+            return true;
+
+        std::vector<uint32_t> table(static_cast<size_t>(header_.block_count));
+        if(!table.empty() && !file_->readAt(reinterpret_cast<char*>(table.data()),
+                                            static_cast<DWORD>(table.size() * sizeof(uint32_t)),
+                                            header_.table_offset))
+            return false;
+
+        const size_t block_bytes = size_t(header_.block_records) * header_.record_size;
+        BufferedReader in(*file_, header_.data_offset, header_.table_offset, std::max<size_t>(block_bytes, 1u << 20));
+        for(uint64_t b = 0; b < header_.block_count; b++)
+        {
+            size_t bytes = static_cast<size_t>(std::min<uint64_t>(block_bytes, in.remaining()));
+            const char* p = in.peek(bytes);
+            if(nullptr == p)
+                return false;
+            uint32_t stored = header_.host_order ? table[b] : swap32(table[b]);
+            if(stored != Checksum::crc32c(p, bytes))
+                return false;
+            in.skip(bytes);
+        }
+        return true;
+    }
+
+    std::optional<uint32_t> EmployeeFileReader::table_checksum() const
+    {
+        if(!versioned_)
+            return 0u;
+
+        // Taken over the bytes as stored, like the block checksums themselves
+        std::vector<char> table(static_cast<size_t>(header_.block_count) * sizeof(uint32_t));
+        if(!table.empty() && !file_->readAt(table.data(), static_cast<DWORD>(table.size()), header_.table_offset))
+            return std::nullopt;
+        return Checksum::crc32c(table.data(), table.size());
+    }
+
+    // --- EmployeeFileConverter ---
+
+    bool EmployeeFileConverter::run(const File& in, const File& out, EmployeeLayout layout, uint32_t block_records)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(in);
+        if(!reader.has_value())
+            return false;
+
+        EmployeeFileWriter writer(out, block_records, 4u << 20, layout);
+        std::vector<AlignedEmployee> aligned;
+        std::vector<char> compact;
+        if(EmployeeLayout::aligned == layout)
+            aligned.resize(BATCH_RECORDS);
+        else
+            compact.resize(BATCH_RECORDS * RECORD);
+
+        for(uint64_t first = 0; first < reader->size(); first += BATCH_RECORDS)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(BATCH_RECORDS, reader->size() - first));
+            bool ok = EmployeeLayout::aligned == layout
+                ? reader->read_aligned(first, n, aligned.data()) && writer.append_aligned(aligned.data(), n)
+                : reader->read(first, n, compact.data()) && writer.append_records(compact.data(), n);
+            if(!ok)
+                return false;
+        }
+        return writer.finish();
+    }
+
+} // namespace core::General
@@ -0,0 +1,552 @@
+/**
+ * @file EmployeeLog.cpp
+ * @brief Implementation of the append-only Employee log.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/EmployeeLog.h>
+#include <core/General/Checksum.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t RECORD = Employee::SERIALIZED_SIZE;
+        constexpr size_t LSN_OFFSET = 0;
+        constexpr size_t RECORD_OFFSET = sizeof(uint64_t);
+        constexpr size_t CRC_OFFSET = RECORD_OFFSET + RECORD;
+        constexpr size_t COMPACT_CHUNK_ENTRIES = 4096;   // Entries read per step while compacting
+        constexpr const char* SEGMENT_PREFIX = "employee-";
+        constexpr const char* SEGMENT_SUFFIX = ".log";
+        constexpr size_t SEGMENT_DIGITS = 10;
+
+        /** @brief Builds an entry: sequence number, compact record, CRC of both. */
+        void encode(char* dst, uint64_t lsn, const Employee& e) noexcept
+        {
+            memcpy(dst + LSN_OFFSET, &lsn, sizeof(lsn));
+            Employee::serialize_batch(&e, 1, dst + RECORD_OFFSET);
+            uint32_t crc = Checksum::crc32c(dst, CRC_OFFSET);
+            memcpy(dst + CRC_OFFSET, &crc, sizeof(crc));
+        }
+
+        /** @return The sequence number of a valid entry, or 0 if the CRC does not match. */
+        uint64_t decode(const char* src) noexcept
+        {
+            uint32_t crc;
+            memcpy(&crc, src + CRC_OFFSET, sizeof(crc));
+            if(crc != Checksum::crc32c(src, CRC_OFFSET))
+                return 0;
+            uint64_t lsn;
+            memcpy(&lsn, src + LSN_OFFSET, sizeof(lsn));
+            return lsn;
+        }
+
+        inline Employee::ID_TYPE entry_id(const char* src) noexcept
+        { return Employee::Schema::read<Employee::FIELD_ID>(src + RECORD_OFFSET); }
+
+        /** @return The segment number encoded in @p name, or 0 if it is not a segment file name. */
+        uint64_t segment_number(const char* name) noexcept
+        {
+            const size_t prefix = strlen(SEGMENT_PREFIX);
+            const size_t suffix = strlen(SEGMENT_SUFFIX);
+            if(strlen(name) != prefix + SEGMENT_DIGITS + suffix || 0 != strncmp(name, SEGMENT_PREFIX, prefix)
+                || 0 != strcmp(name + prefix + SEGMENT_DIGITS, SEGMENT_SUFFIX))
+                return 0;
+            char* end = nullptr;
+            uint64_t seq = strtoull(name + prefix, &end, 10);
+            return end == name + prefix + SEGMENT_DIGITS ? seq : 0;
+        }
+    } // namespace
+
+    EmployeeLog::EmployeeLog(LPCSTR directory, const EmployeeLogOptions& opts)
+        : directory_(nullptr != directory ? directory : "."), opts_(opts),
+          index_(size_t(Employee::ID_MAX) + 1), active_(nullptr), flushed_(0),
+          next_lsn_(1), next_segment_(1), aggregate_(nullptr), open_(false), stop_(false)
+    {
+        InitializeSRWLock(&lock_);
+        InitializeSRWLock(&compact_lock_);
+        InitializeConditionVariable(&wake_);
+        if(!CreateDirectoryA(directory_.c_str(), nullptr) && ERROR_ALREADY_EXISTS != GetLastError())
+            return;
+
+        std::vector<uint64_t> found;
+        WIN32_FIND_DATAA data;
+        std::string pattern = directory_ + "\\" + SEGMENT_PREFIX + "*" + SEGMENT_SUFFIX;
+        HANDLE find = FindFirstFileA(pattern.c_str(), &data);
+        if(INVALID_HANDLE_VALUE != find)
+        {
+            do
+            {
+                if(uint64_t seq = segment_number(data.cFileName))
+                    found.push_back(seq);
+            } while(FindNextFileA(find, &data));
+            FindClose(find);
+        }
+
+        // Replay order only matters for ties, and those are copies of the same entry
+        std::sort(found.begin(), found.end());
+        for(uint64_t seq : found)
+        {
+            auto s = std::make_unique<Segment>();
+            s->seq = seq;
+            s->file = File::open(path_(seq).c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if(!s->file)
+                return;
+            Segment& ref = *s;
+            segments_.emplace(seq, std::move(s));
+            if(!replay_(ref))
+                return;
+            next_segment_ = seq + 1;
+        }
+
+        std::unique_ptr<Segment> s = create_segment_(next_segment_++);
+        if(!s)
+            return;
+        active_ = s.get();
+        segments_.emplace(active_->seq, std::move(s));
+        writer_.emplace(active_->file, HEADER_SIZE, opts_.buffer_size);
+        flushed_ = HEADER_SIZE;
+        open_ = true;
+
+        if(opts_.background_compaction)
+            compactor_ = Thread::create(nullptr, 0, compactor_main_, this, 0, nullptr);
+    }
+
+    EmployeeLog::~EmployeeLog() noexcept
+    {
+        if(compactor_.valid())
+        {
+            AcquireSRWLockExclusive(&lock_);
+            stop_ = true;
+            ReleaseSRWLockExclusive(&lock_);
+            WakeAllConditionVariable(&wake_);
+            compactor_.join();
+        }
+        flush();
+    }
+
+    std::string EmployeeLog::path_(uint64_t seq) const
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "%s%0*llu%s", SEGMENT_PREFIX, static_cast<int>(SEGMENT_DIGITS),
+                 static_cast<unsigned long long>(seq), SEGMENT_SUFFIX);
+        return directory_ + "\\" + name;
+    }
+
+    std::unique_ptr<EmployeeLog::Segment> EmployeeLog::create_segment_(uint64_t seq)
+    {
+        auto s = std::make_unique<Segment>();
+        s->seq = seq;
+        s->file = File::open(path_(seq).c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                             CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(!s->file)
+            return nullptr;
+
+        char header[HEADER_SIZE] = {};
+        memcpy(header, &MAGIC, sizeof(MAGIC));
+        memcpy(header + 4, &VERSION, sizeof(VERSION));
+        memcpy(header + 6, &ENDIAN_MARKER, sizeof(ENDIAN_MARKER));
+        if(!s->file.writeAt(header, HEADER_SIZE, 0))
+            return nullptr;
+        s->bytes = HEADER_SIZE;
+        return s;
+    }
+
+    bool EmployeeLog::replay_(Segment& s)
+    {
+        std::optional<uint64_t> size = s.file.getFileSize64();
+        if(!size.has_value())
+            return false;
+        // A crash right after creation can leave a segment without a header; it holds nothing
+        if(size.value() < HEADER_SIZE)
+            return true;
+
+        char header[HEADER_SIZE];
+        uint32_t magic;
+        uint16_t version, marker;
+        if(!s.file.readAt(header, HEADER_SIZE, 0))
+            return false;
+        memcpy(&magic, header, sizeof(magic));
+        memcpy(&version, header + 4, sizeof(version));
+        memcpy(&marker, header + 6, sizeof(marker));
+        if(MAGIC != magic || 0 == version || version > VERSION || ENDIAN_MARKER != marker)
+            return false;
+
+        s.bytes = HEADER_SIZE;
+        BufferedReader in(s.file, HEADER_SIZE, size.value());
+        while(const char* p = in.peek(ENTRY_SIZE))
+        {
+            // Stop at the first torn or damaged entry; later bytes are never trusted
+            uint64_t lsn = decode(p);
+            if(0 == lsn)
+                break;
+            Location& loc = index_[entry_id(p)];
+            if(lsn > loc.lsn)
+            {
+                if(0 != loc.lsn)
+                    segments_[loc.segment]->live--;
+                else
+                    stats_.live++;
+                loc.lsn = lsn;
+                loc.segment = s.seq;
+                loc.offset = s.bytes;
+                loc.hours = Employee::Schema::read<Employee::FIELD_HOURS>(p + RECORD_OFFSET);
+                s.live++;
+            }
+            next_lsn_ = std::max(next_lsn_, lsn + 1);
+            s.entries++;
+            s.bytes += ENTRY_SIZE;
+            in.skip(ENTRY_SIZE);
+        }
+        return true;
+    }
+
+    bool EmployeeLog::rotate_()
+    {
+        std::unique_ptr<Segment> s = create_segment_(next_segment_);
+        if(!s || !flush_())
+            return false;
+        next_segment_++;
+        active_ = s.get();
+        segments_.emplace(active_->seq, std::move(s));
+        writer_.emplace(active_->file, HEADER_SIZE, opts_.buffer_size);
+        flushed_ = HEADER_SIZE;
+        return true;
+    }
+
+    bool EmployeeLog::append_(const Employee& e)
+    {
+        if(!open_ || !writer_->good())
+            return false;
+        if(writer_->offset() + ENTRY_SIZE > opts_.segment_bytes && 0 != active_->entries && !rotate_())
+            return false;
+
+        char entry[ENTRY_SIZE];
+        const uint64_t offset = writer_->offset();
+        encode(entry, next_lsn_, e);
+        if(!writer_->write(entry, ENTRY_SIZE))
+            return false;
+
+        Location& loc = index_[e.id()];
+        if(0 != loc.lsn)
+        {
+            segments_[loc.segment]->live--;
+            if(nullptr != aggregate_)
+                aggregate_->update(loc.hours, e.hours());
+        }
+        else
+        {
+            stats_.live++;
+            if(nullptr != aggregate_)
+                aggregate_->insert(e.hours());
+        }
+        loc.lsn = next_lsn_++;
+        loc.segment = active_->seq;
+        loc.offset = offset;
+        loc.hours = e.hours();
+        if(nullptr != aggregate_)
+            aggregate_->set_stamp(loc.lsn);
+        active_->entries++;
+        active_->live++;
+        active_->bytes = writer_->offset();
+        stats_.appended++;
+        return true;
+    }
+
+    bool EmployeeLog::flush_()
+    {
+        if(!open_)
+            return false;
+        bool ok = writer_->flush();
+        flushed_ = writer_->offset();
+        return ok;
+    }
+
+    std::optional<Employee> EmployeeLog::read_(const Location& loc) const
+    {
+        auto it = segments_.find(loc.segment);
+        char entry[ENTRY_SIZE];
+        if(segments_.end() == it || !it->second->file.readAt(entry, ENTRY_SIZE, loc.offset)
+            || loc.lsn != decode(entry))
+            return std::nullopt;
+        return Employee::deserialize(entry + RECORD_OFFSET);
+    }
+
+    bool EmployeeLog::is_open() const noexcept
+    { return open_; }
+
+    bool EmployeeLog::put(const Employee& e)
+    {
+        return put(&e, 1);
+    }
+
+    bool EmployeeLog::put(const Employee* src, size_t n)
+    {
+        AcquireSRWLockExclusive(&lock_);
+        bool ok = true;
+        for(size_t i = 0; ok && i < n; i++)
+            ok = append_(src[i]);
+        ReleaseSRWLockExclusive(&lock_);
+        return ok;
+    }
+
+    bool EmployeeLog::set_hours(Employee::ID_TYPE id, double hours)
+    {
+        AcquireSRWLockExclusive(&lock_);
+        Location loc = index_[id];
+        bool ok = open_ && 0 != loc.lsn;
+        if(ok && loc.segment == active_->seq && loc.offset + ENTRY_SIZE > flushed_)
+            ok = flush_();
+        std::optional<Employee> e;
+        if(ok)
+            e = read_(loc);
+        if(e.has_value())
+        {
+            e->hours() = hours;
+            ok = append_(e.value());
+        }
+        ReleaseSRWLockExclusive(&lock_);
+        return ok && e.has_value();
+    }
+
+    std::optional<Employee> EmployeeLog::get(Employee::ID_TYPE id)
+    {
+        AcquireSRWLockShared(&lock_);
+        Location loc = index_[id];
+        bool buffered = open_ && 0 != loc.lsn && loc.segment == active_->seq && loc.offset + ENTRY_SIZE > flushed_;
+        std::optional<Employee> e;
+        if(0 != loc.lsn && !buffered)
+            e = read_(loc);
+        ReleaseSRWLockShared(&lock_);
+        if(!buffered)
+            return e;
+
+        // The entry is still in the write buffer; push it out first
+        AcquireSRWLockExclusive(&lock_);
+        loc = index_[id];
+        if(0 != loc.lsn && flush_())
+            e = read_(loc);
+        ReleaseSRWLockExclusive(&lock_);
+        return e;
+    }
+
+    bool EmployeeLog::contains(Employee::ID_TYPE id) const noexcept
+    {
+        AcquireSRWLockShared(&lock_);
+        bool found = 0 != index_[id].lsn;
+        ReleaseSRWLockShared(&lock_);
+        return found;
+    }
+
+    bool EmployeeLog::flush()
+    {
+        AcquireSRWLockExclusive(&lock_);
+        bool ok = flush_();
+        ReleaseSRWLockExclusive(&lock_);
+        return ok;
+    }
+
+    EmployeeLogStats EmployeeLog::stats() const
+    {
+        AcquireSRWLockShared(&lock_);
+        EmployeeLogStats s = stats_;
+        s.segments = segments_.size();
+        ReleaseSRWLockShared(&lock_);
+        return s;
+    }
+
+    void EmployeeLog::attach(HoursAggregate* aggregate)
+    {
+        AcquireSRWLockExclusive(&lock_);
+        aggregate_ = aggregate;
+        if(nullptr != aggregate_)
+        {
+            aggregate_->clear();
+            for(const Location& loc : index_)
+                if(0 != loc.lsn)
+                    aggregate_->insert(loc.hours);
+            aggregate_->set_stamp(next_lsn_ - 1);
+        }
+        ReleaseSRWLockExclusive(&lock_);
+    }
+
+    GroupStats EmployeeLog::hours_stats() const
+    {
+        AcquireSRWLockShared(&lock_);
+        GroupStats s = nullptr != aggregate_ ? aggregate_->stats() : GroupStats();
+        ReleaseSRWLockShared(&lock_);
+        return s;
+    }
+
+    // --- Compaction ---
+
+    bool EmployeeLog::compact()
+    {
+        if(!open_)
+            return false;
+        AcquireSRWLockExclusive(&compact_lock_);
+        bool ok = compact_();
+        ReleaseSRWLockExclusive(&compact_lock_);
+        return ok;
+    }
+
+    bool EmployeeLog::compact_()
+    {
+        // Sealed segments never change and only this pass deletes them, so
+        // the pointers stay valid after the lock is released
+        std::vector<Segment*> victims;
+        uint64_t planned = HEADER_SIZE;
+        AcquireSRWLockShared(&lock_);
+        for(auto& [seq, s] : segments_)
+        {
+            if(s.get() == active_
+                || (0 != s->entries && double(s->live) > opts_.compact_threshold * double(s->entries)))
+                continue;
+            uint64_t need = s->live * ENTRY_SIZE;
+            if(!victims.empty() && planned + need > opts_.segment_bytes)
+                break;
+            victims.push_back(s.get());
+            planned += need;
+        }
+        ReleaseSRWLockShared(&lock_);
+        if(victims.empty())
+            return true;
+
+        // A live entry copied out of a victim; `to` holds its index in the
+        // chunk until the entry is written, then its offset in the new segment
+        struct Moved
+        {
+            Employee::ID_TYPE id;
+            uint64_t lsn;
+            uint64_t from;
+            uint64_t to;
+        };
+        std::vector<Moved> moved;
+        std::unique_ptr<Segment> out;
+        std::optional<BufferedWriter> out_writer;
+        auto abandon = [&]() {
+            out_writer.reset();
+            if(out)
+            {
+                out->file.close();
+                DeleteFileA(path_(out->seq).c_str());
+            }
+            return false;
+        };
+
+        std::vector<char> chunk;
+        for(Segment* v : victims)
+        {
+            for(uint64_t offset = HEADER_SIZE; offset + ENTRY_SIZE <= v->bytes; )
+            {
+                size_t n = static_cast<size_t>(std::min<uint64_t>(COMPACT_CHUNK_ENTRIES, (v->bytes - offset) / ENTRY_SIZE));
+                chunk.resize(n * ENTRY_SIZE);
+                if(!v->file.readAt(chunk.data(), static_cast<DWORD>(chunk.size()), offset))
+                    return abandon();
+
+                // Liveness is decided under the lock, the copy happens outside it
+                const size_t first = moved.size();
+                AcquireSRWLockShared(&lock_);
+                for(size_t i = 0; i < n; i++)
+                {
+                    const char* p = chunk.data() + i * ENTRY_SIZE;
+                    const Location& loc = index_[entry_id(p)];
+                    uint64_t lsn;
+                    memcpy(&lsn, p + LSN_OFFSET, sizeof(lsn));
+                    if(loc.lsn == lsn && loc.segment == v->seq && loc.offset == offset + i * ENTRY_SIZE)
+                        moved.push_back({ entry_id(p), lsn, v->seq, i });
+                }
+                ReleaseSRWLockShared(&lock_);
+
+                for(size_t k = first; k < moved.size(); k++)
+                {
+                    if(!out)
+                    {
+                        AcquireSRWLockExclusive(&lock_);
+                        uint64_t seq = next_segment_++;
+                        ReleaseSRWLockExclusive(&lock_);
+                        out = create_segment_(seq);
+                        if(!out)
+                            return abandon();
+                        out_writer.emplace(out->file, HEADER_SIZE, opts_.buffer_size);
+                    }
+                    const char* p = chunk.data() + moved[k].to * ENTRY_SIZE;
+                    moved[k].to = out_writer->offset();
+                    if(!out_writer->write(p, ENTRY_SIZE))
+                        return abandon();
+                }
+                offset += n * ENTRY_SIZE;
+            }
+        }
+        if(out_writer.has_value() && !out_writer->flush())
+            return abandon();
+        out_writer.reset();
+
+        // Install: repoint entries nobody overwrote meanwhile, then drop the victims
+        std::vector<std::unique_ptr<Segment>> dropped;
+        AcquireSRWLockExclusive(&lock_);
+        uint64_t freed = 0;
+        if(out)
+        {
+            out->bytes = HEADER_SIZE + moved.size() * ENTRY_SIZE;
+            out->entries = moved.size();
+            for(const Moved& m : moved)
+            {
+                Location& loc = index_[m.id];
+                if(loc.lsn == m.lsn && loc.segment == m.from)
+                {
+                    loc.segment = out->seq;
+                    loc.offset = m.to;
+                    out->live++;
+                }
+            }
+        }
+        for(Segment* v : victims)
+        {
+            freed += v->bytes;
+            auto it = segments_.find(v->seq);
+            dropped.push_back(std::move(it->second));
+            segments_.erase(it);
+        }
+        if(out)
+        {
+            freed -= out->bytes;
+            segments_.emplace(out->seq, std::move(out));
+        }
+        stats_.reclaimed_bytes += freed;
+        stats_.compactions++;
+        ReleaseSRWLockExclusive(&lock_);
+
+        bool ok = true;
+        for(std::unique_ptr<Segment>& d : dropped)
+        {
+            d->file.close();
+            ok = DeleteFileA(path_(d->seq).c_str()) && ok;
+        }
+        return ok;
+    }
+
+    DWORD WINAPI EmployeeLog::compactor_main_(LPVOID self)
+    {
+        EmployeeLog* log = static_cast<EmployeeLog*>(self);
+        AcquireSRWLockExclusive(&log->lock_);
+        while(!log->stop_)
+        {
+            SleepConditionVariableSRW(&log->wake_, &log->lock_, log->opts_.compact_interval_ms, 0);
+            if(log->stop_)
+                break;
+            ReleaseSRWLockExclusive(&log->lock_);
+            log->compact();
+            AcquireSRWLockExclusive(&log->lock_);
+        }
+        ReleaseSRWLockExclusive(&log->lock_);
+        return 0;
+    }
+
+} // namespace core::General
@@ -0,0 +1,396 @@
+/**
+ * @file EmployeeRing.cpp
+ * @brief Implementation of the shared-memory Employee ring.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/EmployeeRing.h>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <new>
+
+namespace core::General
+{
+    struct EmployeeRing::Control
+    {
+        std::atomic<uint32_t> magic;               /**< Stored last by the creator. */
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t record_size;
+
+        alignas(64) std::atomic<uint64_t> tail;    /**< Written by the producer only. */
+        alignas(64) std::atomic<uint64_t> head;    /**< Claimed by consumers. */
+        alignas(64) std::atomic<uint32_t> closed;
+        std::atomic<uint32_t> consumers_waiting;   /**< Touched only on the slow path. */
+        alignas(64) std::atomic<uint32_t> producer_waiting;
+    };
+
+    struct EmployeeRing::Slot
+    {
+        std::atomic<uint32_t> seq;   /**< pos + 1 once published, pos + capacity once consumed. */
+        char record[RECORD_SIZE];
+    };
+
+    namespace
+    {
+        constexpr size_t CONTROL_SIZE = 5 * 64;   // Control rounded to whole cache lines
+    } // namespace
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+                  "Shared counters must be lock-free to work across processes");
+
+    EmployeeRing::EmployeeRing() noexcept
+        : hMapping_(nullptr), hData_(nullptr), hSpace_(nullptr), control_(nullptr), slots_(nullptr),
+          mask_(0), tail_(0), wait_(RingWait::block), producer_(false)
+    {
+    }
+
+    EmployeeRing::EmployeeRing(EmployeeRing&& other) noexcept
+        : hMapping_(other.hMapping_), hData_(other.hData_), hSpace_(other.hSpace_),
+          control_(other.control_), slots_(other.slots_), mask_(other.mask_), tail_(other.tail_),
+          wait_(other.wait_), producer_(other.producer_)
+    {
+        other.hMapping_ = other.hData_ = other.hSpace_ = nullptr;
+        other.control_ = nullptr;
+        other.slots_ = nullptr;
+    }
+
+    EmployeeRing& EmployeeRing::operator=(EmployeeRing&& other) noexcept
+    {
+        if(&other != this)
+        {
+            detach_();
+            hMapping_ = other.hMapping_;
+            hData_ = other.hData_;
+            hSpace_ = other.hSpace_;
+            control_ = other.control_;
+            slots_ = other.slots_;
+            mask_ = other.mask_;
+            tail_ = other.tail_;
+            wait_ = other.wait_;
+            producer_ = other.producer_;
+            other.hMapping_ = other.hData_ = other.hSpace_ = nullptr;
+            other.control_ = nullptr;
+            other.slots_ = nullptr;
+        }
+        return *this;
+    }
+
+    EmployeeRing::~EmployeeRing() noexcept
+    {
+        detach_();
+    }
+
+    void EmployeeRing::detach_() noexcept
+    {
+        if(producer_)
+            close();
+        if(nullptr != control_)
+            UnmapViewOfFile(control_);
+        if(nullptr != hMapping_)
+            CloseHandle(hMapping_);
+        if(nullptr != hData_)
+            CloseHandle(hData_);
+        if(nullptr != hSpace_)
+            CloseHandle(hSpace_);
+        hMapping_ = hData_ = hSpace_ = nullptr;
+        control_ = nullptr;
+        slots_ = nullptr;
+    }
+
+    std::optional<EmployeeRing> EmployeeRing::attach_(HANDLE mapping, const std::string& name,
+                                                      bool producer, RingWait wait) noexcept
+    {
+        EmployeeRing ring;
+        ring.hMapping_ = mapping;
+        ring.wait_ = wait;
+        ring.producer_ = producer;
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        if(nullptr == view)
+            return std::nullopt;
+        ring.control_ = static_cast<Control*>(view);
+        ring.slots_ = reinterpret_cast<Slot*>(static_cast<char*>(view) + CONTROL_SIZE);
+
+        // Either side may come first; CreateEvent opens the event if it already exists
+        ring.hData_ = CreateEventA(nullptr, FALSE, FALSE, (name + "-data").c_str());
+        ring.hSpace_ = CreateEventA(nullptr, FALSE, FALSE, (name + "-space").c_str());
+        if(nullptr == ring.hData_ || nullptr == ring.hSpace_)
+            return std::nullopt;
+        return ring;
+    }
+
+    std::optional<EmployeeRing> EmployeeRing::create(const char* name, uint32_t capacity, RingWait wait) noexcept
+    {
+        static_assert(sizeof(Control) <= CONTROL_SIZE && sizeof(Slot) == SLOT_SIZE, "Shared layout mismatch");
+        if(nullptr == name || capacity > MAX_CAPACITY)
+            return std::nullopt;
+        uint32_t slots = 2;
+        while(slots < capacity)
+            slots <<= 1;
+
+        const uint64_t bytes = CONTROL_SIZE + uint64_t(slots) * SLOT_SIZE;
+        SetLastError(ERROR_SUCCESS);
+        HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                            static_cast<DWORD>(bytes >> 32), static_cast<DWORD>(bytes), name);
+        if(nullptr == mapping)
+            return std::nullopt;
+        if(ERROR_ALREADY_EXISTS == GetLastError())
+        {
+            // Someone else's ring; re-initializing it would corrupt their stream
+            CloseHandle(mapping);
+            return std::nullopt;
+        }
+
+        std::optional<EmployeeRing> ring = attach_(mapping, name, true, wait);
+        if(!ring.has_value())
+            return std::nullopt;
+
+        Control* c = new (ring->control_) Control();
+        c->version = VERSION;
+        c->capacity = slots;
+        c->record_size = RECORD_SIZE;
+        for(uint32_t i = 0; i < slots; i++)
+        {
+            Slot* s = new (reinterpret_cast<char*>(ring->slots_) + size_t(i) * SLOT_SIZE) Slot();
+            s->seq.store(i, std::memory_order_relaxed);
+        }
+        ring->mask_ = slots - 1;
+        c->magic.store(MAGIC, std::memory_order_release);
+        return ring;
+    }
+
+    std::optional<EmployeeRing> EmployeeRing::open(const char* name, RingWait wait) noexcept
+    {
+        if(nullptr == name)
+            return std::nullopt;
+        HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+        if(nullptr == mapping)
+            return std::nullopt;
+
+        std::optional<EmployeeRing> ring = attach_(mapping, name, false, wait);
+        if(!ring.has_value())
+            return std::nullopt;
+
+        const Control* c = ring->control_;
+        if(MAGIC != c->magic.load(std::memory_order_acquire) || VERSION != c->version
+            || RECORD_SIZE != c->record_size || c->capacity < 2 || c->capacity > MAX_CAPACITY
+            || 0 != (c->capacity & (c->capacity - 1)))
+            return std::nullopt;
+        ring->mask_ = c->capacity - 1;
+        return ring;
+    }
+
+    template <class Ready>
+    void EmployeeRing::wait_until_(Ready&& ready, bool consumer) const noexcept
+    {
+        for(uint32_t i = 0; i < SPIN_COUNT; i++)
+        {
+            if(ready())
+                return;
+            YieldProcessor();
+        }
+        if(RingWait::spin == wait_)
+        {
+            while(!ready())
+                SwitchToThread();
+            return;
+        }
+
+        std::atomic<uint32_t>& waiters = consumer ? control_->consumers_waiting : control_->producer_waiting;
+        HANDLE event = consumer ? hData_ : hSpace_;
+        for(;;)
+        {
+            // Announce the sleep before the last check; a publisher that misses
+            // the check is then sure to see the count and set the event
+            waiters.fetch_add(1);
+            if(!ready())
+                WaitForSingleObject(event, WAIT_SLICE_MS);
+            waiters.fetch_sub(1);
+            if(ready())
+            {
+                // An auto-reset event wakes one sleeper; pass it on while others still sleep
+                if(0 != waiters.load())
+                    SetEvent(event);
+                return;
+            }
+        }
+    }
+
+    bool EmployeeRing::readable_() const noexcept
+    {
+        uint64_t pos = control_->head.load(std::memory_order_relaxed);
+        return slots_[pos & mask_].seq.load(std::memory_order_acquire) == uint32_t(pos + 1)
+            || 0 != control_->closed.load(std::memory_order_acquire);
+    }
+
+    bool EmployeeRing::writable_() const noexcept
+    {
+        return slots_[tail_ & mask_].seq.load(std::memory_order_acquire) == uint32_t(tail_)
+            || 0 != control_->closed.load(std::memory_order_acquire);
+    }
+
+    bool EmployeeRing::put_(const char* record) noexcept
+    {
+        Slot& s = slots_[tail_ & mask_];
+        if(s.seq.load(std::memory_order_acquire) != uint32_t(tail_))
+            return false;
+        memcpy(s.record, record, RECORD_SIZE);
+        s.seq.store(uint32_t(tail_ + 1), std::memory_order_release);
+        tail_++;
+        control_->tail.store(tail_, std::memory_order_relaxed);
+        return true;
+    }
+
+    void EmployeeRing::signal_data_() noexcept
+    {
+        // Pairs with the waiter's increment-then-check in wait_until_()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(0 != control_->consumers_waiting.load(std::memory_order_relaxed))
+            SetEvent(hData_);
+    }
+
+    bool EmployeeRing::try_push(const char* record) noexcept
+    {
+        if(!producer_ || closed() || !put_(record))
+            return false;
+        signal_data_();
+        return true;
+    }
+
+    bool EmployeeRing::push(const char* record) noexcept
+    {
+        return push_records(record, 1);
+    }
+
+    bool EmployeeRing::push(const Employee& e) noexcept
+    {
+        std::array<char, RECORD_SIZE> buf = e.serialize();
+        return push_records(buf.data(), 1);
+    }
+
+    bool EmployeeRing::push_records(const char* records, size_t n) noexcept
+    {
+        if(!producer_ || nullptr == control_)
+            return false;
+        size_t done = 0;
+        while(done < n)
+        {
+            if(closed())
+                return false;
+            size_t run = 0;
+            while(done + run < n && put_(records + (done + run) * RECORD_SIZE))
+                run++;
+            if(0 != run)
+            {
+                signal_data_();
+                done += run;
+                continue;
+            }
+            wait_until_([this] { return writable_(); }, false);
+        }
+        return true;
+    }
+
+    void EmployeeRing::close() noexcept
+    {
+        if(!producer_ || nullptr == control_)
+            return;
+        control_->closed.store(1, std::memory_order_release);
+        SetEvent(hData_);
+        SetEvent(hSpace_);
+    }
+
+    bool EmployeeRing::try_pop(char* record) noexcept
+    {
+        return 1 == take_(record, 1);
+    }
+
+    size_t EmployeeRing::take_(char* out, size_t max) noexcept
+    {
+        if(nullptr == control_ || 0 == max)
+            return 0;
+        uint64_t pos = control_->head.load(std::memory_order_relaxed);
+        for(;;)
+        {
+            // Records are published in order, so a ready run can be claimed with one exchange
+            size_t run = 0;
+            while(run < max && run <= mask_
+                  && slots_[(pos + run) & mask_].seq.load(std::memory_order_acquire) == uint32_t(pos + run + 1))
+                run++;
+            if(0 == run)
+            {
+                // Empty, unless another consumer moved the head since it was read
+                uint64_t now = control_->head.load(std::memory_order_relaxed);
+                if(now == pos)
+                    return 0;
+                pos = now;
+                continue;
+            }
+            if(!control_->head.compare_exchange_weak(pos, pos + run, std::memory_order_relaxed))
+                continue;
+
+            for(size_t i = 0; i < run; i++)
+            {
+                Slot& s = slots_[(pos + i) & mask_];
+                memcpy(out + i * RECORD_SIZE, s.record, RECORD_SIZE);
+                s.seq.store(uint32_t(pos + i + mask_ + 1), std::memory_order_release);
+            }
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(0 != control_->producer_waiting.load(std::memory_order_relaxed))
+                SetEvent(hSpace_);
+            return run;
+        }
+    }
+
+    bool EmployeeRing::pop(char* record) noexcept
+    {
+        return 1 == pop_records(record, 1);
+    }
+
+    bool EmployeeRing::pop(Employee& e) noexcept
+    {
+        char buf[RECORD_SIZE];
+        if(!pop(buf))
+            return false;
+        e = Employee::deserialize(buf);
+        return true;
+    }
+
+    size_t EmployeeRing::pop_records(char* out, size_t max) noexcept
+    {
+        if(nullptr == control_ || 0 == max)
+            return 0;
+        for(;;)
+        {
+            size_t n = take_(out, max);
+            if(0 != n)
+                return n;
+            // Everything published before close() is visible once closed is seen
+            if(closed())
+                return take_(out, max);
+            wait_until_([this] { return readable_(); }, true);
+        }
+    }
+
+    bool EmployeeRing::is_producer() const noexcept
+    { return producer_; }
+
+    bool EmployeeRing::closed() const noexcept
+    { return nullptr == control_ || 0 != control_->closed.load(std::memory_order_acquire); }
+
+    uint32_t EmployeeRing::capacity() const noexcept
+    { return static_cast<uint32_t>(mask_ + 1); }
+
+    uint64_t EmployeeRing::size() const noexcept
+    {
+        if(nullptr == control_)
+            return 0;
+        uint64_t head = control_->head.load(std::memory_order_relaxed);
+        uint64_t tail = control_->tail.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+} // namespace core::General
@@ -0,0 +1,361 @@
+/**
+ * @file EmployeeStore.cpp
+ * @brief Implementation of in-place record updates for Employee files.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/EmployeeStore.h>
+#include <core/General/AlignedEmployee.h>
+#include <core/General/Checksum.h>
+#include <algorithm>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t INDEX_BATCH_RECORDS = 65536;   // Records per read while building the index
+        constexpr size_t INDEX_SIZE = size_t(Employee::ID_MAX) + 1;
+    } // namespace
+
+    EmployeeStore::EmployeeStore(const File& file, const EmployeeFileReader& reader) noexcept
+        : file_(&file), reader_(reader), any_dirty_(false), aggregate_(nullptr)
+    {
+        typedef Employee::Schema S;
+        if(reader_.header().aligned_layout())
+        {
+            id_offset_ = static_cast<uint32_t>(offsetof(AlignedEmployee, id));
+            hours_offset_ = static_cast<uint32_t>(offsetof(AlignedEmployee, hours));
+            name_offset_ = static_cast<uint32_t>(offsetof(AlignedEmployee, name));
+        }
+        else
+        {
+            id_offset_ = static_cast<uint32_t>(S::offset<Employee::FIELD_ID>());
+            hours_offset_ = static_cast<uint32_t>(S::offset<Employee::FIELD_HOURS>());
+            name_offset_ = static_cast<uint32_t>(S::offset<Employee::FIELD_NAME>());
+        }
+        if(reader_.versioned())
+            dirty_.assign(static_cast<size_t>(reader_.header().block_count), false);
+    }
+
+    std::optional<EmployeeStore> EmployeeStore::open(const File& file) noexcept
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(file);
+        // Writes go out in host order, so a foreign file would end up mixed
+        if(!reader.has_value() || !reader->header().host_order)
+            return std::nullopt;
+        return EmployeeStore(file, reader.value());
+    }
+
+    EmployeeStore::EmployeeStore(EmployeeStore&& other) noexcept
+        : file_(other.file_), reader_(other.reader_),
+          id_offset_(other.id_offset_), hours_offset_(other.hours_offset_), name_offset_(other.name_offset_),
+          index_(std::move(other.index_)), counts_(std::move(other.counts_)),
+          dirty_(std::move(other.dirty_)), any_dirty_(other.any_dirty_),
+          aggregate_(other.aggregate_)
+    {
+        other.file_ = nullptr;
+        other.any_dirty_ = false;
+    }
+
+    EmployeeStore& EmployeeStore::operator=(EmployeeStore&& other) noexcept
+    {
+        if(&other != this)
+        {
+            flush();
+            file_ = other.file_;
+            reader_ = other.reader_;
+            id_offset_ = other.id_offset_;
+            hours_offset_ = other.hours_offset_;
+            name_offset_ = other.name_offset_;
+            index_ = std::move(other.index_);
+            counts_ = std::move(other.counts_);
+            dirty_ = std::move(other.dirty_);
+            any_dirty_ = other.any_dirty_;
+            aggregate_ = other.aggregate_;
+            other.file_ = nullptr;
+            other.any_dirty_ = false;
+        }
+        return *this;
+    }
+
+    EmployeeStore::~EmployeeStore() noexcept
+    {
+        flush();
+    }
+
+    uint64_t EmployeeStore::size() const noexcept
+    { return reader_.size(); }
+
+    const EmployeeFileReader& EmployeeStore::reader() const noexcept
+    { return reader_; }
+
+    void EmployeeStore::attach(HoursAggregate* aggregate) noexcept
+    { aggregate_ = aggregate; }
+
+    void EmployeeStore::touch_(uint64_t first, uint64_t last) noexcept
+    {
+        if(dirty_.empty())
+            return;
+        const uint32_t per_block = reader_.header().block_records;
+        for(uint64_t b = first / per_block; b <= last / per_block; b++)
+            dirty_[static_cast<size_t>(b)] = true;
+        any_dirty_ = true;
+    }
+
+    bool EmployeeStore::write_field_(uint64_t record, uint32_t offset, const void* value, size_t size) noexcept
+    {
+        if(nullptr == file_ || record >= reader_.size())
+            return false;
+        if(!file_->writeAt(static_cast<const char*>(value), static_cast<DWORD>(size),
+                           reader_.header().record_offset(record) + offset))
+            return false;
+        touch_(record, record);
+        return true;
+    }
+
+    std::optional<double> EmployeeStore::read_hours_(uint64_t record) const noexcept
+    {
+        double hours;
+        if(nullptr == file_ || record >= reader_.size()
+            || !file_->readAt(reinterpret_cast<char*>(&hours), sizeof(hours),
+                              reader_.header().record_offset(record) + hours_offset_))
+            return std::nullopt;
+        return hours;
+    }
+
+    // --- Id Index ---
+
+    bool EmployeeStore::build_index()
+    {
+        std::vector<uint64_t> index(INDEX_SIZE, 0);
+        std::vector<uint32_t> counts(INDEX_SIZE, 0);
+        std::vector<char> batch(INDEX_BATCH_RECORDS * Employee::SERIALIZED_SIZE);
+        for(uint64_t first = 0; first < reader_.size(); first += INDEX_BATCH_RECORDS)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(INDEX_BATCH_RECORDS, reader_.size() - first));
+            if(!reader_.read(first, n, batch.data()))
+                return false;
+            // Later records overwrite earlier ones, so the last occurrence wins
+            for(size_t i = 0; i < n; i++)
+            {
+                Employee::ID_TYPE id = Employee::Schema::read<Employee::FIELD_ID>(
+                    batch.data() + i * Employee::SERIALIZED_SIZE);
+                index[id] = first + i + 1;
+                counts[id]++;
+            }
+        }
+        index_.swap(index);
+        counts_.swap(counts);
+        return true;
+    }
+
+    bool EmployeeStore::reindex_(uint64_t record, Employee::ID_TYPE old_id, Employee::ID_TYPE new_id) noexcept
+    {
+        if(old_id == new_id)
+            return true;
+        counts_[old_id]--;
+        counts_[new_id]++;
+        if(index_[new_id] < record + 1)
+            index_[new_id] = record + 1;
+        if(index_[old_id] != record + 1)
+            return true;
+
+        // The indexed record was the last with old_id, so any other holder lies before it
+        index_[old_id] = 0;
+        if(0 == counts_[old_id])
+            return true;
+        std::vector<char> batch;
+        for(uint64_t end = record; end > 0; )
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(INDEX_BATCH_RECORDS, end));
+            const uint64_t first = end - n;
+            batch.resize(n * Employee::SERIALIZED_SIZE);
+            if(!reader_.read(first, n, batch.data()))
+                return false;
+            for(size_t i = n; i-- > 0; )
+            {
+                if(Employee::Schema::read<Employee::FIELD_ID>(batch.data() + i * Employee::SERIALIZED_SIZE) == old_id)
+                {
+                    index_[old_id] = first + i + 1;
+                    return true;
+                }
+            }
+            end = first;
+        }
+        return true;
+    }
+
+    bool EmployeeStore::indexed() const noexcept
+    { return !index_.empty(); }
+
+    std::optional<uint64_t> EmployeeStore::find(Employee::ID_TYPE id) const noexcept
+    {
+        if(index_.empty() || 0 == index_[id])
+            return std::nullopt;
+        return index_[id] - 1;
+    }
+
+    // --- Single-Record Access ---
+
+    std::optional<Employee> EmployeeStore::get(uint64_t record) const noexcept
+    {
+        return reader_.at(record);
+    }
+
+    bool EmployeeStore::set_hours(uint64_t record, double hours) noexcept
+    {
+        std::optional<double> old;
+        if(nullptr != aggregate_ && !(old = read_hours_(record)).has_value())
+            return false;
+        if(!write_field_(record, hours_offset_, &hours, sizeof(hours)))
+            return false;
+        if(old.has_value())
+            aggregate_->update(old.value(), hours);
+        return true;
+    }
+
+    bool EmployeeStore::set_id(uint64_t record, Employee::ID_TYPE id) noexcept
+    {
+        std::optional<Employee> old;
+        if(!index_.empty())
+        {
+            old = get(record);
+            if(!old.has_value())
+                return false;
+        }
+        if(!write_field_(record, id_offset_, &id, sizeof(id)))
+            return false;
+        return !old.has_value() || reindex_(record, old->id(), id);
+    }
+
+    bool EmployeeStore::set_name(uint64_t record, const char* name) noexcept
+    {
+        char buf[Employee::BUFF_SIZE] = {};
+        if(nullptr != name)
+            memcpy(buf, name, strnlen(name, Employee::BUFF_SIZE));
+        return write_field_(record, name_offset_, buf, sizeof(buf));
+    }
+
+    bool EmployeeStore::put(uint64_t record, const Employee& e) noexcept
+    {
+        std::optional<Employee> old;
+        if(!index_.empty() || nullptr != aggregate_)
+        {
+            old = get(record);
+            if(!old.has_value())
+                return false;
+        }
+
+        bool ok;
+        if(reader_.header().aligned_layout())
+        {
+            AlignedEmployee a = AlignedEmployee::from_employee(e);
+            ok = write_field_(record, 0, &a, sizeof(a));
+        }
+        else
+        {
+            std::array<char, Employee::SERIALIZED_SIZE> bytes = e.serialize();
+            ok = write_field_(record, 0, bytes.data(), bytes.size());
+        }
+        if(ok && nullptr != aggregate_)
+            aggregate_->update(old->hours(), e.hours());
+        if(ok && !index_.empty())
+            ok = reindex_(record, old->id(), e.id());
+        return ok;
+    }
+
+    bool EmployeeStore::set_hours_by_id(Employee::ID_TYPE id, double hours) noexcept
+    {
+        std::optional<uint64_t> record = find(id);
+        return record.has_value() && set_hours(record.value(), hours);
+    }
+
+    // --- Batched Updates ---
+
+    bool EmployeeStore::update_hours(std::vector<HoursUpdate> updates, HoursUpdateMode mode)
+    {
+        if(nullptr == file_)
+            return false;
+        for(const HoursUpdate& u : updates)
+            if(u.record >= reader_.size())
+                return false;
+
+        // Stable, so repeated records keep their submission order
+        std::stable_sort(updates.begin(), updates.end(),
+                         [](const HoursUpdate& a, const HoursUpdate& b) { return a.record < b.record; });
+
+        const uint32_t size = reader_.header().record_size;
+        std::vector<char> span;
+        std::vector<std::pair<double, double>> changes;   // (old, new) hours of the current span
+        for(size_t i = 0; i < updates.size(); )
+        {
+            // Grow the span while the next update is close and the span stays bounded
+            const uint64_t first = updates[i].record;
+            size_t j = i + 1;
+            while(j < updates.size() && updates[j].record - updates[j - 1].record <= MAX_GAP_RECORDS
+                  && updates[j].record - first < MAX_SPAN_RECORDS)
+                j++;
+            const uint64_t last = updates[j - 1].record;
+            const uint64_t offset = reader_.header().record_offset(first);
+
+            span.resize(static_cast<size_t>(last - first + 1) * size);
+            if(!file_->readAt(span.data(), static_cast<DWORD>(span.size()), offset))
+                return false;
+            changes.clear();
+            for(size_t k = i; k < j; k++)
+            {
+                char* field = span.data() + (updates[k].record - first) * size + hours_offset_;
+                double old;
+                memcpy(&old, field, sizeof(old));
+                double hours = HoursUpdateMode::add == mode ? old + updates[k].value : updates[k].value;
+                memcpy(field, &hours, sizeof(hours));
+                changes.emplace_back(old, hours);
+            }
+            if(!file_->writeAt(span.data(), static_cast<DWORD>(span.size()), offset))
+                return false;
+            touch_(first, last);
+            if(nullptr != aggregate_)
+                for(const auto& [old, hours] : changes)
+                    aggregate_->update(old, hours);
+            i = j;
+        }
+        return true;
+    }
+
+    bool EmployeeStore::flush()
+    {
+        if(nullptr == file_ || !any_dirty_)
+            return true;
+
+        const EmployeeFileHeader& h = reader_.header();
+        std::vector<char> block;
+        for(size_t b = 0; b < dirty_.size(); b++)
+        {
+            if(!dirty_[b])
+                continue;
+            uint64_t first = b * uint64_t(h.block_records);
+            size_t n = static_cast<size_t>(std::min<uint64_t>(h.block_records, h.record_count - first));
+            block.resize(n * h.record_size);
+            if(!file_->readAt(block.data(), static_cast<DWORD>(block.size()), h.record_offset(first)))
+                return false;
+            uint32_t crc = Checksum::crc32c(block.data(), block.size());
+            if(!file_->writeAt(reinterpret_cast<const char*>(&crc), sizeof(crc), h.table_offset + b * sizeof(crc)))
+                return false;
+            dirty_[b] = false;
+        }
+        any_dirty_ = false;
+
+        // The checksum table changed, so the attached aggregate now describes new content
+        if(nullptr != aggregate_)
+        {
+            std::optional<uint64_t> stamp = HoursAggregate::data_stamp(reader_);
+            if(!stamp.has_value())
+                return false;
+            aggregate_->set_stamp(stamp.value());
+        }
+        return true;
+    }
+
+} // namespace core::General
@@ -0,0 +1,297 @@
+/**
+ * @file ExternalSort.cpp
+ * @brief Implementation of the external merge sort.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/ExternalSort.h>
+#include <core/General/BufferedIO.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/LoserTree.h>
+#include <core/General/Parallel.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t RECORD = Employee::SERIALIZED_SIZE;
+        constexpr size_t MIN_SLICE_RECORDS = 4096;   // Below this a worker costs more than it saves
+        constexpr size_t STAGE_RECORDS = 4096;       // Records handed to EmployeeFileWriter at a time
+
+        /** @brief Sort handle for one record of the in-memory batch. */
+        struct SortItem
+        {
+            uint64_t prefix;   /**< RecordOrder::prefix() of the record. */
+            uint32_t index;    /**< Record position inside the batch. */
+        };
+
+        /** @brief Orders batch items by key, then by input position for stability. */
+        class ItemLess
+        {
+        private:
+            const char* batch_;
+            SortKey key_;
+
+        public:
+            ItemLess(const char* batch, SortKey key) noexcept
+                : batch_(batch), key_(key)
+            {
+            }
+
+            bool operator()(const SortItem& a, const SortItem& b) const noexcept
+            {
+                if(a.prefix != b.prefix)
+                    return a.prefix < b.prefix;
+                if(!RecordOrder::prefix_is_exact(key_))
+                {
+                    int c = RecordOrder::compare(batch_ + size_t(a.index) * RECORD,
+                                                 batch_ + size_t(b.index) * RECORD, key_);
+                    if(0 != c) return c < 0;
+                }
+                return a.index < b.index;
+            }
+        };
+
+        /**
+         * @brief Output with the BufferedWriter interface that appends to a versioned file.
+         *
+         * Records are staged and handed to the EmployeeFileWriter in chunks,
+         * which keeps the per-record cost of the merge loops at a memcpy.
+         */
+        class VersionedSink
+        {
+        private:
+            EmployeeFileWriter writer_;   /**< Destination file writer. */
+            std::vector<char> staged_;    /**< Records not yet appended. */
+            size_t used_;                 /**< Bytes used in staged_. */
+            bool ok_;                     /**< false after a failed append. */
+
+            bool drain_() noexcept
+            {
+                ok_ = ok_ && writer_.append_records(staged_.data(), used_ / RECORD);
+                used_ = 0;
+                return ok_;
+            }
+
+        public:
+            /** @brief Writes a new file with the layout and block size of @p like. */
+            VersionedSink(const File& file, const EmployeeFileHeader& like, size_t buffer_size)
+                : writer_(file, like.block_records, buffer_size, like.layout()),
+                  staged_(STAGE_RECORDS * RECORD), used_(0), ok_(true)
+            {
+            }
+
+            /** @brief Appends @p n bytes of whole records. */
+            bool write(const char* src, size_t n) noexcept
+            {
+                while(ok_ && 0 != n)
+                {
+                    size_t take = std::min(n, staged_.size() - used_);
+                    memcpy(staged_.data() + used_, src, take);
+                    used_ += take;
+                    src += take;
+                    n -= take;
+                    if(used_ == staged_.size())
+                        drain_();
+                }
+                return ok_;
+            }
+
+            bool good() const noexcept
+            { return ok_; }
+
+            /** @brief Appends the staged records and writes the checksum table and header. */
+            bool flush() noexcept
+            { return drain_() && writer_.finish(); }
+        };
+
+        /**
+         * @brief Sorts one in-memory batch on several workers and streams it to @p out.
+         *
+         * Only the 16-byte items move during the sort; each record is copied
+         * exactly once, straight from the batch into the writer.
+         */
+        template <class Sink>
+        bool write_sorted_batch(const char* batch, size_t n, SortKey key, size_t workers,
+                                std::vector<SortItem>& items, Sink& out)
+        {
+            items.resize(n);
+            ItemLess less(batch, key);
+
+            size_t slices = std::max<size_t>(1, std::min(workers, n / MIN_SLICE_RECORDS));
+            std::vector<size_t> bounds = Parallel::split(n, slices);
+            Parallel::run(slices, [&](size_t w) {
+                for(size_t i = bounds[w]; i < bounds[w + 1]; i++)
+                    items[i] = { RecordOrder::prefix(batch + i * RECORD, key), static_cast<uint32_t>(i) };
+                std::sort(items.begin() + bounds[w], items.begin() + bounds[w + 1], less);
+            });
+
+            // Merge the sorted slices; slice order equals input order, so ties stay stable
+            std::vector<size_t> pos(bounds.begin(), bounds.end() - 1);
+            std::vector<char> exhausted(slices);
+            for(size_t s = 0; s < slices; s++)
+                exhausted[s] = (pos[s] == bounds[s + 1]);
+
+            auto head_less = [&](size_t a, size_t b) { return less(items[pos[a]], items[pos[b]]); };
+            LoserTree<decltype(head_less)> tree(slices, head_less, exhausted);
+            while(!tree.empty())
+            {
+                size_t s = tree.top();
+                if(!out.write(batch + size_t(items[pos[s]].index) * RECORD, RECORD))
+                    return false;
+                tree.replace_top(++pos[s] == bounds[s + 1]);
+            }
+            return out.good();
+        }
+
+        /**
+         * @brief Merges the runs [bounds[first], bounds[last]) of @p src into @p out.
+         * @param bounds Record index where each run starts, plus the end of the last run.
+         */
+        template <class Sink>
+        bool merge_runs(const File& src, const std::vector<uint64_t>& bounds, size_t first, size_t last,
+                        SortKey key, size_t buffer_size, Sink& out)
+        {
+            size_t k = last - first;
+            std::vector<BufferedReader> readers;
+            std::vector<const char*> heads(k);
+            std::vector<char> exhausted(k);
+            readers.reserve(k);
+            for(size_t i = 0; i < k; i++)
+            {
+                readers.emplace_back(src, bounds[first + i] * RECORD, bounds[first + i + 1] * RECORD, buffer_size);
+                heads[i] = readers[i].peek(RECORD);
+                exhausted[i] = (nullptr == heads[i]);
+            }
+
+            auto head_less = [&](size_t a, size_t b) {
+                return RecordOrder::compare(heads[a], heads[b], key) < 0;
+            };
+            LoserTree<decltype(head_less)> tree(k, head_less, exhausted);
+            while(!tree.empty())
+            {
+                size_t i = tree.top();
+                if(!out.write(heads[i], RECORD))
+                    return false;
+                readers[i].skip(RECORD);
+                heads[i] = readers[i].peek(RECORD);
+                tree.replace_top(nullptr == heads[i]);
+            }
+
+            for(const BufferedReader& r : readers)
+                if(!r.good()) return false;
+            return out.good();
+        }
+
+        /**
+         * @brief Runs both phases over the records of @p reader.
+         * @param emit Called as emit(buffer_size, write) for the final output:
+         *             it opens a sink, passes it to write(sink) and finishes it.
+         */
+        template <class Emit>
+        bool sort_records(const EmployeeFileReader& reader, const ExternalSortOptions& options, Emit&& emit)
+        {
+            const uint64_t records = reader.size();
+            const size_t budget = std::max(options.memory_budget, ExternalSort::MIN_MEMORY_BUDGET);
+            const size_t io_buffer = std::max(options.io_buffer_size, ExternalSort::MIN_MERGE_BUFFER);
+            const size_t workers = Parallel::workers(options.threads);
+
+            // Phase one: a batch holds the raw records plus one SortItem per record
+            const size_t batch_records = std::min<size_t>(budget / (RECORD + sizeof(SortItem)), UINT32_MAX);
+            std::vector<char> batch(static_cast<size_t>(std::min<uint64_t>(batch_records, records)) * RECORD);
+            std::vector<SortItem> items;
+
+            if(records <= batch_records)
+            {
+                const size_t n = static_cast<size_t>(records);
+                if(0 != n && !reader.read(0, n, batch.data()))
+                    return false;
+                return emit(io_buffer, [&](auto& out) {
+                    return write_sorted_batch(batch.data(), n, options.key, workers, items, out);
+                });
+            }
+
+            File spill = File::openTemporary(options.temp_directory);
+            if(!spill.is_opened())
+                return false;
+
+            std::vector<uint64_t> runs = { 0 };
+            {
+                BufferedWriter out(spill, 0, io_buffer);
+                for(uint64_t done = 0; done < records; )
+                {
+                    size_t n = static_cast<size_t>(std::min<uint64_t>(batch_records, records - done));
+                    // The reader converts aligned and opposite-endian files to host compact records
+                    if(!reader.read(done, n, batch.data()))
+                        return false;
+                    if(!write_sorted_batch(batch.data(), n, options.key, workers, items, out))
+                        return false;
+                    done += n;
+                    runs.push_back(done);
+                }
+                if(!out.flush())
+                    return false;
+            }
+            batch = std::vector<char>();
+            items = std::vector<SortItem>();
+
+            // Phase two: give every run an equal share of the budget, keeping one share for output.
+            // If the shares would get too small, merge groups of runs in intermediate passes.
+            const size_t max_fan_in = std::max<size_t>(2, budget / ExternalSort::MIN_MERGE_BUFFER - 1);
+            File scratch;
+            while(runs.size() - 1 > max_fan_in)
+            {
+                if(!scratch.is_opened() && !(scratch = File::openTemporary(options.temp_directory)).is_opened())
+                    return false;
+
+                size_t share = std::min(io_buffer, budget / (max_fan_in + 1));
+                std::vector<uint64_t> merged = { 0 };
+                BufferedWriter out(scratch, 0, share);
+                for(size_t first = 0; first < runs.size() - 1; first += max_fan_in)
+                {
+                    size_t last = std::min(first + max_fan_in, runs.size() - 1);
+                    if(!merge_runs(spill, runs, first, last, options.key, share, out))
+                        return false;
+                    merged.push_back(out.offset() / RECORD);
+                }
+                if(!out.flush())
+                    return false;
+
+                runs.swap(merged);
+                File previous = std::move(spill);
+                spill = std::move(scratch);
+                scratch = std::move(previous);
+            }
+
+            size_t k = runs.size() - 1;
+            size_t share = std::max(ExternalSort::MIN_MERGE_BUFFER, std::min(io_buffer, budget / (k + 1)));
+            return emit(share, [&](auto& out) {
+                return merge_runs(spill, runs, 0, k, options.key, share, out);
+            });
+        }
+    } // namespace
+
+    bool ExternalSort::sort(const File& input, const File& output, const ExternalSortOptions& options)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(input);
+        if(!reader.has_value() || !output.is_opened())
+            return false;
+
+        // The output keeps the input's format: versioned files get a new header and checksums
+        if(reader->versioned())
+            return sort_records(*reader, options, [&](size_t buffer_size, auto&& write) {
+                VersionedSink out(output, reader->header(), buffer_size);
+                return write(out) && out.flush();
+            });
+        return sort_records(*reader, options, [&](size_t buffer_size, auto&& write) {
+            BufferedWriter out(output, 0, buffer_size);
+            return write(out) && out.flush();
+        });
+    }
+
+} // namespace core::General
@@ -6,6 +6,7 @@
  */
 
 #include <core/General/File.h>
+#include <algorithm>
 
 namespace core::General
 {
@@ -59,6 +60,11 @@ namespace core::General
         return INVALID_HANDLE_VALUE != hFile_ && nullptr != hFile_;
     }
 
+    HANDLE File::handle() const noexcept
+    {
+        return hFile_;
+    }
+
     bool File::write(const char* buf, DWORD size) const noexcept
     {
         DWORD dwBytesWritten = 0;
@@ -120,6 +126,26 @@ namespace core::General
         return File(hFile_);
     }
 
+    File File::openTemporary(LPCSTR lpDirectory)
+    {
+        char dir[MAX_PATH] = {};
+        if(nullptr == lpDirectory)
+        {
+            if(0 == GetTempPathA(MAX_PATH, dir))
+                return File();
+            lpDirectory = dir;
+        }
+
+        // GetTempFileNameA reserves a unique name by creating an empty file
+        char path[MAX_PATH] = {};
+        if(0 == GetTempFileNameA(lpDirectory, "tmp", 0, path))
+            return File();
+
+        // DELETE_ON_CLOSE hands cleanup to the OS, even if the process dies
+        return open(path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                    FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+    }
+
     std::optional<DWORD> File::getFilePointer() const noexcept
     {
         if(is_opened()) {
@@ -155,4 +181,88 @@ namespace core::General
         
         return std::nullopt;
     }
+
+    std::optional<uint64_t> File::getFileSize64() const noexcept
+    {
+        if(is_opened()) {
+            LARGE_INTEGER size;
+            if(!GetFileSizeEx(hFile_, &size))
+                return std::nullopt;
+            return static_cast<uint64_t>(size.QuadPart);
+        } 
+        
+        return std::nullopt;
+    }
+
+    bool File::readAt(char* buf, DWORD size, uint64_t offset) const noexcept
+    {
+        if(0 == size) return true;
+        if(!is_opened()) return false;
+
+        // The OVERLAPPED offset makes the read independent of the shared file pointer
+        OVERLAPPED ov = {};
+        ov.Offset = static_cast<DWORD>(offset);
+        ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        DWORD dwBytesRead = 0;
+        BOOL readFile = ReadFile(hFile_, buf, size, &dwBytesRead, &ov);
+        return (readFile && dwBytesRead == size);
+    }
+
+    bool File::writeAt(const char* buf, DWORD size, uint64_t offset) const noexcept
+    {
+        if(0 == size) return true;
+        if(!is_opened()) return false;
+
+        OVERLAPPED ov = {};
+        ov.Offset = static_cast<DWORD>(offset);
+        ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        DWORD dwBytesWritten = 0;
+        BOOL writeFile = WriteFile(hFile_, buf, size, &dwBytesWritten, &ov);
+        return (writeFile && dwBytesWritten == size);
+    }
+
+    bool File::lockRange(uint64_t offset, uint64_t length, bool exclusive, DWORD timeout_ms) const noexcept
+    {
+        if(0 == length || !is_opened()) return false;
+
+        OVERLAPPED ov = {};
+        ov.Offset = static_cast<DWORD>(offset);
+        ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        const DWORD lo = static_cast<DWORD>(length);
+        const DWORD hi = static_cast<DWORD>(length >> 32);
+        const DWORD mode = exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0;
+
+        // On a synchronous handle a blocking LockFileEx returns only once the range is granted
+        if(INFINITE == timeout_ms)
+            return FALSE != LockFileEx(hFile_, mode, 0, lo, hi, &ov);
+
+        const ULONGLONG deadline = GetTickCount64() + timeout_ms;
+        DWORD pause = 1;
+        for(;;)
+        {
+            if(LockFileEx(hFile_, mode | LOCKFILE_FAIL_IMMEDIATELY, 0, lo, hi, &ov))
+                return true;
+            // Anything but contention will not go away by waiting
+            if(ERROR_LOCK_VIOLATION != GetLastError())
+                return false;
+
+            const ULONGLONG now = GetTickCount64();
+            if(now >= deadline)
+                return false;
+            Sleep(static_cast<DWORD>(std::min<ULONGLONG>(pause, deadline - now)));
+            pause = std::min<DWORD>(pause * 2, LOCK_POLL_MAX_MS);
+        }
+    }
+
+    bool File::unlockRange(uint64_t offset, uint64_t length) const noexcept
+    {
+        if(0 == length || !is_opened()) return false;
+
+        OVERLAPPED ov = {};
+        ov.Offset = static_cast<DWORD>(offset);
+        ov.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        return FALSE != UnlockFileEx(hFile_, 0, static_cast<DWORD>(length), static_cast<DWORD>(length >> 32), &ov);
+    }
 } // core::General
\ No newline at end of file
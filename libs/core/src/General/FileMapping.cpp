@@ -0,0 +1,91 @@
+/**
+ * @file FileMapping.cpp
+ * @brief Implementation of the read-only file mapping wrapper.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/FileMapping.h>
+#include <cstdint>
+
+namespace core::General
+{
+    FileMapping::FileMapping(HANDLE mapping, const char* data, uint64_t size) noexcept
+        : hMapping_(mapping), data_(data), size_(size)
+    {
+    }
+
+    FileMapping::FileMapping() noexcept
+        : hMapping_(nullptr), data_(nullptr), size_(0)
+    {
+    }
+
+    FileMapping::FileMapping(FileMapping&& other) noexcept
+        : hMapping_(other.hMapping_), data_(other.data_), size_(other.size_)
+    {
+        other.hMapping_ = nullptr;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    FileMapping& FileMapping::operator=(FileMapping&& other) noexcept
+    {
+        if(&other != this)
+        {
+            close();
+            hMapping_ = other.hMapping_;
+            data_ = other.data_;
+            size_ = other.size_;
+            other.hMapping_ = nullptr;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    FileMapping::~FileMapping() noexcept
+    {
+        close();
+    }
+
+    FileMapping FileMapping::open(const File& file) noexcept
+    {
+        std::optional<uint64_t> size = file.getFileSize64();
+        // A zero-length mapping is an error in Win32, and the view must fit the address space
+        if(!size.has_value() || 0 == *size || *size > SIZE_MAX)
+            return FileMapping();
+
+        HANDLE mapping = CreateFileMappingA(file.handle(), nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(nullptr == mapping)
+            return FileMapping();
+
+        LPVOID view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(nullptr == view)
+        {
+            CloseHandle(mapping);
+            return FileMapping();
+        }
+        return FileMapping(mapping, static_cast<const char*>(view), *size);
+    }
+
+    void FileMapping::close() noexcept
+    {
+        if(nullptr != data_)
+            UnmapViewOfFile(data_);
+        if(nullptr != hMapping_)
+            CloseHandle(hMapping_);
+        hMapping_ = nullptr;
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    bool FileMapping::is_mapped() const noexcept
+    { return nullptr != data_; }
+
+    const char* FileMapping::data() const noexcept
+    { return data_; }
+
+    uint64_t FileMapping::size() const noexcept
+    { return size_; }
+
+} // namespace core::General
@@ -0,0 +1,212 @@
+/**
+ * @file GroupBy.cpp
+ * @brief Implementation of the hash group-by aggregator.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/GroupBy.h>
+#include <core/General/EmployeeView.h>
+#include <core/General/Parallel.h>
+#include <core/General/ParallelScan.h>
+#include <algorithm>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr unsigned INITIAL_SHIFT = 64 - 6;   // 64 slots
+
+        /** @brief One thread's private aggregate. */
+        struct Partial
+        {
+            GroupTable table;                  // Id and id-bucket groups
+            NameDictionary names;              // Local name codes
+            std::vector<GroupStats> by_code;   // Name groups indexed by local code
+        };
+
+        /** @brief Adds rows [0, n) given per-row field accessors. */
+        template <class Id, class Hours, class Name>
+        void accumulate(size_t n, Id id, Hours hours, Name name, const GroupByOptions& opts, Partial& p)
+        {
+            switch(opts.key)
+            {
+            case GroupKey::name:
+                for(size_t i = 0; i < n; i++)
+                {
+                    NameDictionary::Code code = p.names.intern(name(i));
+                    if(code == p.by_code.size())
+                        p.by_code.emplace_back();
+                    p.by_code[code].add(hours(i));
+                }
+                break;
+            case GroupKey::id:
+                for(size_t i = 0; i < n; i++)
+                    p.table.at(id(i)).add(hours(i));
+                break;
+            case GroupKey::id_bucket:
+            {
+                const uint64_t width = std::max<uint32_t>(opts.bucket_width, 1);
+                for(size_t i = 0; i < n; i++)
+                    p.table.at(id(i) - id(i) % width).add(hours(i));
+                break;
+            }
+            }
+        }
+
+        /** @brief Folds @p part into @p into; name codes of @p into are kept. */
+        void merge(Partial& into, const Partial& part, GroupKey key)
+        {
+            if(GroupKey::name != key)
+            {
+                into.table.merge(part.table);
+                return;
+            }
+            for(NameDictionary::Code c = 0; c < part.by_code.size(); c++)
+            {
+                NameDictionary::Code code = into.names.intern(part.names.name(c));
+                if(code == into.by_code.size())
+                    into.by_code.emplace_back();
+                into.by_code[code].merge(part.by_code[c]);
+            }
+        }
+
+        GroupByResult finish(Partial& total, GroupKey key)
+        {
+            GroupByResult result;
+            if(GroupKey::name != key)
+            {
+                result.rows = total.table.rows();
+                return result;
+            }
+            result.rows.reserve(total.by_code.size());
+            for(size_t c = 0; c < total.by_code.size(); c++)
+                result.rows.push_back({ c, total.by_code[c] });
+            result.names = std::move(total.names);
+            return result;
+        }
+    } // namespace
+
+    // --- GroupTable ---
+
+    GroupTable::GroupTable()
+        : slots_(size_t(1) << (64 - INITIAL_SHIFT), Slot{ 0, GroupStats() }), size_(0), shift_(INITIAL_SHIFT)
+    {
+    }
+
+    size_t GroupTable::probe_(uint64_t stored) const noexcept
+    {
+        const size_t mask = slots_.size() - 1;
+        // Fibonacci hashing: the top bits of the product are well mixed even for sequential keys
+        for(size_t i = static_cast<size_t>((stored * 0x9E3779B97F4A7C15ull) >> shift_); ; i = (i + 1) & mask)
+        {
+            uint64_t k = slots_[i].key;
+            if(0 == k || stored == k)
+                return i;
+        }
+    }
+
+    void GroupTable::grow_()
+    {
+        std::vector<Slot> old(slots_.size() * 2, Slot{ 0, GroupStats() });
+        old.swap(slots_);
+        shift_--;
+        for(const Slot& s : old)
+            if(0 != s.key)
+                slots_[probe_(s.key)] = s;
+    }
+
+    GroupStats& GroupTable::at(uint64_t key)
+    {
+        const uint64_t stored = key + 1;
+        size_t i = probe_(stored);
+        if(0 == slots_[i].key)
+        {
+            if(2 * (size_ + 1) > slots_.size())
+            {
+                grow_();
+                i = probe_(stored);
+            }
+            slots_[i].key = stored;
+            size_++;
+        }
+        return slots_[i].stats;
+    }
+
+    const GroupStats* GroupTable::find(uint64_t key) const noexcept
+    {
+        const Slot& s = slots_[probe_(key + 1)];
+        return 0 == s.key ? nullptr : &s.stats;
+    }
+
+    void GroupTable::merge(const GroupTable& other)
+    {
+        for(const Slot& s : other.slots_)
+            if(0 != s.key)
+                at(s.key - 1).merge(s.stats);
+    }
+
+    size_t GroupTable::size() const noexcept
+    { return size_; }
+
+    void GroupTable::clear() noexcept
+    {
+        std::fill(slots_.begin(), slots_.end(), Slot{ 0, GroupStats() });
+        size_ = 0;
+    }
+
+    std::vector<GroupRow> GroupTable::rows() const
+    {
+        std::vector<GroupRow> out;
+        out.reserve(size_);
+        for(const Slot& s : slots_)
+            if(0 != s.key)
+                out.push_back({ s.key - 1, s.stats });
+        std::sort(out.begin(), out.end(), [](const GroupRow& a, const GroupRow& b) { return a.key < b.key; });
+        return out;
+    }
+
+    // --- GroupBy ---
+
+    GroupByResult GroupBy::run(const EmployeeColumns& table, const GroupByOptions& opts)
+    {
+        uint64_t useful = (table.size() + MIN_ROWS_PER_THREAD - 1) / MIN_ROWS_PER_THREAD;
+        const size_t threads = static_cast<size_t>(
+            std::max<uint64_t>(1, std::min<uint64_t>(Parallel::workers(opts.threads), useful)));
+        std::vector<size_t> bounds = Parallel::split(table.size(), threads);
+        std::vector<Partial> partials(threads);
+        Parallel::run(threads, [&](size_t t) {
+            const size_t first = bounds[t];
+            accumulate(bounds[t + 1] - first,
+                       [&](size_t i) { return table.ids()[first + i]; },
+                       [&](size_t i) { return table.hours()[first + i]; },
+                       [&](size_t i) { return table.names()[first + i].data(); },
+                       opts, partials[t]);
+        });
+
+        for(size_t t = 1; t < threads; t++)
+            merge(partials[0], partials[t], opts.key);
+        return finish(partials[0], opts.key);
+    }
+
+    std::optional<GroupByResult> GroupBy::run(const File& file, const GroupByOptions& opts)
+    {
+        ParallelScanOptions scan;
+        scan.threads = opts.threads;
+        scan.batch_records = FILE_BATCH_ROWS;
+        std::optional<Partial> total = parallel_scan<Partial>(file,
+            [&](Partial& p, const EmployeeRecords& records, size_t n, uint64_t) {
+                accumulate(n,
+                           [&](size_t i) { return records[i].id(); },
+                           [&](size_t i) { return records[i].hours(); },
+                           [&](size_t i) { return records[i].name(); },
+                           opts, p);
+            },
+            [&](Partial& into, Partial&& part) { merge(into, part, opts.key); },
+            scan);
+        if(!total.has_value())
+            return std::nullopt;
+        return finish(*total, opts.key);
+    }
+
+} // namespace core::General
@@ -0,0 +1,287 @@
+/**
+ * @file HoursAggregate.cpp
+ * @brief Implementation of the incrementally maintained hours aggregate.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/HoursAggregate.h>
+#include <core/General/BufferedIO.h>
+#include <core/General/Checksum.h>
+#include <core/General/EmployeeFile.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t SCAN_BATCH_RECORDS = 65536;   // Records per read in from_file()
+
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t count;
+            uint64_t nan_count;
+            uint64_t distinct;
+            uint64_t stamp;
+            double sum;
+            double compensation;
+            uint32_t crc;        /**< CRC-32C of this header (crc zeroed) followed by the entries. */
+            uint32_t reserved;
+        };
+
+        struct Entry
+        {
+            double value;
+            uint64_t count;
+        };
+
+        constexpr uint64_t HEADER_SIZE = sizeof(Header);
+    } // namespace
+
+    HoursAggregate::HoursAggregate() noexcept
+        : count_(0), nan_count_(0), pos_inf_count_(0), neg_inf_count_(0), sum_(0.0), compensation_(0.0), stamp_(0)
+    {
+    }
+
+    void HoursAggregate::accumulate_(double value) noexcept
+    {
+        // Neumaier summation: keep the bits the larger operand pushes out
+        double t = sum_ + value;
+        if(std::fabs(sum_) >= std::fabs(value))
+            compensation_ += (sum_ - t) + value;
+        else
+            compensation_ += (value - t) + sum_;
+        sum_ = t;
+    }
+
+    void HoursAggregate::insert(double hours)
+    {
+        count_++;
+        if(std::isnan(hours))
+        {
+            nan_count_++;
+            return;
+        }
+        values_[hours]++;
+        // An infinity would leave NaN in the compensation for good, so it is only counted
+        if(std::isinf(hours))
+            (hours > 0 ? pos_inf_count_ : neg_inf_count_)++;
+        else
+            accumulate_(hours);
+    }
+
+    bool HoursAggregate::erase(double hours)
+    {
+        if(std::isnan(hours))
+        {
+            if(0 == nan_count_)
+                return false;
+            nan_count_--;
+            count_--;
+            return true;
+        }
+
+        auto it = values_.find(hours);
+        if(values_.end() == it)
+            return false;
+        if(0 == --it->second)
+            values_.erase(it);
+        count_--;
+        if(std::isinf(hours))
+            (hours > 0 ? pos_inf_count_ : neg_inf_count_)--;
+        else
+            accumulate_(-hours);
+        // Dropping back to nothing clears any residue the compensation could not absorb
+        if(values_.empty())
+            sum_ = compensation_ = 0.0;
+        return true;
+    }
+
+    bool HoursAggregate::update(double old_hours, double new_hours)
+    {
+        if(!erase(old_hours))
+            return false;
+        insert(new_hours);
+        return true;
+    }
+
+    void HoursAggregate::clear() noexcept
+    {
+        values_.clear();
+        count_ = nan_count_ = pos_inf_count_ = neg_inf_count_ = 0;
+        sum_ = compensation_ = 0.0;
+    }
+
+    uint64_t HoursAggregate::count() const noexcept
+    { return count_; }
+
+    double HoursAggregate::sum() const noexcept
+    {
+        if(0 != pos_inf_count_ && 0 != neg_inf_count_)
+            return std::numeric_limits<double>::quiet_NaN();
+        if(0 != pos_inf_count_)
+            return std::numeric_limits<double>::infinity();
+        if(0 != neg_inf_count_)
+            return -std::numeric_limits<double>::infinity();
+        return sum_ + compensation_;
+    }
+
+    std::optional<double> HoursAggregate::min() const noexcept
+    {
+        if(values_.empty())
+            return std::nullopt;
+        return values_.begin()->first;
+    }
+
+    std::optional<double> HoursAggregate::max() const noexcept
+    {
+        if(values_.empty())
+            return std::nullopt;
+        return values_.rbegin()->first;
+    }
+
+    std::optional<double> HoursAggregate::mean() const noexcept
+    {
+        if(count_ == nan_count_)
+            return std::nullopt;
+        return sum() / double(count_ - nan_count_);
+    }
+
+    GroupStats HoursAggregate::stats() const noexcept
+    {
+        GroupStats s;
+        s.count = count_;
+        s.hours_sum = sum();
+        if(!values_.empty())
+        {
+            s.hours_min = values_.begin()->first;
+            s.hours_max = values_.rbegin()->first;
+        }
+        return s;
+    }
+
+    uint64_t HoursAggregate::stamp() const noexcept
+    { return stamp_; }
+
+    void HoursAggregate::set_stamp(uint64_t stamp) noexcept
+    { stamp_ = stamp; }
+
+    std::optional<HoursAggregate> HoursAggregate::from_file(const File& data)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(data);
+        if(!reader.has_value())
+            return std::nullopt;
+
+        typedef Employee::Schema S;
+        HoursAggregate agg;
+        std::vector<char> batch(static_cast<size_t>(std::min<uint64_t>(SCAN_BATCH_RECORDS, reader->size()))
+                                * Employee::SERIALIZED_SIZE);
+        for(uint64_t first = 0; first < reader->size(); first += SCAN_BATCH_RECORDS)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(SCAN_BATCH_RECORDS, reader->size() - first));
+            if(!reader->read(first, n, batch.data()))
+                return std::nullopt;
+            for(size_t i = 0; i < n; i++)
+                agg.insert(S::read<Employee::FIELD_HOURS>(batch.data() + i * Employee::SERIALIZED_SIZE));
+        }
+        std::optional<uint64_t> stamp = data_stamp(reader.value());
+        if(!stamp.has_value())
+            return std::nullopt;
+        agg.stamp_ = stamp.value();
+        return agg;
+    }
+
+    std::optional<uint64_t> HoursAggregate::data_stamp(const File& data)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(data);
+        if(!reader.has_value())
+            return std::nullopt;
+        return data_stamp(reader.value());
+    }
+
+    std::optional<uint64_t> HoursAggregate::data_stamp(const EmployeeFileReader& reader)
+    {
+        std::optional<uint32_t> table = reader.table_checksum();
+        if(!table.has_value())
+            return std::nullopt;
+        return (uint64_t(table.value()) << 32) ^ reader.size();
+    }
+
+    bool HoursAggregate::write(const File& out) const
+    {
+        Header h = {};
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.count = count_;
+        h.nan_count = nan_count_;
+        h.distinct = values_.size();
+        h.stamp = stamp_;
+        h.sum = sum_;
+        h.compensation = compensation_;
+
+        uint32_t crc = Checksum::crc32c(&h, sizeof(h));
+        BufferedWriter w(out, HEADER_SIZE);
+        for(const auto& [value, count] : values_)
+        {
+            Entry e = { value, count };
+            crc = Checksum::crc32c(&e, sizeof(e), crc);
+            if(!w.write(reinterpret_cast<const char*>(&e), sizeof(e)))
+                return false;
+        }
+        h.crc = crc;
+        // Header last, so a torn checkpoint never validates
+        return w.flush() && out.writeAt(reinterpret_cast<const char*>(&h), sizeof(h), 0);
+    }
+
+    std::optional<HoursAggregate> HoursAggregate::read(const File& in)
+    {
+        Header h;
+        std::optional<uint64_t> size = in.getFileSize64();
+        if(!size.has_value() || size.value() < HEADER_SIZE || !in.readAt(reinterpret_cast<char*>(&h), sizeof(h), 0)
+            || MAGIC != h.magic || VERSION != h.version || h.nan_count > h.count
+            || h.distinct > (size.value() - HEADER_SIZE) / sizeof(Entry))
+            return std::nullopt;
+
+        const uint32_t stored = h.crc;
+        h.crc = 0;
+        uint32_t crc = Checksum::crc32c(&h, sizeof(h));
+
+        HoursAggregate agg;
+        uint64_t counted = h.nan_count;
+        BufferedReader r(in, HEADER_SIZE, HEADER_SIZE + h.distinct * sizeof(Entry));
+        for(uint64_t i = 0; i < h.distinct; i++)
+        {
+            Entry e;
+            if(!r.read(reinterpret_cast<char*>(&e), sizeof(e)))
+                return std::nullopt;
+            crc = Checksum::crc32c(&e, sizeof(e), crc);
+            // Values were written in strictly increasing order
+            if(std::isnan(e.value) || 0 == e.count || (!agg.values_.empty() && !(agg.values_.rbegin()->first < e.value)))
+                return std::nullopt;
+            agg.values_.emplace_hint(agg.values_.end(), e.value, e.count);
+            counted += e.count;
+            if(std::isinf(e.value))
+                (e.value > 0 ? agg.pos_inf_count_ : agg.neg_inf_count_) = e.count;
+        }
+        if(stored != crc || counted != h.count)
+            return std::nullopt;
+
+        agg.count_ = h.count;
+        agg.nan_count_ = h.nan_count;
+        agg.sum_ = h.sum;
+        agg.compensation_ = h.compensation;
+        agg.stamp_ = h.stamp;
+        return agg;
+    }
+
+    std::string HoursAggregate::path_for(const std::string& data_path)
+    {
+        return data_path + FILE_SUFFIX;
+    }
+
+} // namespace core::General
@@ -0,0 +1,433 @@
+/**
+ * @file HoursIndex.cpp
+ * @brief Implementation of the persistent hours index.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ *
+ * Building is a bounded-memory external sort of (hours, offset) pairs;
+ * querying reads at most one page per bound plus the requested range.
+ */
+
+#include <core/General/HoursIndex.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/RecordOrder.h>
+#include <algorithm>
+#include <cstring>
+#include <queue>
+#include <functional>
+
+namespace core::General
+{
+    namespace
+    {
+        typedef HoursIndex::Entry Entry;
+        static_assert(sizeof(Entry) == HoursIndex::ENTRY_SIZE, "Entry must be stored without padding");
+
+        /** @brief Fixed header at the start of the index file. */
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t entry_size;
+            uint32_t page_entries;
+            uint64_t count;
+            uint64_t fence_offset;
+        };
+
+        constexpr uint64_t HEADER_SIZE = sizeof(Header);
+        constexpr size_t MAX_IO_ENTRIES = 1u << 16;        // 1 MiB per read/write call
+
+        bool entry_less(const Entry& a, const Entry& b) noexcept
+        {
+            uint64_t ka = HoursIndex::ordered_key(a.hours);
+            uint64_t kb = HoursIndex::ordered_key(b.hours);
+            return ka < kb || (ka == kb && a.offset < b.offset);
+        }
+
+        /**
+         * @brief Sequential writer for the final index that records fence keys.
+         */
+        class IndexWriter
+        {
+        private:
+            const File& file_;
+            std::vector<Entry> buffer_;
+            std::vector<uint64_t> fences_;
+            uint64_t written_;
+            bool ok_;
+
+        public:
+            IndexWriter(const File& file, size_t buffer_entries)
+                : file_(file), written_(0), ok_(true)
+            {
+                buffer_.reserve(buffer_entries);
+            }
+
+            void push(const Entry& e)
+            {
+                if(0 == (written_ + buffer_.size()) % HoursIndex::PAGE_ENTRIES)
+                    fences_.push_back(HoursIndex::ordered_key(e.hours));
+                buffer_.push_back(e);
+                if(buffer_.size() == buffer_.capacity())
+                    flush_();
+            }
+
+            bool finish()
+            {
+                flush_();
+                if(!ok_) return false;
+
+                uint64_t fence_offset = HEADER_SIZE + written_ * HoursIndex::ENTRY_SIZE;
+                const char* fences = reinterpret_cast<const char*>(fences_.data());
+                size_t bytes = fences_.size() * sizeof(uint64_t);
+                for(size_t done = 0; done < bytes; done += MAX_IO_ENTRIES * sizeof(uint64_t))
+                {
+                    DWORD n = static_cast<DWORD>(std::min(bytes - done, MAX_IO_ENTRIES * sizeof(uint64_t)));
+                    if(!file_.writeAt(fences + done, n, fence_offset + done))
+                        return false;
+                }
+
+                // The header goes last, so a partially written index never validates
+                Header h = { HoursIndex::MAGIC, HoursIndex::VERSION,
+                             static_cast<uint32_t>(HoursIndex::ENTRY_SIZE),
+                             HoursIndex::PAGE_ENTRIES, written_, fence_offset };
+                return file_.writeAt(reinterpret_cast<const char*>(&h), sizeof(h), 0);
+            }
+
+        private:
+            void flush_()
+            {
+                if(buffer_.empty() || !ok_) return;
+                uint64_t offset = HEADER_SIZE + written_ * HoursIndex::ENTRY_SIZE;
+                DWORD n = static_cast<DWORD>(buffer_.size() * HoursIndex::ENTRY_SIZE);
+                ok_ = file_.writeAt(reinterpret_cast<const char*>(buffer_.data()), n, offset);
+                written_ += buffer_.size();
+                buffer_.clear();
+            }
+        };
+
+        /**
+         * @brief Buffered cursor over one sorted run inside the spill file.
+         */
+        class RunCursor
+        {
+        private:
+            const File* file_;
+            uint64_t next_;       // Next entry to fetch from disk (absolute index)
+            uint64_t end_;        // One past the last entry of the run
+            std::vector<Entry> buffer_;
+            size_t pos_;
+            bool failed_;         // A read failed; the run is incomplete
+
+        public:
+            RunCursor(const File& file, uint64_t begin, uint64_t end, size_t buffer_entries)
+                : file_(&file), next_(begin), end_(end), pos_(0), failed_(false)
+            {
+                buffer_.reserve(buffer_entries);
+            }
+
+            /** @return false once the run is exhausted or a read failed; failed() tells them apart. */
+            bool refill()
+            {
+                buffer_.clear();
+                pos_ = 0;
+                size_t n = static_cast<size_t>(std::min<uint64_t>(buffer_.capacity(), end_ - next_));
+                if(0 == n) return false;
+                buffer_.resize(n);
+                if(!file_->readAt(reinterpret_cast<char*>(buffer_.data()),
+                                  static_cast<DWORD>(n * HoursIndex::ENTRY_SIZE),
+                                  next_ * HoursIndex::ENTRY_SIZE))
+                {
+                    buffer_.clear();
+                    failed_ = true;
+                    return false;
+                }
+                next_ += n;
+                return true;
+            }
+
+            bool failed() const noexcept { return failed_; }
+            bool empty() const noexcept { return pos_ == buffer_.size(); }
+            const Entry& front() const noexcept { return buffer_[pos_]; }
+            void pop() noexcept { ++pos_; }
+        };
+
+        bool spill_run(const File& tmp, std::vector<Entry>& run, uint64_t first)
+        {
+            std::sort(run.begin(), run.end(), entry_less);
+            for(size_t done = 0; done < run.size(); done += MAX_IO_ENTRIES)
+            {
+                size_t n = std::min(run.size() - done, MAX_IO_ENTRIES);
+                if(!tmp.writeAt(reinterpret_cast<const char*>(run.data() + done),
+                                static_cast<DWORD>(n * HoursIndex::ENTRY_SIZE),
+                                (first + done) * HoursIndex::ENTRY_SIZE))
+                    return false;
+            }
+            return true;
+        }
+    } // namespace
+
+    HoursIndex::HoursIndex() noexcept
+        : file_(), count_(0), fences_()
+    {
+    }
+
+    HoursIndex::HoursIndex(File&& file, uint64_t count, std::vector<uint64_t>&& fences) noexcept
+        : file_(std::move(file)), count_(count), fences_(std::move(fences))
+    {
+    }
+
+    uint64_t HoursIndex::ordered_key(double value) noexcept
+    { return RecordOrder::hours_key(value); }
+
+    bool HoursIndex::build(const File& data, const File& index, size_t memory_budget)
+    {
+        // Accepts both versioned and legacy headerless data files
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(data);
+        if(!reader.has_value() || !index.is_opened())
+            return false;
+
+        const size_t RECORD = Employee::SERIALIZED_SIZE;
+        const uint64_t records = reader->size();
+        memory_budget = std::max(memory_budget, MIN_MEMORY_BUDGET);
+
+        // An eighth of the budget is the sequential read buffer, the rest holds entries
+        const size_t chunk_records = std::max<size_t>(1, std::min<size_t>(memory_budget / 8, 1u << 20) / RECORD);
+        const size_t run_entries = std::min((memory_budget - chunk_records * RECORD) / ENTRY_SIZE,
+                                            MAX_IO_ENTRIES * 4096);
+
+        std::vector<char> chunk(chunk_records * RECORD);
+        std::vector<Entry> run;
+        run.reserve(static_cast<size_t>(std::min<uint64_t>(run_entries, records)));
+
+        File tmp;
+        std::vector<uint64_t> run_bounds = { 0 };   // Entry index where each run starts
+
+        for(uint64_t r = 0; r < records; )
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(chunk_records, records - r));
+            if(!reader->read(r, n, chunk.data()))
+                return false;
+
+            for(size_t i = 0; i < n; i++, r++)
+            {
+                Entry e;
+                e.hours = Employee::Schema::read<Employee::FIELD_HOURS>(&chunk[i * RECORD]);
+                e.offset = reader->header().record_offset(r);
+                run.push_back(e);
+
+                if(run.size() == run_entries)
+                {
+                    if(!tmp.is_opened() && !(tmp = File::openTemporary()).is_opened())
+                        return false;
+                    if(!spill_run(tmp, run, run_bounds.back()))
+                        return false;
+                    run_bounds.push_back(run_bounds.back() + run.size());
+                    run.clear();
+                }
+            }
+        }
+        chunk = std::vector<char>();
+
+        // Single run: everything is still in memory and can be written directly
+        if(!tmp.is_opened())
+        {
+            std::sort(run.begin(), run.end(), entry_less);
+            IndexWriter out(index, std::min<size_t>(std::max<size_t>(run.size(), 1), MAX_IO_ENTRIES));
+            for(const Entry& e : run)
+                out.push(e);
+            return out.finish();
+        }
+
+        if(!run.empty())
+        {
+            if(!spill_run(tmp, run, run_bounds.back()))
+                return false;
+            run_bounds.push_back(run_bounds.back() + run.size());
+        }
+        run = std::vector<Entry>();
+
+        // k-way merge: the budget is split evenly between run buffers and the output
+        const size_t k = run_bounds.size() - 1;
+        const size_t buffer_entries = std::min(std::max<size_t>(1, memory_budget / ENTRY_SIZE / (k + 1)),
+                                               MAX_IO_ENTRIES * 16);
+
+        std::vector<RunCursor> cursors;
+        cursors.reserve(k);
+        typedef std::pair<uint64_t, size_t> HeapItem;   // (ordered key, cursor)
+        std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem>> heap;
+        for(size_t i = 0; i < k; i++)
+        {
+            cursors.emplace_back(tmp, run_bounds[i], run_bounds[i + 1], buffer_entries);
+            if(!cursors.back().refill())
+                return false;
+        }
+
+        // Entries with equal keys are ordered by offset, and offsets grow with the run index,
+        // so using the cursor as the tie-breaker keeps the merge stable.
+        for(size_t i = 0; i < k; i++)
+            heap.push({ ordered_key(cursors[i].front().hours), i });
+
+        IndexWriter out(index, buffer_entries);
+        while(!heap.empty())
+        {
+            size_t i = heap.top().second;
+            heap.pop();
+
+            RunCursor& c = cursors[i];
+            out.push(c.front());
+            c.pop();
+            if(c.empty() && !c.refill())
+            {
+                // A failed spill read must not pass for the end of the run
+                if(c.failed())
+                    return false;
+                continue;
+            }
+            heap.push({ ordered_key(c.front().hours), i });
+        }
+        return out.finish();
+    }
+
+    std::optional<HoursIndex> HoursIndex::open(File&& index)
+    {
+        Header h;
+        if(!index.readAt(reinterpret_cast<char*>(&h), sizeof(h), 0))
+            return std::nullopt;
+
+        if(MAGIC != h.magic || VERSION != h.version
+            || ENTRY_SIZE != h.entry_size || PAGE_ENTRIES != h.page_entries
+            || HEADER_SIZE + h.count * ENTRY_SIZE != h.fence_offset)
+            return std::nullopt;
+
+        uint64_t pages = (h.count + PAGE_ENTRIES - 1) / PAGE_ENTRIES;
+        std::optional<uint64_t> size = index.getFileSize64();
+        if(!size.has_value() || size.value() < h.fence_offset + pages * sizeof(uint64_t))
+            return std::nullopt;
+
+        std::vector<uint64_t> fences(static_cast<size_t>(pages));
+        char* dst = reinterpret_cast<char*>(fences.data());
+        size_t bytes = fences.size() * sizeof(uint64_t);
+        for(size_t done = 0; done < bytes; done += MAX_IO_ENTRIES * sizeof(uint64_t))
+        {
+            DWORD n = static_cast<DWORD>(std::min(bytes - done, MAX_IO_ENTRIES * sizeof(uint64_t)));
+            if(!index.readAt(dst + done, n, h.fence_offset + done))
+                return std::nullopt;
+        }
+
+        return HoursIndex(std::move(index), h.count, std::move(fences));
+    }
+
+    uint64_t HoursIndex::size() const noexcept
+    { return count_; }
+
+    std::optional<HoursIndex::Entry> HoursIndex::at(uint64_t i) const noexcept
+    {
+        Entry e;
+        if(i >= count_ || !file_.readAt(reinterpret_cast<char*>(&e), sizeof(e), HEADER_SIZE + i * ENTRY_SIZE))
+            return std::nullopt;
+        return e;
+    }
+
+    bool HoursIndex::read_entries_(uint64_t first, size_t n, std::vector<Entry>& out) const
+    {
+        out.resize(n);
+        for(size_t done = 0; done < n; done += MAX_IO_ENTRIES)
+        {
+            size_t m = std::min(n - done, MAX_IO_ENTRIES);
+            if(!file_.readAt(reinterpret_cast<char*>(out.data() + done),
+                             static_cast<DWORD>(m * ENTRY_SIZE),
+                             HEADER_SIZE + (first + done) * ENTRY_SIZE))
+            {
+                out.clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::optional<uint64_t> HoursIndex::bound_(uint64_t key, bool upper) const noexcept
+    {
+        // Fences narrow the search to one page: the answer lies inside the page
+        // before the first fence past the key, or exactly at that fence.
+        auto it = upper ? std::upper_bound(fences_.begin(), fences_.end(), key)
+                        : std::lower_bound(fences_.begin(), fences_.end(), key);
+        uint64_t page = static_cast<uint64_t>(it - fences_.begin());
+        if(0 == page)
+            return 0;
+
+        uint64_t first = (page - 1) * PAGE_ENTRIES;
+        uint64_t last = std::min(count_, page * PAGE_ENTRIES);
+
+        Entry buf[PAGE_ENTRIES];
+        if(!file_.readAt(reinterpret_cast<char*>(buf), static_cast<DWORD>((last - first) * ENTRY_SIZE),
+                         HEADER_SIZE + first * ENTRY_SIZE))
+            return std::nullopt;
+
+        auto pred = [key, upper](const Entry& e) {
+            uint64_t k = ordered_key(e.hours);
+            return upper ? k <= key : k < key;
+        };
+        return first + static_cast<uint64_t>(std::partition_point(buf, buf + (last - first), pred) - buf);
+    }
+
+    std::optional<uint64_t> HoursIndex::lower_bound(double hours) const noexcept
+    { return bound_(ordered_key(hours), false); }
+
+    std::optional<uint64_t> HoursIndex::upper_bound(double hours) const noexcept
+    { return bound_(ordered_key(hours), true); }
+
+    std::optional<std::vector<uint64_t>> HoursIndex::range(double lo, double hi) const
+    {
+        std::optional<uint64_t> b = lower_bound(lo);
+        std::optional<uint64_t> e = upper_bound(hi);
+        if(!b.has_value() || !e.has_value())
+            return std::nullopt;
+
+        std::vector<uint64_t> result;
+        if(*b >= *e) return result;
+
+        std::vector<Entry> entries;
+        if(!read_entries_(*b, static_cast<size_t>(*e - *b), entries))
+            return std::nullopt;
+
+        result.reserve(entries.size());
+        for(const Entry& entry : entries)
+            result.push_back(entry.offset);
+        return result;
+    }
+
+    std::optional<std::vector<uint64_t>> HoursIndex::top(size_t k) const
+    {
+        std::vector<uint64_t> result;
+        size_t n = static_cast<size_t>(std::min<uint64_t>(k, count_));
+        std::vector<Entry> entries;
+        if(0 == n)
+            return result;
+        if(!read_entries_(count_ - n, n, entries))
+            return std::nullopt;
+
+        result.reserve(n);
+        for(auto it = entries.rbegin(); it != entries.rend(); ++it)
+            result.push_back(it->offset);
+        return result;
+    }
+
+    std::optional<std::vector<uint64_t>> HoursIndex::bottom(size_t k) const
+    {
+        std::vector<uint64_t> result;
+        size_t n = static_cast<size_t>(std::min<uint64_t>(k, count_));
+        std::vector<Entry> entries;
+        if(0 == n)
+            return result;
+        if(!read_entries_(0, n, entries))
+            return std::nullopt;
+
+        result.reserve(n);
+        for(const Entry& entry : entries)
+            result.push_back(entry.offset);
+        return result;
+    }
+
+} // namespace core::General
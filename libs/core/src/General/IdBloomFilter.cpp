@@ -0,0 +1,224 @@
+/**
+ * @file IdBloomFilter.cpp
+ * @brief Implementation of the blocked Bloom filter over Employee ids.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/IdBloomFilter.h>
+#include <core/General/Checksum.h>
+#include <core/General/EmployeeFile.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CORE_BLOOM_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CORE_BLOOM_SSE2 1
+#endif
+
+namespace core::General
+{
+    namespace
+    {
+        typedef IdBloomFilter::Block Block;
+        constexpr size_t WORDS = IdBloomFilter::BLOCK_WORDS;
+        constexpr size_t WORD_BITS = 64;
+        constexpr size_t BLOCK_BITS = IdBloomFilter::BLOCK_BYTES * 8;
+        constexpr size_t BUILD_BATCH_RECORDS = 65536;   // Records per read in from_file()
+
+        /** @brief Odd multipliers that spread one 32-bit key over the eight words. */
+        alignas(32) constexpr uint32_t SALT[WORDS] = {
+            0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du,
+            0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u
+        };
+
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t blocks;
+            uint32_t block_bytes;
+            uint64_t keys;
+            uint32_t crc;        /**< CRC-32C of the blocks. */
+            uint32_t reserved;
+        };
+        constexpr uint64_t HEADER_SIZE = sizeof(Header);
+
+        /** @brief Spreads the 16 id bits over 64; the high half picks the block, the low half the bits. */
+        inline uint64_t hash(Employee::ID_TYPE id) noexcept
+        {
+            uint64_t h = (uint64_t(id) + 1) * 0x9E3779B97F4A7C15ull;
+            h ^= h >> 29;
+            h *= 0xBF58476D1CE4E5B9ull;
+            return h ^ (h >> 32);
+        }
+
+        inline size_t block_of(uint64_t h, size_t blocks) noexcept
+        { return static_cast<size_t>(((h >> 32) * blocks) >> 32); }
+
+#ifndef CORE_BLOOM_AVX2
+        /** @brief One bit per word, at a position taken from the top six bits of key * salt. */
+        inline void make_mask(uint32_t key, uint64_t* mask) noexcept
+        {
+            for(size_t i = 0; i < WORDS; i++)
+                mask[i] = uint64_t(1) << ((key * SALT[i]) >> 26);
+        }
+#else
+        inline void make_mask(uint32_t key, __m256i& lo, __m256i& hi) noexcept
+        {
+            const __m256i idx = _mm256_srli_epi32(
+                _mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)),
+                                   _mm256_load_si256(reinterpret_cast<const __m256i*>(SALT))), 26);
+            const __m256i one = _mm256_set1_epi64x(1);
+            lo = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(idx)));
+            hi = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(idx, 1)));
+        }
+#endif
+    } // namespace
+
+    IdBloomFilter::IdBloomFilter() noexcept
+        : keys_(0)
+    {
+    }
+
+    IdBloomFilter::IdBloomFilter(size_t expected_keys, double bits_per_key)
+        : keys_(0)
+    {
+        double bits = std::ceil(double(std::max<size_t>(expected_keys, 1)) * std::max(bits_per_key, 1.0));
+        double blocks = std::ceil(bits / BLOCK_BITS);
+        blocks_.resize(static_cast<size_t>(std::min(blocks, double(MAX_BLOCKS))));
+        memset(blocks_.data(), 0, blocks_.size() * sizeof(Block));
+    }
+
+    void IdBloomFilter::insert(Employee::ID_TYPE id) noexcept
+    {
+        if(blocks_.empty())
+            return;
+        keys_++;
+        if(exact())
+        {
+            blocks_[id / BLOCK_BITS].words[id % BLOCK_BITS / WORD_BITS] |= uint64_t(1) << (id % WORD_BITS);
+            return;
+        }
+        const uint64_t h = hash(id);
+        uint64_t* words = blocks_[block_of(h, blocks_.size())].words;
+#ifdef CORE_BLOOM_AVX2
+        __m256i lo, hi;
+        make_mask(static_cast<uint32_t>(h), lo, hi);
+        __m256i* w = reinterpret_cast<__m256i*>(words);
+        _mm256_store_si256(w, _mm256_or_si256(_mm256_load_si256(w), lo));
+        _mm256_store_si256(w + 1, _mm256_or_si256(_mm256_load_si256(w + 1), hi));
+#else
+        uint64_t mask[WORDS];
+        make_mask(static_cast<uint32_t>(h), mask);
+        for(size_t i = 0; i < WORDS; i++)
+            words[i] |= mask[i];
+#endif
+    }
+
+    bool IdBloomFilter::may_contain(Employee::ID_TYPE id) const noexcept
+    {
+        if(blocks_.empty())
+            return false;
+        if(exact())
+            return 0 != ((blocks_[id / BLOCK_BITS].words[id % BLOCK_BITS / WORD_BITS] >> (id % WORD_BITS)) & 1);
+        const uint64_t h = hash(id);
+        const uint64_t* words = blocks_[block_of(h, blocks_.size())].words;
+#if defined(CORE_BLOOM_AVX2)
+        __m256i lo, hi;
+        make_mask(static_cast<uint32_t>(h), lo, hi);
+        const __m256i* w = reinterpret_cast<const __m256i*>(words);
+        // testc is 1 when every mask bit is also set in the block
+        return 0 != (_mm256_testc_si256(_mm256_load_si256(w), lo) & _mm256_testc_si256(_mm256_load_si256(w + 1), hi));
+#elif defined(CORE_BLOOM_SSE2)
+        alignas(16) uint64_t mask[WORDS];
+        make_mask(static_cast<uint32_t>(h), mask);
+        __m128i all = _mm_set1_epi32(-1);
+        for(size_t i = 0; i < WORDS; i += 2)
+        {
+            __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(mask + i));
+            __m128i b = _mm_load_si128(reinterpret_cast<const __m128i*>(words + i));
+            all = _mm_and_si128(all, _mm_cmpeq_epi32(_mm_and_si128(b, m), m));
+        }
+        return 0xFFFF == _mm_movemask_epi8(all);
+#else
+        uint64_t mask[WORDS];
+        make_mask(static_cast<uint32_t>(h), mask);
+        uint64_t missing = 0;
+        for(size_t i = 0; i < WORDS; i++)
+            missing |= mask[i] & ~words[i];
+        return 0 == missing;
+#endif
+    }
+
+    size_t IdBloomFilter::block_count() const noexcept
+    { return blocks_.size(); }
+
+    bool IdBloomFilter::exact() const noexcept
+    { return MAX_BLOCKS == blocks_.size(); }
+
+    uint64_t IdBloomFilter::key_count() const noexcept
+    { return keys_; }
+
+    size_t IdBloomFilter::size_bytes() const noexcept
+    { return blocks_.size() * sizeof(Block); }
+
+    std::optional<IdBloomFilter> IdBloomFilter::from_file(const File& data, double bits_per_key)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(data);
+        if(!reader.has_value())
+            return std::nullopt;
+
+        IdBloomFilter filter(static_cast<size_t>(std::min<uint64_t>(reader->size(), SIZE_MAX)), bits_per_key);
+        std::vector<char> batch(static_cast<size_t>(std::min<uint64_t>(BUILD_BATCH_RECORDS, reader->size()))
+                                * Employee::SERIALIZED_SIZE);
+        for(uint64_t first = 0; first < reader->size(); first += BUILD_BATCH_RECORDS)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(BUILD_BATCH_RECORDS, reader->size() - first));
+            if(!reader->read(first, n, batch.data()))
+                return std::nullopt;
+            for(size_t i = 0; i < n; i++)
+                filter.insert(Employee::Schema::read<Employee::FIELD_ID>(batch.data() + i * Employee::SERIALIZED_SIZE));
+        }
+        return filter;
+    }
+
+    bool IdBloomFilter::write(const File& out) const
+    {
+        Header h = {};
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.blocks = static_cast<uint32_t>(blocks_.size());
+        h.block_bytes = static_cast<uint32_t>(BLOCK_BYTES);
+        h.keys = keys_;
+        h.crc = Checksum::crc32c(blocks_.data(), size_bytes());
+        return out.writeAt(reinterpret_cast<const char*>(&h), sizeof(h), 0)
+            && out.writeAt(reinterpret_cast<const char*>(blocks_.data()), static_cast<DWORD>(size_bytes()), HEADER_SIZE);
+    }
+
+    std::optional<IdBloomFilter> IdBloomFilter::read(const File& in)
+    {
+        Header h;
+        if(!in.readAt(reinterpret_cast<char*>(&h), sizeof(h), 0)
+            || MAGIC != h.magic || VERSION != h.version || BLOCK_BYTES != h.block_bytes || h.blocks > MAX_BLOCKS)
+            return std::nullopt;
+
+        IdBloomFilter filter;
+        filter.blocks_.resize(h.blocks);
+        filter.keys_ = h.keys;
+        if(!in.readAt(reinterpret_cast<char*>(filter.blocks_.data()), static_cast<DWORD>(filter.size_bytes()), HEADER_SIZE)
+            || h.crc != Checksum::crc32c(filter.blocks_.data(), filter.size_bytes()))
+            return std::nullopt;
+        return filter;
+    }
+
+    std::string IdBloomFilter::path_for(const std::string& data_path)
+    {
+        return data_path + FILE_SUFFIX;
+    }
+
+} // namespace core::General
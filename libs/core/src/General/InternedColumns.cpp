@@ -0,0 +1,125 @@
+/**
+ * @file InternedColumns.cpp
+ * @brief Implementation of the dictionary-coded Employee table.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/InternedColumns.h>
+#include <cstring>
+
+namespace core::General
+{
+    InternedColumns InternedColumns::from_columns(const EmployeeColumns& table)
+    {
+        InternedColumns t;
+        t.reserve(table.size());
+        for(size_t i = 0; i < table.size(); i++)
+        {
+            t.ids_.push_back(table.ids()[i]);
+            t.hours_.push_back(table.hours()[i]);
+            t.codes_.push_back(t.dictionary_.intern(table.names()[i].data()));
+        }
+        return t;
+    }
+
+    InternedColumns InternedColumns::from_records(const char* records, size_t n)
+    {
+        InternedColumns t;
+        t.reserve(n);
+        for(size_t i = 0; i < n; i++)
+            t.push_back_record(records + i * Employee::SERIALIZED_SIZE);
+        return t;
+    }
+
+    size_t InternedColumns::size() const noexcept
+    { return ids_.size(); }
+
+    bool InternedColumns::empty() const noexcept
+    { return ids_.empty(); }
+
+    void InternedColumns::reserve(size_t n)
+    {
+        ids_.reserve(n);
+        hours_.reserve(n);
+        codes_.reserve(n);
+    }
+
+    void InternedColumns::clear() noexcept
+    {
+        ids_.clear();
+        hours_.clear();
+        codes_.clear();
+        dictionary_.clear();
+    }
+
+    void InternedColumns::push_back(const Employee& e)
+    {
+        ids_.push_back(e.id());
+        hours_.push_back(e.hours());
+        codes_.push_back(dictionary_.intern(e.name()));
+    }
+
+    void InternedColumns::push_back_record(const char* record)
+    {
+        char name[Employee::BUFF_SIZE];
+        Employee::Schema::read_to<Employee::FIELD_NAME>(record, name);
+        ids_.push_back(Employee::Schema::read<Employee::FIELD_ID>(record));
+        hours_.push_back(Employee::Schema::read<Employee::FIELD_HOURS>(record));
+        codes_.push_back(dictionary_.intern(name));
+    }
+
+    Employee InternedColumns::employee(size_t i) const noexcept
+    {
+        Employee e;
+        e.id() = ids_[i];
+        e.hours() = hours_[i];
+        memcpy(e.name(), dictionary_.name(codes_[i]), Employee::BUFF_SIZE);
+        return e;
+    }
+
+    const char* InternedColumns::name(size_t i) const noexcept
+    { return dictionary_.name(codes_[i]); }
+
+    EmployeeColumns InternedColumns::to_columns() const
+    {
+        EmployeeColumns t;
+        t.resize(size());
+        for(size_t i = 0; i < size(); i++)
+        {
+            t.ids()[i] = ids_[i];
+            t.hours()[i] = hours_[i];
+            memcpy(t.names()[i].data(), dictionary_.name(codes_[i]), Employee::BUFF_SIZE);
+        }
+        return t;
+    }
+
+    const std::vector<Employee::ID_TYPE>& InternedColumns::ids() const noexcept
+    { return ids_; }
+
+    const std::vector<double>& InternedColumns::hours() const noexcept
+    { return hours_; }
+
+    const std::vector<NameDictionary::Code>& InternedColumns::codes() const noexcept
+    { return codes_; }
+
+    const NameDictionary& InternedColumns::dictionary() const noexcept
+    { return dictionary_; }
+
+    std::vector<uint64_t> InternedColumns::count_by_name() const
+    {
+        std::vector<uint64_t> counts(dictionary_.size(), 0);
+        for(NameDictionary::Code c : codes_)
+            counts[c]++;
+        return counts;
+    }
+
+    std::vector<double> InternedColumns::hours_by_name() const
+    {
+        std::vector<double> sums(dictionary_.size(), 0.0);
+        for(size_t i = 0; i < codes_.size(); i++)
+            sums[codes_[i]] += hours_[i];
+        return sums;
+    }
+
+} // namespace core::General
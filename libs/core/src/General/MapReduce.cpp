@@ -0,0 +1,329 @@
+/**
+ * @file MapReduce.cpp
+ * @brief Implementation of the multi-process GROUP BY driver and worker.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/MapReduce.h>
+#include <core/General/Checksum.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/Parallel.h>
+#include <core/General/Process.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t key;        /**< GroupKey the rows were grouped by. */
+            uint32_t reserved;
+            uint64_t first;      /**< Range covered by the partial. */
+            uint64_t count;
+            uint64_t rows;       /**< Rows that follow. */
+        };
+
+        struct Row
+        {
+            uint64_t key;        /**< Id, bucket lower bound, or the worker's local name code. */
+            uint64_t count;
+            double sum;
+            double min;
+            double max;
+            char name[16];       /**< Zero-padded name for GroupKey::name; zero otherwise. */
+        };
+
+        static_assert(sizeof(Row) == 56, "Partial rows must not have padding");
+
+        const char* key_name(GroupKey key) noexcept
+        {
+            switch(key)
+            {
+            case GroupKey::name:    return "name";
+            case GroupKey::id:      return "id";
+            default:                return "id_bucket";
+            }
+        }
+
+        std::optional<GroupKey> parse_key(const std::string& s) noexcept
+        {
+            if("name" == s)         return GroupKey::name;
+            if("id" == s)           return GroupKey::id;
+            if("id_bucket" == s)    return GroupKey::id_bucket;
+            return std::nullopt;
+        }
+
+        Row make_row(uint64_t key, const GroupStats& s) noexcept
+        {
+            Row r = {};
+            r.key = key;
+            r.count = s.count;
+            r.sum = s.hours_sum;
+            r.min = s.hours_min;
+            r.max = s.hours_max;
+            return r;
+        }
+    } // namespace
+
+    std::vector<MapRange> MapReduce::split(uint64_t records, size_t workers, uint64_t min_records)
+    {
+        std::vector<MapRange> ranges;
+        if(0 == records)
+            return ranges;
+        uint64_t n = std::max<uint64_t>(1, std::min<uint64_t>(workers, records / std::max<uint64_t>(min_records, 1)));
+        const uint64_t base = records / n, extra = records % n;
+        uint64_t first = 0;
+        for(uint64_t i = 0; i < n; i++)
+        {
+            uint64_t count = base + (i < extra ? 1 : 0);
+            ranges.push_back({ first, count });
+            first += count;
+        }
+        return ranges;
+    }
+
+    bool MapReduce::map(const File& data, const MapRange& range, const GroupByOptions& opts, const File& out)
+    {
+        typedef Employee::Schema S;
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(data);
+        if(!reader.has_value() || range.first > reader->size() || range.count > reader->size() - range.first)
+            return false;
+
+        GroupTable table;
+        NameDictionary names;
+        std::vector<GroupStats> by_code;
+        const uint64_t width = std::max<uint32_t>(opts.bucket_width, 1);
+        std::vector<char> batch(static_cast<size_t>(std::min<uint64_t>(BATCH_RECORDS, range.count)) * Employee::SERIALIZED_SIZE);
+        for(uint64_t done = 0; done < range.count; done += BATCH_RECORDS)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(BATCH_RECORDS, range.count - done));
+            if(!reader->read(range.first + done, n, batch.data()))
+                return false;
+            for(size_t i = 0; i < n; i++)
+            {
+                const char* record = batch.data() + i * Employee::SERIALIZED_SIZE;
+                const double hours = S::read<Employee::FIELD_HOURS>(record);
+                const uint64_t id = S::read<Employee::FIELD_ID>(record);
+                switch(opts.key)
+                {
+                case GroupKey::name:
+                {
+                    NameDictionary::Code code = names.intern(record + S::offset<Employee::FIELD_NAME>());
+                    if(code == by_code.size())
+                        by_code.emplace_back();
+                    by_code[code].add(hours);
+                    break;
+                }
+                case GroupKey::id:          table.at(id).add(hours); break;
+                case GroupKey::id_bucket:   table.at(id - id % width).add(hours); break;
+                }
+            }
+        }
+
+        std::vector<Row> rows;
+        if(GroupKey::name == opts.key)
+        {
+            rows.reserve(by_code.size());
+            for(NameDictionary::Code c = 0; c < by_code.size(); c++)
+            {
+                rows.push_back(make_row(c, by_code[c]));
+                memcpy(rows.back().name, names.name(c), Employee::BUFF_SIZE);
+            }
+        }
+        else
+        {
+            for(const GroupRow& g : table.rows())
+                rows.push_back(make_row(g.key, g.stats));
+        }
+
+        Header h = {};
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.key = static_cast<uint32_t>(opts.key);
+        h.first = range.first;
+        h.count = range.count;
+        h.rows = rows.size();
+        uint32_t crc = Checksum::crc32c(&h, sizeof(h));
+        crc = Checksum::crc32c(rows.data(), rows.size() * sizeof(Row), crc);
+
+        return Pipe::write_all(out, reinterpret_cast<const char*>(&h), sizeof(h))
+            && Pipe::write_all(out, reinterpret_cast<const char*>(rows.data()), rows.size() * sizeof(Row))
+            && Pipe::write_all(out, reinterpret_cast<const char*>(&crc), sizeof(crc));
+    }
+
+    bool MapReduce::reduce(const File& in, GroupKey key, GroupTable& table, NameDictionary& names)
+    {
+        Header h;
+        if(sizeof(h) != Pipe::read_full(in, reinterpret_cast<char*>(&h), sizeof(h))
+            || MAGIC != h.magic || VERSION != h.version || static_cast<uint32_t>(key) != h.key
+            || h.rows > h.count)
+            return false;
+
+        // Nothing is merged until the whole partial has been checked
+        std::vector<Row> rows(static_cast<size_t>(h.rows));
+        uint32_t stored = 0;
+        const size_t bytes = rows.size() * sizeof(Row);
+        if(bytes != Pipe::read_full(in, reinterpret_cast<char*>(rows.data()), bytes)
+            || sizeof(stored) != Pipe::read_full(in, reinterpret_cast<char*>(&stored), sizeof(stored)))
+            return false;
+        uint32_t crc = Checksum::crc32c(&h, sizeof(h));
+        if(stored != Checksum::crc32c(rows.data(), bytes, crc))
+            return false;
+
+        for(Row& r : rows)
+        {
+            GroupStats s;
+            s.count = r.count;
+            s.hours_sum = r.sum;
+            s.hours_min = r.min;
+            s.hours_max = r.max;
+            if(GroupKey::name == key)
+            {
+                r.name[sizeof(r.name) - 1] = '\0';
+                table.at(names.intern(r.name)).merge(s);
+            }
+            else
+                table.at(r.key).merge(s);
+        }
+        return true;
+    }
+
+    std::optional<GroupByResult> MapReduce::run(const std::string& worker_exe, const std::string& data_path,
+                                                const MapReduceOptions& opts)
+    {
+        File data = File::open(data_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(data);
+        if(!reader.has_value())
+            return std::nullopt;
+        std::vector<MapRange> ranges = split(reader->size(), Parallel::workers(opts.workers), opts.min_records_per_worker);
+        data.close();
+
+        struct Worker
+        {
+            Process process;
+            File output;
+        };
+        std::vector<Worker> workers;
+        bool ok = true;
+        const ULONGLONG deadline = GetTickCount64() + opts.timeout_ms;
+        for(const MapRange& r : ranges)
+        {
+            std::optional<Pipe> pipe = Pipe::create(opts.pipe_buffer);
+            // Only the write end is inheritable, and only while this one worker starts
+            if(!pipe.has_value() || !Pipe::set_inheritable(pipe->writer(), true))
+            {
+                ok = false;
+                break;
+            }
+
+            STARTUPINFOW si = {};
+            si.cb = sizeof(si);
+            si.dwFlags = STARTF_USESTDHANDLES;
+            si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+            si.hStdOutput = pipe->writer().handle();
+            si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+            std::string cmd = "\"" + worker_exe + "\" " + WORKER_FLAG + " \"" + data_path + "\" "
+                            + std::to_string(r.first) + " " + std::to_string(r.count) + " "
+                            + key_name(opts.key) + " " + std::to_string(opts.bucket_width);
+            Process p = Process::create_utf8(worker_exe, cmd, nullptr, nullptr, true, 0, nullptr, "", si);
+
+            // The child holds its own copy; ours must go so the pipe ends when the child exits
+            pipe->close(PipeEnd::write);
+            if(!p)
+            {
+                ok = false;
+                break;
+            }
+            workers.push_back({ std::move(p), pipe->release(PipeEnd::read) });
+        }
+
+        GroupTable table;
+        NameDictionary names;
+        bool expired = false;
+        auto stop_all = [&workers]() {
+            for(Worker& w : workers)
+                w.process.terminate(1);
+        };
+        Parallel::run(2, [&](size_t role) {
+            if(0 != role)
+            {
+                // Watchdog: a worker still running at the deadline is killed. That also
+                // closes its end of the pipe, so a reader blocked on it sees the end.
+                for(Worker& w : workers)
+                {
+                    ULONGLONG now = GetTickCount64();
+                    wait_status s = INFINITE == opts.timeout_ms
+                                  ? w.process.wait()
+                                  : w.process.wait_for(milliseconds(deadline > now ? deadline - now : 0));
+                    if(wait_status::signaled != s)
+                    {
+                        expired = true;
+                        stop_all();
+                        w.process.wait();
+                    }
+                }
+                return;
+            }
+
+            if(!ok)
+                stop_all();
+            for(Worker& w : workers)
+            {
+                // Partials are merged in range order to keep name codes in file order
+                if(ok && !reduce(w.output, opts.key, table, names))
+                {
+                    // Nothing more will be merged, so the other workers are only wasting time
+                    ok = false;
+                    stop_all();
+                }
+                w.output.close();
+            }
+        });
+
+        if(expired)
+            ok = false;
+        for(Worker& w : workers)
+            if(0 != w.process.try_exit_code().value_or(1))
+                ok = false;
+        if(!ok)
+            return std::nullopt;
+
+        GroupByResult result;
+        result.rows = table.rows();
+        if(GroupKey::name == opts.key)
+            result.names = std::move(names);
+        return result;
+    }
+
+    bool MapReduce::is_worker(int argc, char* argv[]) noexcept
+    {
+        return argc > 1 && 0 == strcmp(argv[1], WORKER_FLAG);
+    }
+
+    int MapReduce::worker_main(int argc, char* argv[])
+    {
+        // <exe> --map-worker <data> <first> <count> <key> <bucket_width>
+        if(7 != argc || !is_worker(argc, argv))
+            return 2;
+        std::optional<GroupKey> key = parse_key(argv[5]);
+        if(!key.has_value())
+            return 2;
+
+        GroupByOptions opts;
+        opts.key = *key;
+        opts.bucket_width = static_cast<uint32_t>(std::strtoul(argv[6], nullptr, 10));
+        MapRange range = { std::strtoull(argv[3], nullptr, 10), std::strtoull(argv[4], nullptr, 10) };
+
+        File data = File::open(argv[2], GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        File out(GetStdHandle(STD_OUTPUT_HANDLE));
+        return data && map(data, range, opts, out) ? 0 : 1;
+    }
+
+} // namespace core::General
@@ -0,0 +1,97 @@
+/**
+ * @file MappedEmployeeFile.cpp
+ * @brief Implementation of the memory-mapped Employee table.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/MappedEmployeeFile.h>
+#include <core/General/EmployeeFile.h>
+#include <algorithm>
+#include <utility>
+
+namespace core::General
+{
+    MappedEmployeeFile::MappedEmployeeFile(FileMapping mapping, const char* records, uint64_t size,
+                                           EmployeeLayout layout) noexcept
+        : mapping_(std::move(mapping)), records_(records), size_(size), layout_(layout)
+    {
+    }
+
+    std::optional<MappedEmployeeFile> MappedEmployeeFile::open(const File& file) noexcept
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(file);
+        // Views read host-order records of either layout in place; foreign files need EmployeeFileReader
+        if(!reader.has_value() || !(reader->zero_copy() || reader->header().aligned_layout()))
+            return std::nullopt;
+
+        FileMapping mapping = FileMapping::open(file);
+        if(!mapping.is_mapped())
+            return std::nullopt;
+        const char* records = mapping.data() + reader->header().record_offset(0);
+        return MappedEmployeeFile(std::move(mapping), records, reader->size(), reader->header().layout());
+    }
+
+    std::optional<MappedEmployeeFile> MappedEmployeeFile::open(const char* path, MappedAccess access) noexcept
+    {
+        DWORD flags = FILE_ATTRIBUTE_NORMAL;
+        switch(access)
+        {
+        case MappedAccess::sequential:  flags = FILE_FLAG_SEQUENTIAL_SCAN; break;
+        case MappedAccess::random:      flags = FILE_FLAG_RANDOM_ACCESS; break;
+        default:                        break;
+        }
+        File file = File::open(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+        if(!file)
+            return std::nullopt;
+        return open(file);
+    }
+
+    uint64_t MappedEmployeeFile::size() const noexcept
+    { return size_; }
+
+    bool MappedEmployeeFile::empty() const noexcept
+    { return 0 == size_; }
+
+    const char* MappedEmployeeFile::data() const noexcept
+    { return records_; }
+
+    EmployeeLayout MappedEmployeeFile::layout() const noexcept
+    { return layout_; }
+
+    size_t MappedEmployeeFile::stride() const noexcept
+    { return EmployeeView::stride(layout_); }
+
+    EmployeeView MappedEmployeeFile::operator[](uint64_t i) const noexcept
+    { return EmployeeView(records_ + i * stride(), layout_); }
+
+    MappedEmployeeFile::iterator MappedEmployeeFile::begin() const noexcept
+    { return iterator(records_, layout_); }
+
+    MappedEmployeeFile::iterator MappedEmployeeFile::end() const noexcept
+    { return iterator(records_ + size_ * stride(), layout_); }
+
+    MappedEmployeeFile::iterator MappedEmployeeFile::lower_bound(Employee::ID_TYPE id) const noexcept
+    {
+        return std::lower_bound(begin(), end(), id,
+                                [](EmployeeView v, Employee::ID_TYPE key) { return v.id() < key; });
+    }
+
+    MappedEmployeeFile::iterator MappedEmployeeFile::upper_bound(Employee::ID_TYPE id) const noexcept
+    {
+        return std::upper_bound(begin(), end(), id,
+                                [](Employee::ID_TYPE key, EmployeeView v) { return key < v.id(); });
+    }
+
+    bool MappedEmployeeFile::prefetch(uint64_t first, uint64_t count) const noexcept
+    {
+        if(first >= size_)
+            return true;
+        count = std::min(count, size_ - first);
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<char*>(records_ + first * stride());
+        range.NumberOfBytes = static_cast<SIZE_T>(count * stride());
+        return FALSE != PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+} // namespace core::General
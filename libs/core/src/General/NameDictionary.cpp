@@ -0,0 +1,126 @@
+/**
+ * @file NameDictionary.cpp
+ * @brief Implementation of the name interning dictionary.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/NameDictionary.h>
+#include <algorithm>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t INITIAL_SLOTS = 64;   // Power of two
+
+        inline uint64_t mix(uint64_t x) noexcept
+        {
+            // Final step of MurmurHash3 (fmix64)
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ull;
+            return x ^ (x >> 33);
+        }
+    }
+
+    NameDictionary::NameDictionary()
+        : slots_(INITIAL_SLOTS, 0), mask_(INITIAL_SLOTS - 1)
+    {
+    }
+
+    NameDictionary::Cell NameDictionary::normalize_(const char* name) noexcept
+    {
+        char buf[sizeof(Cell)] = {};
+        memcpy(buf, name, strnlen(name, Employee::BUFF_SIZE));
+        Cell c;
+        memcpy(&c.lo, buf, sizeof(c.lo));
+        memcpy(&c.hi, buf + sizeof(c.lo), sizeof(c.hi));
+        return c;
+    }
+
+    uint64_t NameDictionary::hash_(const Cell& c) noexcept
+    { return mix(c.lo ^ mix(c.hi + 0x9E3779B97F4A7C15ull)); }
+
+    size_t NameDictionary::probe_(const Cell& c, uint64_t h) const noexcept
+    {
+        const uint64_t tag = h & 0xFFFFFFFF00000000ull;
+        for(size_t i = static_cast<size_t>(h) & mask_; ; i = (i + 1) & mask_)
+        {
+            uint64_t s = slots_[i];
+            if(0 == s)
+                return i;
+            if((s & 0xFFFFFFFF00000000ull) == tag)
+            {
+                const Cell& other = cells_[static_cast<uint32_t>(s) - 1];
+                if(other.lo == c.lo && other.hi == c.hi)
+                    return i;
+            }
+        }
+    }
+
+    void NameDictionary::grow_()
+    {
+        std::vector<uint64_t> old(slots_.size() * 2, 0);
+        old.swap(slots_);
+        mask_ = slots_.size() - 1;
+        for(uint64_t s : old)
+        {
+            if(0 == s) continue;
+            const Cell& c = cells_[static_cast<uint32_t>(s) - 1];
+            slots_[probe_(c, hash_(c))] = s;
+        }
+    }
+
+    NameDictionary::Code NameDictionary::intern(const char* name)
+    {
+        Cell c = normalize_(name);
+        uint64_t h = hash_(c);
+        size_t i = probe_(c, h);
+        if(0 != slots_[i])
+            return static_cast<uint32_t>(slots_[i]) - 1;
+
+        // Keep the load factor at or below one half
+        if((cells_.size() + 1) * 2 > slots_.size())
+        {
+            grow_();
+            i = probe_(c, h);
+        }
+        Code code = static_cast<Code>(cells_.size());
+        cells_.push_back(c);
+        slots_[i] = (h & 0xFFFFFFFF00000000ull) | (uint64_t(code) + 1);
+        return code;
+    }
+
+    NameDictionary::Code NameDictionary::find(const char* name) const noexcept
+    {
+        Cell c = normalize_(name);
+        uint64_t s = slots_[probe_(c, hash_(c))];
+        return 0 == s ? NONE : static_cast<uint32_t>(s) - 1;
+    }
+
+    const char* NameDictionary::name(Code code) const noexcept
+    { return reinterpret_cast<const char*>(&cells_[code]); }
+
+    size_t NameDictionary::size() const noexcept
+    { return cells_.size(); }
+
+    void NameDictionary::reserve(size_t n)
+    {
+        cells_.reserve(n);
+        while(n * 2 > slots_.size())
+            grow_();
+    }
+
+    void NameDictionary::clear() noexcept
+    {
+        cells_.clear();
+        std::fill(slots_.begin(), slots_.end(), 0);
+    }
+
+    uint64_t NameDictionary::hash(const char* name) noexcept
+    { return hash_(normalize_(name)); }
+
+} // namespace core::General
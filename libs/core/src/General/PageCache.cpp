@@ -0,0 +1,235 @@
+/**
+ * @file PageCache.cpp
+ * @brief Implementation of the CLOCK page cache over Employee files.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/PageCache.h>
+#include <algorithm>
+
+namespace core::General
+{
+    // --- PageCache::Pin ---
+
+    PageCache::Pin::Pin(PageCache* cache, size_t frame, const char* data, uint64_t first, uint32_t count) noexcept
+        : cache_(cache), frame_(frame), data_(data), first_(first), count_(count)
+    {
+    }
+
+    PageCache::Pin::Pin() noexcept
+        : cache_(nullptr), frame_(0), data_(nullptr), first_(0), count_(0)
+    {
+    }
+
+    PageCache::Pin::Pin(Pin&& other) noexcept
+        : cache_(other.cache_), frame_(other.frame_), data_(other.data_), first_(other.first_), count_(other.count_)
+    {
+        other.cache_ = nullptr;
+    }
+
+    PageCache::Pin& PageCache::Pin::operator=(Pin&& other) noexcept
+    {
+        if(&other != this)
+        {
+            release();
+            cache_ = other.cache_;
+            frame_ = other.frame_;
+            data_ = other.data_;
+            first_ = other.first_;
+            count_ = other.count_;
+            other.cache_ = nullptr;
+        }
+        return *this;
+    }
+
+    PageCache::Pin::~Pin() noexcept
+    {
+        release();
+    }
+
+    void PageCache::Pin::release() noexcept
+    {
+        if(nullptr != cache_)
+            cache_->unpin_(frame_);
+        cache_ = nullptr;
+        data_ = nullptr;
+        count_ = 0;
+    }
+
+    bool PageCache::Pin::valid() const noexcept
+    { return nullptr != cache_; }
+
+    const char* PageCache::Pin::data() const noexcept
+    { return data_; }
+
+    uint64_t PageCache::Pin::first() const noexcept
+    { return first_; }
+
+    uint32_t PageCache::Pin::size() const noexcept
+    { return count_; }
+
+    // --- PageCache ---
+
+    PageCache::PageCache(const File& file, const PageCacheOptions& opts)
+        : reader_(EmployeeFileReader::open(file)),
+          page_records_(std::max<uint32_t>(opts.page_records, 1)),
+          page_bytes_(size_t(page_records_) * Employee::SERIALIZED_SIZE),
+          hand_(0), hits_(0), misses_(0), evictions_(0)
+    {
+        InitializeSRWLock(&lock_);
+        InitializeConditionVariable(&loaded_);
+        if(!reader_.has_value())
+            return;
+
+        // No point in more frames than pages
+        uint64_t pages = (reader_->size() + page_records_ - 1) / page_records_;
+        size_t frames = std::max<size_t>(1, opts.budget_bytes / page_bytes_);
+        frames = static_cast<size_t>(std::min<uint64_t>(frames, std::max<uint64_t>(pages, 1)));
+
+        arena_.resize(frames * page_bytes_);
+        std::vector<Frame>(frames).swap(frames_);
+        map_.reserve(frames);
+    }
+
+    bool PageCache::is_open() const noexcept
+    { return reader_.has_value(); }
+
+    uint64_t PageCache::size() const noexcept
+    { return reader_.has_value() ? reader_->size() : 0; }
+
+    uint32_t PageCache::page_records() const noexcept
+    { return page_records_; }
+
+    size_t PageCache::capacity() const noexcept
+    { return frames_.size(); }
+
+    size_t PageCache::victim_() noexcept
+    {
+        // Two sweeps: the first may only clear reference bits
+        const size_t n = frames_.size();
+        for(size_t step = 0; step < 2 * n; step++)
+        {
+            size_t i = hand_;
+            hand_ = (hand_ + 1) % n;
+            Frame& f = frames_[i];
+            if(FrameState::loading == f.state || 0 != f.pins.load(std::memory_order_acquire))
+                continue;
+            if(FrameState::empty == f.state)
+                return i;
+            if(f.referenced.exchange(false, std::memory_order_relaxed))
+                continue;
+            return i;
+        }
+        return n;
+    }
+
+    void PageCache::unpin_(size_t frame) noexcept
+    {
+        frames_[frame].pins.fetch_sub(1, std::memory_order_release);
+    }
+
+    PageCache::Pin PageCache::pin(uint64_t page)
+    {
+        if(!is_open() || page >= (reader_->size() + page_records_ - 1) / page_records_)
+            return Pin();
+        const uint64_t first = page * page_records_;
+        const uint32_t count = static_cast<uint32_t>(std::min<uint64_t>(page_records_, reader_->size() - first));
+
+        // Returns a pin if the page is resident, waiting out a load in progress
+        auto lookup = [&](ULONG mode) -> std::optional<Pin> {
+            for(;;)
+            {
+                auto it = map_.find(page);
+                if(map_.end() == it)
+                    return std::nullopt;
+                Frame& f = frames_[it->second];
+                if(FrameState::ready == f.state)
+                {
+                    // Shared holders may pin concurrently; eviction needs the lock exclusively
+                    f.pins.fetch_add(1, std::memory_order_acquire);
+                    f.referenced.store(true, std::memory_order_relaxed);
+                    hits_.fetch_add(1, std::memory_order_relaxed);
+                    return Pin(this, it->second, arena_.data() + it->second * page_bytes_, first, count);
+                }
+                SleepConditionVariableSRW(&loaded_, &lock_, INFINITE, mode);
+            }
+        };
+
+        AcquireSRWLockShared(&lock_);
+        std::optional<Pin> hit = lookup(CONDITION_VARIABLE_LOCKMODE_SHARED);
+        ReleaseSRWLockShared(&lock_);
+        if(hit.has_value())
+            return std::move(*hit);
+
+        AcquireSRWLockExclusive(&lock_);
+        // Another thread may have loaded the page between the two locks
+        hit = lookup(0);
+        if(hit.has_value())
+        {
+            ReleaseSRWLockExclusive(&lock_);
+            return std::move(*hit);
+        }
+
+        size_t v = victim_();
+        if(frames_.size() == v)
+        {
+            ReleaseSRWLockExclusive(&lock_);
+            return Pin();
+        }
+        Frame& f = frames_[v];
+        if(FrameState::empty != f.state)
+        {
+            map_.erase(f.page);
+            evictions_.fetch_add(1, std::memory_order_relaxed);
+        }
+        f.page = page;
+        f.count = count;
+        f.state = FrameState::loading;
+        f.pins.store(1, std::memory_order_relaxed);
+        f.referenced.store(true, std::memory_order_relaxed);
+        map_[page] = v;
+        ReleaseSRWLockExclusive(&lock_);
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        // The frame is ours while it is loading, so the read needs no lock
+        char* data = arena_.data() + v * page_bytes_;
+        bool ok = reader_->read(first, count, data);
+
+        AcquireSRWLockExclusive(&lock_);
+        if(ok)
+            f.state = FrameState::ready;
+        else
+        {
+            map_.erase(page);
+            f.state = FrameState::empty;
+            f.pins.store(0, std::memory_order_relaxed);
+        }
+        ReleaseSRWLockExclusive(&lock_);
+        WakeAllConditionVariable(&loaded_);
+        return ok ? Pin(this, v, data, first, count) : Pin();
+    }
+
+    PageCache::Pin PageCache::pin_record(uint64_t record)
+    {
+        return pin(record / page_records_);
+    }
+
+    std::optional<Employee> PageCache::at(uint64_t record)
+    {
+        Pin p = pin_record(record);
+        if(!p.valid())
+            return std::nullopt;
+        return p[static_cast<size_t>(record - p.first())].materialize();
+    }
+
+    PageCacheStats PageCache::stats() const noexcept
+    {
+        PageCacheStats s;
+        s.hits = hits_.load(std::memory_order_relaxed);
+        s.misses = misses_.load(std::memory_order_relaxed);
+        s.evictions = evictions_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+} // namespace core::General
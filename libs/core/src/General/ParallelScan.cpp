@@ -0,0 +1,83 @@
+/**
+ * @file ParallelScan.cpp
+ * @brief Implementation of the partitioned scan driver.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/ParallelScan.h>
+#include <algorithm>
+
+namespace core::General
+{
+    ParallelScan::ParallelScan(EmployeeFileReader reader, FileMapping mapping, size_t workers, size_t batch) noexcept
+        : reader_(reader), mapping_(std::move(mapping)), workers_(workers), batch_(batch)
+    {
+    }
+
+    std::optional<ParallelScan> ParallelScan::open(const File& file, const ParallelScanOptions& opts)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(file);
+        if(!reader.has_value())
+            return std::nullopt;
+
+        FileMapping mapping;
+        // Both host-order layouts can be read in place; foreign files need conversion
+        if(opts.map_file && (reader->zero_copy() || reader->header().aligned_layout()) && 0 != reader->size())
+            mapping = FileMapping::open(file);
+
+        uint64_t useful = (reader->size() + MIN_RECORDS_PER_THREAD - 1) / MIN_RECORDS_PER_THREAD;
+        size_t workers = static_cast<size_t>(
+            std::max<uint64_t>(1, std::min<uint64_t>(Parallel::workers(opts.threads), useful)));
+        return ParallelScan(*reader, std::move(mapping), workers, std::max<size_t>(opts.batch_records, 1));
+    }
+
+    const EmployeeFileReader& ParallelScan::reader() const noexcept
+    { return reader_; }
+
+    uint64_t ParallelScan::size() const noexcept
+    { return reader_.size(); }
+
+    size_t ParallelScan::workers() const noexcept
+    { return workers_; }
+
+    size_t ParallelScan::batch_records() const noexcept
+    { return batch_; }
+
+    bool ParallelScan::mapped() const noexcept
+    { return mapping_.is_mapped(); }
+
+    uint64_t ParallelScan::begin(size_t w) const noexcept
+    {
+        // Ranges are counted in records, so every boundary is record-aligned
+        return reader_.size() / workers_ * w + std::min<uint64_t>(w, reader_.size() % workers_);
+    }
+
+    const char* ParallelScan::fetch(uint64_t first, size_t n, std::vector<char>& buffer) const
+    {
+        if(first > reader_.size() || n > reader_.size() - first)
+            return nullptr;
+        if(mapping_.is_mapped() && reader_.zero_copy())
+            return mapping_.data() + reader_.header().record_offset(first);
+
+        if(buffer.size() < n * Employee::SERIALIZED_SIZE)
+            buffer.resize(n * Employee::SERIALIZED_SIZE);
+        if(mapping_.is_mapped())
+        {
+            // Aligned records: the data offset is a multiple of the record size and the view is page aligned
+            AlignedEmployee::to_records(reinterpret_cast<const AlignedEmployee*>(
+                                            mapping_.data() + reader_.header().record_offset(first)),
+                                        n, buffer.data());
+            return buffer.data();
+        }
+        return reader_.read(first, n, buffer.data()) ? buffer.data() : nullptr;
+    }
+
+    EmployeeRecords ParallelScan::fetch_records(uint64_t first, size_t n, std::vector<char>& buffer) const
+    {
+        if(mapping_.is_mapped() && first <= reader_.size() && n <= reader_.size() - first)
+            return EmployeeRecords(mapping_.data() + reader_.header().record_offset(first), reader_.header().layout());
+        return EmployeeRecords(fetch(first, n, buffer));
+    }
+
+} // namespace core::General
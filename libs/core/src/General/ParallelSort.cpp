@@ -0,0 +1,266 @@
+/**
+ * @file ParallelSort.cpp
+ * @brief Implementation of the parallel radix and merge sorts.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/ParallelSort.h>
+#include <core/General/Parallel.h>
+#include <algorithm>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        typedef ParallelSort::KeyIndex KeyIndex;
+        constexpr size_t BUCKETS = size_t(1) << ParallelSort::RADIX_BITS;
+
+        size_t effective_workers(size_t n, size_t threads) noexcept
+        {
+            size_t by_size = std::max<size_t>(1, n / ParallelSort::MIN_PARALLEL_ROWS);
+            return std::min(Parallel::workers(threads), by_size);
+        }
+
+        /**
+         * @brief Finds how many of the first @p k merged elements come from @p a.
+         *
+         * Merge-path co-ranking: lets each worker merge an independent,
+         * equally sized slice of the output.
+         */
+        template <class Less>
+        size_t co_rank(size_t k, const KeyIndex* a, size_t na, const KeyIndex* b, size_t nb, const Less& less)
+        {
+            size_t lo = k > nb ? k - nb : 0;
+            size_t hi = std::min(k, na);
+            while(lo < hi)
+            {
+                size_t i = lo + (hi - lo) / 2;
+                size_t j = k - i;
+                // a[i] must be taken before b[j - 1]: the split point lies further right
+                if(0 < j && i < na && !less(b[j - 1], a[i]))
+                    lo = i + 1;
+                else
+                    hi = i;
+            }
+            return lo;
+        }
+
+        /** @brief Merges sorted [a, a + na) and [b, b + nb) into @p out using @p workers threads. */
+        template <class Less>
+        void parallel_merge(const KeyIndex* a, size_t na, const KeyIndex* b, size_t nb,
+                            KeyIndex* out, size_t workers, const Less& less)
+        {
+            std::vector<size_t> bounds = Parallel::split(na + nb, workers);
+            Parallel::run(workers, [&](size_t w) {
+                size_t k0 = bounds[w], k1 = bounds[w + 1];
+                size_t i0 = co_rank(k0, a, na, b, nb, less), i1 = co_rank(k1, a, na, b, nb, less);
+                std::merge(a + i0, a + i1, b + (k0 - i0), b + (k1 - i1), out + k0, less);
+            });
+        }
+
+        /** @brief Parallel merge sort: sort slices independently, then merge pairs level by level. */
+        template <class Less>
+        void merge_sort(std::vector<KeyIndex>& items, size_t threads, const Less& less)
+        {
+            size_t workers = effective_workers(items.size(), threads);
+            std::vector<size_t> bounds = Parallel::split(items.size(), workers);
+            Parallel::run(workers, [&](size_t w) {
+                std::sort(items.begin() + bounds[w], items.begin() + bounds[w + 1], less);
+            });
+
+            std::vector<KeyIndex> scratch(items.size());
+            for(size_t width = 1; width < workers; width *= 2)
+            {
+                for(size_t s = 0; s < workers; s += 2 * width)
+                {
+                    size_t lo = bounds[s];
+                    size_t mid = bounds[std::min(s + width, workers)];
+                    size_t hi = bounds[std::min(s + 2 * width, workers)];
+                    parallel_merge(items.data() + lo, mid - lo, items.data() + mid, hi - mid,
+                                   scratch.data() + lo, workers, less);
+                }
+                items.swap(scratch);
+            }
+        }
+
+        /** @brief Builds the pairs in parallel from a per-row key function. */
+        template <class KeyOf>
+        std::vector<KeyIndex> make_items(size_t n, size_t threads, const KeyOf& key_of)
+        {
+            std::vector<KeyIndex> items(n);
+            size_t workers = effective_workers(n, threads);
+            std::vector<size_t> bounds = Parallel::split(n, workers);
+            Parallel::run(workers, [&](size_t w) {
+                for(size_t i = bounds[w]; i < bounds[w + 1]; i++)
+                    items[i] = { key_of(i), static_cast<uint32_t>(i) };
+            });
+            return items;
+        }
+
+        /**
+         * @brief Sorts the pairs by @p key and turns them into a permutation.
+         * @param name_of Returns the name buffer of a row; used only for SortKey::name ties.
+         */
+        template <class NameOf>
+        std::vector<uint32_t> finish_order(std::vector<KeyIndex>& items, SortKey key, size_t threads,
+                                           const NameOf& name_of)
+        {
+            if(SortKey::name == key)
+            {
+                auto less = [&](const KeyIndex& a, const KeyIndex& b) {
+                    if(a.key != b.key) return a.key < b.key;
+                    int c = memcmp(name_of(a.index), name_of(b.index), Employee::BUFF_SIZE);
+                    return 0 != c ? c < 0 : a.index < b.index;
+                };
+                merge_sort(items, threads, less);
+            }
+            else
+            {
+                std::vector<KeyIndex> scratch;
+                unsigned bits = (SortKey::id == key) ? 8 * sizeof(Employee::ID_TYPE) : 64;
+                ParallelSort::radix_sort(items, scratch, bits, threads);
+            }
+
+            std::vector<uint32_t> order(items.size());
+            for(size_t i = 0; i < items.size(); i++)
+                order[i] = items[i].index;
+            return order;
+        }
+
+        /** @brief Replaces @p column with its rows in @p order; each worker fills one slice of @p bounds. */
+        template <class T>
+        void gather_column(std::vector<T>& column, const std::vector<uint32_t>& order,
+                           const std::vector<size_t>& bounds, size_t workers)
+        {
+            std::vector<T> out(order.size());
+            Parallel::run(workers, [&](size_t w) {
+                for(size_t i = bounds[w]; i < bounds[w + 1]; i++)
+                    out[i] = column[order[i]];
+            });
+            column.swap(out);
+        }
+    } // namespace
+
+    void ParallelSort::radix_sort(std::vector<KeyIndex>& items, std::vector<KeyIndex>& scratch,
+                                  unsigned key_bits, size_t threads)
+    {
+        const size_t n = items.size();
+        scratch.resize(n);
+        const size_t workers = effective_workers(n, threads);
+        std::vector<size_t> bounds = Parallel::split(n, workers);
+        std::vector<size_t> hist(workers * BUCKETS);
+
+        for(unsigned shift = 0; shift < key_bits; shift += RADIX_BITS)
+        {
+            const KeyIndex* src = items.data();
+            KeyIndex* dst = scratch.data();
+
+            // 1. Per-worker digit histograms
+            std::fill(hist.begin(), hist.end(), 0);
+            Parallel::run(workers, [&](size_t w) {
+                size_t* h = &hist[w * BUCKETS];
+                for(size_t i = bounds[w]; i < bounds[w + 1]; i++)
+                    h[(src[i].key >> shift) & (BUCKETS - 1)]++;
+            });
+
+            // 2. Exclusive prefix sum in (digit, worker) order keeps the pass stable.
+            //    A digit shared by every key leaves the order unchanged, so the pass is skipped.
+            size_t sum = 0;
+            bool trivial = false;
+            for(size_t d = 0; d < BUCKETS; d++)
+            {
+                size_t digit_total = 0;
+                for(size_t w = 0; w < workers; w++)
+                {
+                    size_t c = hist[w * BUCKETS + d];
+                    hist[w * BUCKETS + d] = sum;
+                    sum += c;
+                    digit_total += c;
+                }
+                trivial = trivial || (digit_total == n);
+            }
+            if(trivial)
+                continue;
+
+            // 3. Scatter
+            Parallel::run(workers, [&](size_t w) {
+                size_t* h = &hist[w * BUCKETS];
+                for(size_t i = bounds[w]; i < bounds[w + 1]; i++)
+                    dst[h[(src[i].key >> shift) & (BUCKETS - 1)]++] = src[i];
+            });
+            items.swap(scratch);
+        }
+    }
+
+    std::optional<std::vector<uint32_t>> ParallelSort::order(const Employee* data, size_t n, SortKey key,
+                                                             size_t threads)
+    {
+        if(n > MAX_ROWS)
+            return std::nullopt;
+        std::vector<KeyIndex> items = make_items(n, threads, [&](size_t i) -> uint64_t {
+            switch(key)
+            {
+            case SortKey::id:    return data[i].id();
+            case SortKey::hours: return RecordOrder::hours_key(data[i].hours());
+            default:             return RecordOrder::name_prefix(data[i].name());
+            }
+        });
+        return finish_order(items, key, threads, [&](uint32_t i) { return data[i].name(); });
+    }
+
+    std::optional<std::vector<uint32_t>> ParallelSort::order(const EmployeeColumns& table, SortKey key,
+                                                             size_t threads)
+    {
+        if(table.size() > MAX_ROWS)
+            return std::nullopt;
+        const auto& ids = table.ids();
+        const auto& hours = table.hours();
+        const auto& names = table.names();
+        std::vector<KeyIndex> items = make_items(table.size(), threads, [&](size_t i) -> uint64_t {
+            switch(key)
+            {
+            case SortKey::id:    return ids[i];
+            case SortKey::hours: return RecordOrder::hours_key(hours[i]);
+            default:             return RecordOrder::name_prefix(names[i].data());
+            }
+        });
+        return finish_order(items, key, threads, [&](uint32_t i) { return names[i].data(); });
+    }
+
+    bool ParallelSort::sort(Employee* data, size_t n, SortKey key, size_t threads)
+    {
+        std::optional<std::vector<uint32_t>> perm = order(data, n, key, threads);
+        if(!perm.has_value())
+            return false;
+
+        // Gather into a scratch array, then copy back; each worker owns the same slice in both passes
+        std::vector<Employee> sorted(n);
+        size_t workers = effective_workers(n, threads);
+        std::vector<size_t> bounds = Parallel::split(n, workers);
+        Parallel::run(workers, [&](size_t w) {
+            for(size_t i = bounds[w]; i < bounds[w + 1]; i++)
+                sorted[i] = data[(*perm)[i]];
+        });
+        Parallel::run(workers, [&](size_t w) {
+            std::copy(sorted.begin() + bounds[w], sorted.begin() + bounds[w + 1], data + bounds[w]);
+        });
+        return true;
+    }
+
+    bool ParallelSort::sort(EmployeeColumns& table, SortKey key, size_t threads)
+    {
+        std::optional<std::vector<uint32_t>> perm = order(table, key, threads);
+        if(!perm.has_value())
+            return false;
+
+        size_t workers = effective_workers(table.size(), threads);
+        std::vector<size_t> bounds = Parallel::split(table.size(), workers);
+        gather_column(table.ids(), *perm, bounds, workers);
+        gather_column(table.hours(), *perm, bounds, workers);
+        gather_column(table.names(), *perm, bounds, workers);
+        return true;
+    }
+
+} // namespace core::General
@@ -0,0 +1,142 @@
+/**
+ * @file Pipe.cpp
+ * @brief Implementation of the Pipe wrapper and record streaming helpers.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/Pipe.h>
+#include <algorithm>
+#include <vector>
+
+namespace core::General
+{
+    Pipe::Pipe(File&& read, File&& write) noexcept
+        : read_(std::move(read)), write_(std::move(write))
+    {
+    }
+
+    Pipe::Pipe() noexcept
+    {
+    }
+
+    std::optional<Pipe> Pipe::create(DWORD buffer_size) noexcept
+    {
+        HANDLE r = nullptr, w = nullptr;
+        if(!CreatePipe(&r, &w, nullptr, buffer_size))
+            return std::nullopt;
+        return Pipe(File(r), File(w));
+    }
+
+    const File& Pipe::reader() const noexcept
+    { return read_; }
+
+    const File& Pipe::writer() const noexcept
+    { return write_; }
+
+    File Pipe::release(PipeEnd end) noexcept
+    {
+        return std::move(PipeEnd::read == end ? read_ : write_);
+    }
+
+    bool Pipe::close(PipeEnd end) noexcept
+    {
+        return (PipeEnd::read == end ? read_ : write_).close();
+    }
+
+    bool Pipe::set_inheritable(const File& end, bool inheritable) noexcept
+    {
+        return FALSE != SetHandleInformation(end.handle(), HANDLE_FLAG_INHERIT, inheritable ? HANDLE_FLAG_INHERIT : 0);
+    }
+
+    File Pipe::create_named(const char* name, DWORD access, DWORD buffer_size) noexcept
+    {
+        HANDLE h = CreateNamedPipeA(name, access, PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT,
+                                    1, buffer_size, buffer_size, 0, nullptr);
+        return File(INVALID_HANDLE_VALUE == h ? nullptr : h);
+    }
+
+    bool Pipe::connect(const File& server) noexcept
+    {
+        // A client that connected between creation and this call is not an error
+        return ConnectNamedPipe(server.handle(), nullptr) || ERROR_PIPE_CONNECTED == GetLastError();
+    }
+
+    File Pipe::open_named(const char* name, DWORD access) noexcept
+    {
+        return File::open(name, access, 0, nullptr, OPEN_EXISTING, 0, nullptr);
+    }
+
+    bool Pipe::write_all(const File& end, const char* data, size_t size) noexcept
+    {
+        while(0 != size)
+        {
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(size, MAX_IO_SIZE));
+            DWORD written = 0;
+            if(!WriteFile(end.handle(), data, chunk, &written, nullptr) || 0 == written)
+                return false;
+            data += written;
+            size -= written;
+        }
+        return true;
+    }
+
+    size_t Pipe::read_full(const File& end, char* buf, size_t size) noexcept
+    {
+        size_t total = 0;
+        while(total < size)
+        {
+            DWORD chunk = static_cast<DWORD>(std::min<size_t>(size - total, MAX_IO_SIZE));
+            DWORD got = 0;
+            // A closed write end shows up as ERROR_BROKEN_PIPE rather than a zero-byte read
+            if(!ReadFile(end.handle(), buf + total, chunk, &got, nullptr) || 0 == got)
+                break;
+            total += got;
+        }
+        return total;
+    }
+
+    bool Pipe::write_records(const File& end, const char* records, size_t n) noexcept
+    {
+        return write_all(end, records, n * Employee::SERIALIZED_SIZE);
+    }
+
+    bool Pipe::write_employees(const File& end, const Employee* src, size_t n) noexcept
+    {
+        std::vector<char> batch(std::min(n, BATCH_RECORDS) * Employee::SERIALIZED_SIZE);
+        for(size_t done = 0; done < n; done += BATCH_RECORDS)
+        {
+            size_t count = std::min(BATCH_RECORDS, n - done);
+            Employee::serialize_batch(src + done, count, batch.data());
+            if(!write_records(end, batch.data(), count))
+                return false;
+        }
+        return true;
+    }
+
+    size_t Pipe::read_records(const File& end, char* out, size_t max) noexcept
+    {
+        constexpr size_t R = Employee::SERIALIZED_SIZE;
+        if(0 == max)
+            return 0;
+
+        // Take what the pipe has now; only a record split across writes needs a second read
+        DWORD got = 0;
+        DWORD want = static_cast<DWORD>(std::min<size_t>(max, MAX_IO_SIZE / R) * R);
+        if(!ReadFile(end.handle(), out, want, &got, nullptr) || 0 == got)
+            return 0;
+        size_t bytes = got;
+        if(0 != bytes % R)
+            bytes += read_full(end, out + bytes, R - bytes % R);
+        return bytes / R;
+    }
+
+    size_t Pipe::read_employees(const File& end, Employee* out, size_t max) noexcept
+    {
+        std::vector<char> batch(std::min(max, BATCH_RECORDS) * Employee::SERIALIZED_SIZE);
+        size_t n = read_records(end, batch.data(), std::min(max, BATCH_RECORDS));
+        Employee::deserialize_batch(batch.data(), n, out);
+        return n;
+    }
+
+} // namespace core::General
@@ -0,0 +1,306 @@
+/**
+ * @file Query.cpp
+ * @brief Implementation of the batch query engine.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/Query.h>
+#include <core/General/Bits.h>
+#include <core/General/EmployeeFile.h>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CORE_QUERY_SSE2 1
+#endif
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t WORDS = (Query::BATCH_ROWS + 63) / 64;
+
+        inline size_t words_for(size_t n) noexcept
+        { return (n + 63) / 64; }
+
+        inline void set_bits(uint64_t* bits, size_t i, uint64_t mask) noexcept
+        { bits[i >> 6] |= mask << (i & 63); }
+
+        void match_ids(const Employee::ID_TYPE* ids, size_t n, Employee::ID_TYPE lo, Employee::ID_TYPE hi,
+                       uint64_t* bits) noexcept
+        {
+            if(lo > hi)
+                return;
+            // lo <= v <= hi  <=>  (v - lo) <= (hi - lo) in unsigned arithmetic
+            const Employee::ID_TYPE range = static_cast<Employee::ID_TYPE>(hi - lo);
+            size_t i = 0;
+#ifdef CORE_QUERY_SSE2
+            const __m128i vlo = _mm_set1_epi16(static_cast<short>(lo));
+            const __m128i vrange = _mm_set1_epi16(static_cast<short>(range));
+            const __m128i zero = _mm_setzero_si128();
+            for(; i + 8 <= n; i += 8)
+            {
+                __m128i v = _mm_sub_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ids + i)), vlo);
+                // Saturating subtraction is zero exactly when v <= range
+                __m128i in = _mm_cmpeq_epi16(_mm_subs_epu16(v, vrange), zero);
+                set_bits(bits, i, static_cast<uint64_t>(_mm_movemask_epi8(_mm_packs_epi16(in, zero))));
+            }
+#endif
+            for(; i < n; i++)
+                set_bits(bits, i, static_cast<Employee::ID_TYPE>(ids[i] - lo) <= range ? 1u : 0u);
+        }
+
+        void match_hours(const double* hours, size_t n, double lo, double hi, uint64_t* bits) noexcept
+        {
+            size_t i = 0;
+#ifdef CORE_QUERY_SSE2
+            const __m128d vlo = _mm_set1_pd(lo);
+            const __m128d vhi = _mm_set1_pd(hi);
+            for(; i + 8 <= n; i += 8)
+            {
+                // Ordered comparisons are false for NaN, so NaN rows never match
+                uint64_t m = 0;
+                for(size_t k = 0; k < 8; k += 2)
+                {
+                    __m128d v = _mm_loadu_pd(hours + i + k);
+                    __m128d in = _mm_and_pd(_mm_cmpge_pd(v, vlo), _mm_cmple_pd(v, vhi));
+                    m |= static_cast<uint64_t>(_mm_movemask_pd(in)) << k;
+                }
+                set_bits(bits, i, m);
+            }
+#endif
+            for(; i < n; i++)
+                set_bits(bits, i, (lo <= hours[i] && hours[i] <= hi) ? 1u : 0u);
+        }
+
+        void match_prefix(const EmployeeColumns::Name* names, size_t n, const std::string& prefix,
+                          uint64_t* bits) noexcept
+        {
+            const size_t len = prefix.size();
+            if(len <= sizeof(uint64_t))
+            {
+                // Compare the first 8 bytes of each cell under a mask in one integer operation
+                static_assert(sizeof(uint64_t) <= Employee::BUFF_SIZE, "A name cell must hold one word");
+                uint64_t want = 0, mask = 0;
+                memcpy(&want, prefix.data(), len);
+                memset(&mask, 0xFF, len);
+                for(size_t i = 0; i < n; i++)
+                {
+                    uint64_t w;
+                    memcpy(&w, names[i].data(), sizeof(w));
+                    set_bits(bits, i, (w & mask) == want ? 1u : 0u);
+                }
+                return;
+            }
+            for(size_t i = 0; i < n; i++)
+                set_bits(bits, i, 0 == memcmp(names[i].data(), prefix.data(), len) ? 1u : 0u);
+        }
+    } // namespace
+
+    // --- Predicate ---
+
+    Predicate::Predicate(Kind kind) noexcept
+        : kind_(kind), id_lo_(0), id_hi_(0), hours_lo_(0), hours_hi_(0)
+    {
+    }
+
+    Predicate::Predicate() noexcept
+        : Predicate(Kind::all)
+    {
+    }
+
+    Predicate Predicate::all() noexcept
+    { return Predicate(Kind::all); }
+
+    Predicate Predicate::id_between(Employee::ID_TYPE lo, Employee::ID_TYPE hi) noexcept
+    {
+        Predicate p(Kind::id_range);
+        p.id_lo_ = lo;
+        p.id_hi_ = hi;
+        return p;
+    }
+
+    Predicate Predicate::hours_between(double lo, double hi) noexcept
+    {
+        Predicate p(Kind::hours_range);
+        p.hours_lo_ = lo;
+        p.hours_hi_ = hi;
+        return p;
+    }
+
+    Predicate Predicate::name_starts_with(const std::string& prefix)
+    {
+        Predicate p(Kind::name_prefix);
+        p.prefix_ = prefix;
+        return p;
+    }
+
+    Predicate operator&&(Predicate a, Predicate b)
+    {
+        Predicate p(Predicate::Kind::all_of);
+        for(Predicate* side : { &a, &b })
+        {
+            if(Predicate::Kind::all_of == side->kind_)
+                std::move(side->children_.begin(), side->children_.end(), std::back_inserter(p.children_));
+            else
+                p.children_.push_back(std::move(*side));
+        }
+        return p;
+    }
+
+    Predicate operator||(Predicate a, Predicate b)
+    {
+        Predicate p(Predicate::Kind::any_of);
+        for(Predicate* side : { &a, &b })
+        {
+            if(Predicate::Kind::any_of == side->kind_)
+                std::move(side->children_.begin(), side->children_.end(), std::back_inserter(p.children_));
+            else
+                p.children_.push_back(std::move(*side));
+        }
+        return p;
+    }
+
+    Predicate::Kind Predicate::kind() const noexcept
+    { return kind_; }
+
+    void Predicate::evaluate(const EmployeeColumns& table, size_t first, size_t n, uint64_t* bits) const
+    {
+        const size_t words = words_for(n);
+        std::fill(bits, bits + words, 0);
+
+        switch(kind_)
+        {
+        case Kind::all:
+            std::fill(bits, bits + words, ~uint64_t(0));
+            if(0 != (n & 63))
+                bits[words - 1] = (uint64_t(1) << (n & 63)) - 1;
+            break;
+        case Kind::id_range:
+            match_ids(table.ids().data() + first, n, id_lo_, id_hi_, bits);
+            break;
+        case Kind::hours_range:
+            match_hours(table.hours().data() + first, n, hours_lo_, hours_hi_, bits);
+            break;
+        case Kind::name_prefix:
+            if(prefix_.size() <= Employee::BUFF_SIZE)
+                match_prefix(table.names().data() + first, n, prefix_, bits);
+            break;
+        case Kind::all_of:
+        case Kind::any_of:
+        {
+            const bool conjunction = (Kind::all_of == kind_);
+            if(children_.empty())
+            {
+                if(conjunction) Predicate::all().evaluate(table, first, n, bits);
+                break;
+            }
+            children_[0].evaluate(table, first, n, bits);
+            uint64_t local[WORDS];
+            std::vector<uint64_t> heap;
+            uint64_t* child = local;
+            if(words > WORDS)
+            {
+                heap.resize(words);
+                child = heap.data();
+            }
+            for(size_t c = 1; c < children_.size(); c++)
+            {
+                if(conjunction)
+                {
+                    // Nothing left to narrow down
+                    uint64_t any = 0;
+                    for(size_t w = 0; w < words; w++) any |= bits[w];
+                    if(0 == any) break;
+                }
+                children_[c].evaluate(table, first, n, child);
+                for(size_t w = 0; w < words; w++)
+                    bits[w] = conjunction ? (bits[w] & child[w]) : (bits[w] | child[w]);
+            }
+            break;
+        }
+        }
+    }
+
+    // --- Query ---
+
+    Query::Query() noexcept
+        : columns_(0)
+    {
+    }
+
+    Query& Query::where(Predicate predicate)
+    {
+        where_ = std::move(predicate);
+        return *this;
+    }
+
+    Query& Query::select(unsigned columns) noexcept
+    {
+        columns_ = columns;
+        return *this;
+    }
+
+    void Query::scan_(const EmployeeColumns& table, uint64_t row_base, QueryResult& result) const
+    {
+        uint64_t bits[WORDS];
+        QueryTotals& t = result.totals;
+        for(size_t first = 0; first < table.size(); first += BATCH_ROWS)
+        {
+            size_t n = std::min(BATCH_ROWS, table.size() - first);
+            where_.evaluate(table, first, n, bits);
+
+            for(size_t w = 0; w < words_for(n); w++)
+            {
+                for(uint64_t m = bits[w]; 0 != m; m &= m - 1)
+                {
+                    size_t i = first + w * 64 + Bits::trailing_zeros(m);
+                    double h = table.hours()[i];
+                    t.count++;
+                    t.hours_sum += h;
+                    if(h < t.hours_min) t.hours_min = h;
+                    if(h > t.hours_max) t.hours_max = h;
+
+                    if(0 != (columns_ & COLUMN_ROW)) result.rows.push_back(row_base + i);
+                    if(0 != (columns_ & COLUMN_ID)) result.ids.push_back(table.ids()[i]);
+                    if(0 != (columns_ & COLUMN_HOURS)) result.hours.push_back(h);
+                    if(0 != (columns_ & COLUMN_NAME)) result.names.push_back(table.names()[i]);
+                }
+            }
+        }
+    }
+
+    QueryResult Query::run(const EmployeeColumns& table) const
+    {
+        QueryResult result;
+        scan_(table, 0, result);
+        return result;
+    }
+
+    std::optional<QueryResult> Query::run(const File& file) const
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(file);
+        if(!reader.has_value())
+            return std::nullopt;
+
+        QueryResult result;
+        std::vector<char> raw(FILE_BATCH_ROWS * Employee::SERIALIZED_SIZE);
+        EmployeeColumns batch;
+        batch.reserve(FILE_BATCH_ROWS);
+        for(uint64_t first = 0; first < reader->size(); first += FILE_BATCH_ROWS)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(FILE_BATCH_ROWS, reader->size() - first));
+            if(!reader->read(first, n, raw.data()))
+                return std::nullopt;
+            batch.clear();
+            for(size_t i = 0; i < n; i++)
+                batch.push_back_record(&raw[i * Employee::SERIALIZED_SIZE]);
+            scan_(batch, first, result);
+        }
+        return result;
+    }
+
+} // namespace core::General
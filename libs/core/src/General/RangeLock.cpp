@@ -0,0 +1,100 @@
+/**
+ * @file RangeLock.cpp
+ * @brief Implementation of the byte-range lock guard.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/RangeLock.h>
+#include <algorithm>
+
+namespace core::General
+{
+    RangeLock::RangeLock(const File& file, uint64_t offset, uint64_t length, LockMode mode) noexcept
+        : file_(&file), offset_(offset), length_(length), mode_(mode)
+    {
+    }
+
+    RangeLock::RangeLock() noexcept
+        : file_(nullptr), offset_(0), length_(0), mode_(LockMode::shared)
+    {
+    }
+
+    RangeLock::RangeLock(RangeLock&& other) noexcept
+        : file_(other.file_), offset_(other.offset_), length_(other.length_), mode_(other.mode_)
+    {
+        other.file_ = nullptr;
+    }
+
+    RangeLock& RangeLock::operator=(RangeLock&& other) noexcept
+    {
+        if(&other != this)
+        {
+            release();
+            file_ = other.file_;
+            offset_ = other.offset_;
+            length_ = other.length_;
+            mode_ = other.mode_;
+            other.file_ = nullptr;
+        }
+        return *this;
+    }
+
+    RangeLock::~RangeLock() noexcept
+    {
+        release();
+    }
+
+    std::optional<RangeLock> RangeLock::acquire(const File& file, uint64_t offset, uint64_t length,
+                                                LockMode mode, DWORD timeout_ms) noexcept
+    {
+        if(!file.lockRange(offset, length, LockMode::exclusive == mode, timeout_ms))
+            return std::nullopt;
+        return RangeLock(file, offset, length, mode);
+    }
+
+    std::optional<RangeLock> RangeLock::try_acquire(const File& file, uint64_t offset, uint64_t length,
+                                                    LockMode mode) noexcept
+    {
+        return acquire(file, offset, length, mode, 0);
+    }
+
+    std::optional<RangeLock> RangeLock::records(const File& file, const EmployeeFileHeader& header,
+                                                uint64_t first, uint64_t count,
+                                                LockMode mode, DWORD timeout_ms) noexcept
+    {
+        if(first > header.record_count || count > header.record_count - first)
+            return std::nullopt;
+
+        uint64_t last = first + count;
+        if(0 != header.block_count && 0 != count)
+        {
+            first -= first % header.block_records;
+            last = std::min(header.record_count, (last + header.block_records - 1) / header.block_records
+                                                     * header.block_records);
+        }
+        return acquire(file, header.record_offset(first), (last - first) * header.record_size, mode, timeout_ms);
+    }
+
+    bool RangeLock::release() noexcept
+    {
+        if(nullptr == file_)
+            return false;
+        bool ok = file_->unlockRange(offset_, length_);
+        file_ = nullptr;
+        return ok;
+    }
+
+    bool RangeLock::owns() const noexcept
+    { return nullptr != file_; }
+
+    uint64_t RangeLock::offset() const noexcept
+    { return offset_; }
+
+    uint64_t RangeLock::length() const noexcept
+    { return length_; }
+
+    LockMode RangeLock::mode() const noexcept
+    { return mode_; }
+
+} // namespace core::General
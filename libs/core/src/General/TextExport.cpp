@@ -0,0 +1,186 @@
+/**
+ * @file TextExport.cpp
+ * @brief Implementation of the parallel text exporter.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/TextExport.h>
+#include <core/General/BufferedIO.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/Parallel.h>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t RECORD = Employee::SERIALIZED_SIZE;
+
+        inline char* put(char* out, const char* s, size_t n) noexcept
+        {
+            memcpy(out, s, n);
+            return out + n;
+        }
+
+        template <size_t N>
+        inline char* put(char* out, const char (&s)[N]) noexcept
+        { return put(out, s, N - 1); }
+
+        inline bool line_break(char c) noexcept
+        { return '\n' == c || '\r' == c; }
+
+        // TextImport splits its input on raw newlines, even inside quotes, so line breaks become spaces
+        char* put_csv_name(char* out, const char* name, size_t len, char delimiter) noexcept
+        {
+            bool quote = false;
+            for(size_t i = 0; i < len && !quote; i++)
+                quote = (delimiter == name[i] || '"' == name[i]);
+
+            if(quote) *out++ = '"';
+            for(size_t i = 0; i < len; i++)
+            {
+                if('"' == name[i]) *out++ = '"';
+                *out++ = line_break(name[i]) ? ' ' : name[i];
+            }
+            if(quote) *out++ = '"';
+            return out;
+        }
+
+        char* put_tsv_name(char* out, const char* name, size_t len) noexcept
+        {
+            for(size_t i = 0; i < len; i++)
+            {
+                char c = name[i];
+                *out++ = ('\t' == c || line_break(c)) ? ' ' : c;
+            }
+            return out;
+        }
+
+        char* put_json_name(char* out, const char* name, size_t len) noexcept
+        {
+            static const char HEX[] = "0123456789abcdef";
+            *out++ = '"';
+            for(size_t i = 0; i < len; i++)
+            {
+                unsigned char c = static_cast<unsigned char>(name[i]);
+                if('"' == c || '\\' == c)
+                {
+                    *out++ = '\\';
+                    *out++ = static_cast<char>(c);
+                }
+                else if(c < 0x20)
+                {
+                    out = put(out, "\\u00");
+                    *out++ = HEX[c >> 4];
+                    *out++ = HEX[c & 15];
+                }
+                else
+                    *out++ = static_cast<char>(c);
+            }
+            *out++ = '"';
+            return out;
+        }
+
+        /** @brief Formats @p n consecutive records of @p raw into @p text. */
+        void format_range(const char* raw, size_t n, TextFormat format, std::vector<char>& text)
+        {
+            text.resize(n * TextExport::MAX_LINE);
+            size_t used = 0;
+            for(size_t i = 0; i < n; i++)
+                used += TextExport::format_record(raw + i * RECORD, format, &text[used]);
+            text.resize(used);
+        }
+    } // namespace
+
+    size_t TextExport::format_record(const char* record, TextFormat format, char* out) noexcept
+    {
+        typedef Employee::Schema S;
+        const Employee::ID_TYPE id = S::read<Employee::FIELD_ID>(record);
+        const double hours = S::read<Employee::FIELD_HOURS>(record);
+        const char* name = record + S::offset<Employee::FIELD_NAME>();
+        const size_t len = strnlen(name, Employee::BUFF_SIZE);
+        char* const start = out;
+        char* const limit = out + MAX_LINE;
+
+        if(TextFormat::jsonl == format)
+        {
+            out = put(out, "{\"id\":");
+            out = std::to_chars(out, limit, id).ptr;
+            out = put(out, ",\"name\":");
+            out = put_json_name(out, name, len);
+            out = put(out, ",\"hours\":");
+            if(std::isfinite(hours))
+                out = std::to_chars(out, limit, hours).ptr;
+            else
+                out = put(out, "null");
+            *out++ = '}';
+        }
+        else
+        {
+            const char delimiter = text_delimiter(format);
+            out = std::to_chars(out, limit, id).ptr;
+            *out++ = delimiter;
+            out = TextFormat::csv == format ? put_csv_name(out, name, len, delimiter)
+                                            : put_tsv_name(out, name, len);
+            *out++ = delimiter;
+            out = std::to_chars(out, limit, hours).ptr;
+        }
+        *out++ = '\n';
+        return static_cast<size_t>(out - start);
+    }
+
+    std::optional<uint64_t> TextExport::run(const File& input, const File& output, const TextExportOptions& options)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(input);
+        if(!reader.has_value() || !output.is_opened())
+            return std::nullopt;
+
+        const uint64_t total = reader->size();
+        const size_t workers = Parallel::workers(options.threads);
+        const size_t chunk = std::max(options.chunk_records, MIN_CHUNK_RECORDS);
+        std::vector<std::vector<char>> raw(workers), text(workers);
+        std::vector<char> ok(workers);
+        BufferedWriter out(output, 0, 4u << 20);
+
+        if(options.write_header && TextFormat::jsonl != options.format)
+        {
+            char header[] = "id,name,hours\n";
+            if(TextFormat::tsv == options.format)
+                header[2] = header[7] = '\t';
+            if(!out.write(header, sizeof(header) - 1))
+                return std::nullopt;
+        }
+
+        for(uint64_t first = 0; first < total; )
+        {
+            size_t round = static_cast<size_t>(std::min<uint64_t>(uint64_t(workers) * chunk, total - first));
+            size_t slices = std::min(workers, (round + MIN_CHUNK_RECORDS - 1) / MIN_CHUNK_RECORDS);
+            std::vector<size_t> bounds = Parallel::split(round, slices);
+
+            Parallel::run(slices, [&](size_t s) {
+                size_t n = bounds[s + 1] - bounds[s];
+                raw[s].resize(n * RECORD);
+                ok[s] = reader->read(first + bounds[s], n, raw[s].data());
+                if(ok[s])
+                    format_range(raw[s].data(), n, options.format, text[s]);
+            });
+
+            // Concatenate in input order
+            for(size_t s = 0; s < slices; s++)
+                if(!ok[s] || !out.write(text[s].data(), text[s].size()))
+                    return std::nullopt;
+            first += round;
+        }
+
+        if(!out.flush())
+            return std::nullopt;
+        return total;
+    }
+
+} // namespace core::General
@@ -0,0 +1,235 @@
+/**
+ * @file TextImport.cpp
+ * @brief Implementation of the parallel CSV/TSV importer.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/TextImport.h>
+#include <core/General/BufferedIO.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/Parallel.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace core::General
+{
+    namespace
+    {
+        constexpr size_t RECORD = Employee::SERIALIZED_SIZE;
+
+        inline const char* find(const char* begin, const char* end, char c) noexcept
+        {
+            return static_cast<const char*>(memchr(begin, c, static_cast<size_t>(end - begin)));
+        }
+
+        /** @return One past the last '\n' in [begin, end), or nullptr if there is none. */
+        const char* after_last_newline(const char* begin, const char* end) noexcept
+        {
+            for(const char* p = end; p != begin; p--)
+                if('\n' == p[-1]) return p;
+            return nullptr;
+        }
+
+        /** @brief Destination of imported records: a versioned file or bare records. */
+        class RecordSink
+        {
+        private:
+            std::optional<EmployeeFileWriter> versioned_;
+            std::optional<BufferedWriter> bare_;
+
+        public:
+            RecordSink(const File& output, bool headerless)
+            {
+                if(headerless) bare_.emplace(output, 0, 4u << 20);
+                else versioned_.emplace(output);
+            }
+
+            bool append(const std::vector<char>& records) noexcept
+            {
+                size_t n = records.size() / RECORD;
+                if(0 == n) return true;
+                return versioned_.has_value() ? versioned_->append_records(records.data(), n)
+                                              : bare_->write(records.data(), records.size());
+            }
+
+            bool finish() noexcept
+            { return versioned_.has_value() ? versioned_->finish() : bare_->flush(); }
+        };
+    } // namespace
+
+    bool TextImport::parse_line(const char* begin, const char* end, TextFormat format, char* record) noexcept
+    {
+        if(TextFormat::jsonl == format)
+            return false;
+        const char delimiter = text_delimiter(format);
+
+        const char* d1 = find(begin, end, delimiter);
+        unsigned id = 0;
+        if(nullptr == d1)
+            return false;
+        auto r = std::from_chars(begin, d1, id);
+        if(std::errc() != r.ec || d1 != r.ptr || id > Employee::ID_MAX)
+            return false;
+
+        char name[Employee::BUFF_SIZE] = {};
+        size_t len = 0;
+        const char* p = d1 + 1;
+        const char* d2 = nullptr;
+        if(TextFormat::csv == format && p != end && '"' == *p)
+        {
+            for(p++; ; )
+            {
+                if(p == end)
+                    return false;
+                char c = *p++;
+                if('"' == c)
+                {
+                    if(p == end || '"' != *p) break;
+                    p++;
+                }
+                if(Employee::BUFF_SIZE == len)
+                    return false;
+                name[len++] = c;
+            }
+            if(p == end || delimiter != *p)
+                return false;
+            d2 = p;
+        }
+        else
+        {
+            d2 = find(p, end, delimiter);
+            if(nullptr == d2 || static_cast<size_t>(d2 - p) > Employee::BUFF_SIZE)
+                return false;
+            memcpy(name, p, static_cast<size_t>(d2 - p));
+        }
+
+        // from_chars stops at a third delimiter, which the ptr check then rejects
+        double hours = 0;
+        auto h = std::from_chars(d2 + 1, end, hours);
+        if(std::errc() != h.ec || end != h.ptr)
+            return false;
+
+        Employee::ID_TYPE key = static_cast<Employee::ID_TYPE>(id);
+        Employee::Schema::encode(record, &key, &hours, static_cast<const char*>(name));
+        return true;
+    }
+
+    void TextImport::parse(const char* begin, const char* end, TextFormat format,
+                           std::vector<char>& records, TextImportResult& result)
+    {
+        while(begin != end)
+        {
+            const char* newline = find(begin, end, '\n');
+            const char* line_end = nullptr == newline ? end : newline;
+            const char* last = line_end;
+            if(last != begin && '\r' == last[-1])
+                last--;
+            result.lines++;
+
+            if(last != begin)
+            {
+                size_t at = records.size();
+                records.resize(at + RECORD);
+                if(parse_line(begin, last, format, &records[at]))
+                    result.records++;
+                else
+                {
+                    records.resize(at);
+                    if(0 == result.bad_lines++)
+                        result.first_bad_line = result.lines;
+                }
+            }
+            begin = nullptr == newline ? end : newline + 1;
+        }
+    }
+
+    std::optional<TextImportResult> TextImport::run(const File& input, const File& output,
+                                                    const TextImportOptions& options)
+    {
+        std::optional<uint64_t> size = input.getFileSize64();
+        if(!size.has_value() || !output.is_opened() || TextFormat::jsonl == options.format)
+            return std::nullopt;
+
+        const size_t workers = Parallel::workers(options.threads);
+        const size_t chunk = std::max(options.chunk_size, MIN_CHUNK_SIZE);
+        std::vector<char> window(workers * chunk);
+        std::vector<std::vector<char>> records(workers);
+        std::vector<TextImportResult> partial(workers);
+        RecordSink sink(output, options.headerless_output);
+
+        TextImportResult total;
+        bool skip_header = options.skip_header;
+        uint64_t offset = 0;
+        size_t carry = 0;   // Bytes of an unfinished line kept from the previous round
+        for(;;)
+        {
+            size_t n = static_cast<size_t>(std::min<uint64_t>(window.size() - carry, size.value() - offset));
+            if(0 != n && !input.readAt(window.data() + carry, static_cast<DWORD>(n), offset))
+                return std::nullopt;
+            offset += n;
+            const bool last = (offset == size.value());
+            const char* begin = window.data();
+            const char* end = begin + carry + n;
+
+            // Only whole lines are parsed; a line longer than the window grows it
+            const char* cut = last ? end : after_last_newline(begin, end);
+            if(nullptr == cut)
+            {
+                carry += n;
+                window.resize(window.size() * 2);
+                continue;
+            }
+
+            if(skip_header && begin != cut)
+            {
+                const char* newline = find(begin, cut, '\n');
+                begin = nullptr == newline ? cut : newline + 1;
+                total.lines++;
+                skip_header = false;
+            }
+
+            // One slice per worker, each ending just after a newline
+            size_t length = static_cast<size_t>(cut - begin);
+            size_t slices = std::max<size_t>(1, std::min(workers, length / MIN_CHUNK_SIZE));
+            std::vector<const char*> bounds(slices + 1, cut);
+            bounds[0] = begin;
+            std::vector<size_t> even = Parallel::split(length, slices);
+            for(size_t s = 1; s < slices; s++)
+            {
+                const char* from = std::max(bounds[s - 1], begin + even[s]);
+                const char* newline = from == cut ? nullptr : find(from, cut, '\n');
+                bounds[s] = nullptr == newline ? cut : newline + 1;
+            }
+
+            Parallel::run(slices, [&](size_t s) {
+                records[s].clear();
+                partial[s] = TextImportResult();
+                parse(bounds[s], bounds[s + 1], options.format, records[s], partial[s]);
+            });
+
+            for(size_t s = 0; s < slices; s++)
+            {
+                if(0 == total.first_bad_line && 0 != partial[s].first_bad_line)
+                    total.first_bad_line = total.lines + partial[s].first_bad_line;
+                total.lines += partial[s].lines;
+                total.records += partial[s].records;
+                total.bad_lines += partial[s].bad_lines;
+                if(!sink.append(records[s]))
+                    return std::nullopt;
+            }
+
+            if(last)
+                break;
+            carry = static_cast<size_t>(end - cut);
+            memmove(window.data(), cut, carry);
+        }
+
+        if(!sink.finish())
+            return std::nullopt;
+        return total;
+    }
+
+} // namespace core::General
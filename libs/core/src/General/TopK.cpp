@@ -0,0 +1,183 @@
+/**
+ * @file TopK.cpp
+ * @brief Implementation of the parallel top-K operator.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <core/General/TopK.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/EmployeeView.h>
+#include <core/General/Parallel.h>
+#include <core/General/ParallelScan.h>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+namespace core::General
+{
+    namespace
+    {
+        struct Candidate
+        {
+            double hours;
+            uint64_t row;
+        };
+
+        /** @return true if @p a ranks above @p b: more hours, then the lower row. */
+        inline bool better(const Candidate& a, const Candidate& b) noexcept
+        { return a.hours > b.hours || (a.hours == b.hours && a.row < b.row); }
+
+        /** @brief Bounded heap whose front is the worst kept candidate. */
+        class Heap
+        {
+        private:
+            size_t k_;
+            std::vector<Candidate> items_;
+            double floor_;   // Rows below this cannot make the global top K
+
+        public:
+            // Callers clamp k to the row count; a large k still grows with the rows actually kept
+            explicit Heap(size_t k)
+                : k_(k), floor_(-std::numeric_limits<double>::infinity())
+            { items_.reserve(std::min(k, TopK::BATCH_ROWS)); }
+
+            void offer(double hours, uint64_t row)
+            {
+                // Also rejects NaN
+                if(!(hours >= floor_))
+                    return;
+                Candidate c = { hours, row };
+                if(items_.size() < k_)
+                {
+                    items_.push_back(c);
+                    std::push_heap(items_.begin(), items_.end(), better);
+                    if(items_.size() < k_)
+                        return;
+                }
+                else if(better(c, items_.front()))
+                {
+                    std::pop_heap(items_.begin(), items_.end(), better);
+                    items_.back() = c;
+                    std::push_heap(items_.begin(), items_.end(), better);
+                }
+                else
+                    return;
+                floor_ = std::max(floor_, items_.front().hours);
+            }
+
+            /** @brief Publishes the local bound and adopts a higher one from other threads. */
+            void sync(std::atomic<double>& shared) noexcept
+            {
+                double seen = shared.load(std::memory_order_relaxed);
+                while(seen < floor_ && !shared.compare_exchange_weak(seen, floor_, std::memory_order_relaxed))
+                    ;
+                floor_ = std::max(floor_, seen);
+            }
+
+            const std::vector<Candidate>& items() const noexcept
+            { return items_; }
+        };
+
+        size_t thread_count(uint64_t rows, size_t requested)
+        {
+            uint64_t useful = (rows + TopK::MIN_ROWS_PER_THREAD - 1) / TopK::MIN_ROWS_PER_THREAD;
+            return static_cast<size_t>(std::max<uint64_t>(1, std::min<uint64_t>(Parallel::workers(requested), useful)));
+        }
+
+        /** @brief Runs @p scan(first, last, heap) on every thread and merges the heaps best first. */
+        template <class Scan>
+        std::vector<Candidate> select(uint64_t rows, size_t k, size_t requested, Scan&& scan)
+        {
+            const size_t threads = thread_count(rows, requested);
+            std::vector<Heap> heaps(threads, Heap(k));
+            std::atomic<double> shared(-std::numeric_limits<double>::infinity());
+            Parallel::run(threads, [&](size_t t) {
+                const uint64_t first = rows * t / threads;
+                const uint64_t last = rows * (t + 1) / threads;
+                for(uint64_t b = first; b < last; b += TopK::BATCH_ROWS)
+                {
+                    scan(b, std::min<uint64_t>(b + TopK::BATCH_ROWS, last), heaps[t]);
+                    heaps[t].sync(shared);
+                }
+            });
+
+            std::vector<Candidate> all;
+            for(const Heap& h : heaps)
+                all.insert(all.end(), h.items().begin(), h.items().end());
+            std::sort(all.begin(), all.end(), better);
+            if(all.size() > k)
+                all.resize(k);
+            return all;
+        }
+    } // namespace
+
+    std::vector<TopKEntry> TopK::by_hours(const EmployeeColumns& table, size_t k, const TopKOptions& opts)
+    {
+        std::vector<TopKEntry> out;
+        k = std::min(k, table.size());
+        if(0 == k)
+            return out;
+        const double* hours = table.hours().data();
+        std::vector<Candidate> best = select(table.size(), k, opts.threads,
+            [&](uint64_t first, uint64_t last, Heap& heap) {
+                for(uint64_t i = first; i < last; i++)
+                    heap.offer(hours[i], i);
+            });
+        out.reserve(best.size());
+        for(const Candidate& c : best)
+            out.push_back({ c.row, table.employee(static_cast<size_t>(c.row)) });
+        return out;
+    }
+
+    std::optional<std::vector<TopKEntry>> TopK::by_hours(const File& file, size_t k, const TopKOptions& opts)
+    {
+        std::optional<EmployeeFileReader> reader = EmployeeFileReader::open(file);
+        if(!reader.has_value())
+            return std::nullopt;
+
+        std::vector<TopKEntry> out;
+        k = static_cast<size_t>(std::min<uint64_t>(k, reader->size()));
+        if(0 == k)
+            return out;
+
+        ParallelScanOptions scan;
+        scan.threads = opts.threads;
+        scan.batch_records = BATCH_ROWS;
+        scan.map_file = opts.map_file;
+        std::atomic<double> shared(-std::numeric_limits<double>::infinity());
+        std::optional<std::optional<Heap>> best = parallel_scan<std::optional<Heap>>(file,
+            [&](std::optional<Heap>& heap, const EmployeeRecords& records, size_t n, uint64_t first) {
+                if(!heap.has_value())
+                    heap.emplace(k);
+                for(size_t i = 0; i < n; i++)
+                    heap->offer(records[i].hours(), first + i);
+                heap->sync(shared);
+            },
+            [](std::optional<Heap>& into, std::optional<Heap>&& part) {
+                if(!into.has_value())
+                    into.swap(part);
+                else if(part.has_value())
+                    for(const Candidate& c : part->items())
+                        into->offer(c.hours, c.row);
+            },
+            scan);
+        if(!best.has_value())
+            return std::nullopt;
+        if(!best->has_value())
+            return out;
+
+        std::vector<Candidate> rows = (*best)->items();
+        std::sort(rows.begin(), rows.end(), better);
+        out.reserve(rows.size());
+        for(const Candidate& c : rows)
+        {
+            std::optional<Employee> e = reader->at(c.row);
+            if(!e.has_value())
+                return std::nullopt;
+            out.push_back({ c.row, *e });
+        }
+        return out;
+    }
+
+} // namespace core::General
@@ -0,0 +1,177 @@
+/**
+ * @file ColumnarArchive_tests.cpp
+ * @brief Unit tests for the compressed columnar archive using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <core/General/ColumnarArchive.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeColumns.h>
+#include <core/General/File.h>
+
+using namespace core::General;
+
+class ColumnarArchiveTest : public ::testing::Test {
+protected:
+    File file_;
+    EmployeeColumns table_;
+
+    void SetUp() override {
+        file_ = File::openTemporary();
+        ASSERT_TRUE(file_.is_opened());
+    }
+
+    /**
+     * Mostly increasing ids, a handful of names and slowly rising quarter-hour
+     * values: the shape the encodings are designed for.
+     */
+    void MakeTable(size_t n) {
+        static const char* names[] = { "Ivanov", "Petrov", "Sidorov", "Smirnov" };
+        for (size_t i = 0; i < n; i++) {
+            double h = static_cast<double>(i / 50) * 0.25;
+            table_.push_back(Employee(static_cast<Employee::ID_TYPE>(i * 3 + (i % 7)), names[(i / 3) % 4], h));
+        }
+    }
+
+    ColumnarArchive WriteAndOpen(uint32_t block_rows) {
+        ColumnarArchiveWriter w(file_, block_rows);
+        EXPECT_TRUE(w.append(table_));
+        EXPECT_TRUE(w.finish());
+        EXPECT_FALSE(w.append(table_.employee(0)));
+        auto archive = ColumnarArchive::open(std::move(file_));
+        EXPECT_TRUE(archive.has_value());
+        return archive.has_value() ? std::move(archive.value()) : ColumnarArchive();
+    }
+
+    static void ExpectSameRow(const EmployeeColumns& a, size_t i, const EmployeeColumns& b, size_t j) {
+        EXPECT_EQ(a.ids()[i], b.ids()[j]);
+        EXPECT_EQ(0, memcmp(&a.hours()[i], &b.hours()[j], sizeof(double)));
+        EXPECT_EQ(a.names()[i], b.names()[j]);
+    }
+};
+
+TEST_F(ColumnarArchiveTest, RoundTripCompresses) {
+    MakeTable(20000);
+    ColumnarArchive archive = WriteAndOpen(4096);
+    ASSERT_EQ(20000u, archive.size());
+    ASSERT_EQ(5u, archive.block_count());
+
+    EmployeeColumns back;
+    ASSERT_TRUE(archive.read_all(back));
+    ASSERT_EQ(table_.size(), back.size());
+    for (size_t i = 0; i < back.size(); i++)
+        ExpectSameRow(table_, i, back, i);
+
+    uint64_t encoded = 0;
+    for (size_t b = 0; b < archive.block_count(); b++)
+        encoded += archive.block(b).size;
+    EXPECT_LT(encoded * 4, table_.size() * Employee::SERIALIZED_SIZE);
+}
+
+TEST_F(ColumnarArchiveTest, NoisyHoursAndSpecialValues) {
+    static const double special[] = { 0.0, -0.0, std::numeric_limits<double>::infinity(),
+                                      std::numeric_limits<double>::quiet_NaN(), 1e-300, -123.456 };
+    for (size_t i = 0; i < 3000; i++) {
+        double h = i < 6 ? special[i] : std::sin(static_cast<double>(i)) * 1e6;
+        table_.push_back(Employee(static_cast<Employee::ID_TYPE>(65535 - (i * 7919) % 65536), "X", h));
+    }
+    ColumnarArchive archive = WriteAndOpen(1000);
+
+    EmployeeColumns back;
+    ASSERT_TRUE(archive.read_all(back));
+    ASSERT_EQ(table_.size(), back.size());
+    for (size_t i = 0; i < back.size(); i++)
+        ExpectSameRow(table_, i, back, i);
+
+    // NaN is left out of the statistics
+    double lo = table_.hours()[6], hi = lo;
+    for (size_t i = 0; i < 1000; i++) {
+        if (std::isnan(table_.hours()[i])) continue;
+        lo = std::min(lo, table_.hours()[i]);
+        hi = std::max(hi, table_.hours()[i]);
+    }
+    EXPECT_EQ(lo, archive.block(0).hours_min);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), archive.block(0).hours_max);
+}
+
+TEST_F(ColumnarArchiveTest, ScanSkipsBlocksByStatistics) {
+    MakeTable(10000);
+    ColumnarArchive archive = WriteAndOpen(1000);
+    ASSERT_EQ(10u, archive.block_count());
+
+    // Hours rise with the row number, so [10, 12] lives in one or two blocks
+    EmployeeColumns hits;
+    size_t blocks_read = 0;
+    ASSERT_TRUE(archive.scan_hours(10.0, 12.0, hits, &blocks_read));
+    EXPECT_LE(blocks_read, 2u);
+
+    size_t expected = 0;
+    for (size_t i = 0; i < table_.size(); i++) {
+        double h = table_.hours()[i];
+        if (10.0 <= h && h <= 12.0) {
+            ASSERT_LT(expected, hits.size());
+            ExpectSameRow(table_, i, hits, expected);
+            expected++;
+        }
+    }
+    EXPECT_EQ(expected, hits.size());
+
+    EmployeeColumns none;
+    ASSERT_TRUE(archive.scan_hours(1e9, 2e9, none, &blocks_read));
+    EXPECT_EQ(0u, blocks_read);
+    EXPECT_TRUE(none.empty());
+}
+
+TEST_F(ColumnarArchiveTest, DetectsCorruptBlock) {
+    MakeTable(3000);
+    // Encoding is deterministic: the first archive tells where the blocks of the second are
+    File damaged = File::openTemporary();
+    ASSERT_TRUE(damaged.is_opened());
+    for (File* f : { &file_, &damaged }) {
+        ColumnarArchiveWriter w(*f, 1000);
+        ASSERT_TRUE(w.append(table_));
+        ASSERT_TRUE(w.finish());
+    }
+    auto reference = ColumnarArchive::open(std::move(file_));
+    ASSERT_TRUE(reference.has_value());
+
+    uint64_t at = reference->block(1).offset + reference->block(1).size / 2;
+    char c;
+    ASSERT_TRUE(damaged.readAt(&c, 1, at));
+    c ^= 0x10;
+    ASSERT_TRUE(damaged.writeAt(&c, 1, at));
+
+    auto archive = ColumnarArchive::open(std::move(damaged));
+    ASSERT_TRUE(archive.has_value());
+    EmployeeColumns out;
+    EXPECT_TRUE(archive->read_block(0, out));
+    EXPECT_FALSE(archive->read_block(1, out));
+    EXPECT_EQ(1000u, out.size());
+    EXPECT_TRUE(archive->read_block(2, out));
+    EXPECT_FALSE(archive->read_block(3, out));
+}
+
+TEST_F(ColumnarArchiveTest, RejectsUnfinishedArchive) {
+    MakeTable(100);
+    {
+        ColumnarArchiveWriter w(file_, 10);
+        ASSERT_TRUE(w.append(table_));
+    }
+    EXPECT_FALSE(ColumnarArchive::open(std::move(file_)).has_value());
+}
@@ -0,0 +1,181 @@
+/**
+ * @file DatasetGenerator_tests.cpp
+ * @brief Unit tests for the synthetic Employee dataset generator using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <cmath>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <core/General/DatasetGenerator.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+
+using namespace core::General;
+
+namespace {
+    std::vector<char> file_bytes(const File& f) {
+        std::vector<char> bytes(static_cast<size_t>(f.getFileSize64().value()));
+        if (!bytes.empty())
+            f.readAt(bytes.data(), static_cast<DWORD>(bytes.size()), 0);
+        return bytes;
+    }
+
+    std::vector<Employee> generated(const DatasetGenerator& gen, uint64_t first, size_t n) {
+        std::vector<char> records(n * Employee::SERIALIZED_SIZE);
+        gen.generate(first, n, records.data());
+        std::vector<Employee> out(n);
+        Employee::deserialize_batch(records.data(), n, out.data());
+        return out;
+    }
+}
+
+TEST(DatasetGeneratorTest, OutputDoesNotDependOnThreadCount) {
+    DatasetOptions opts;
+    opts.records = 150000;
+    opts.seed = 42;
+    opts.threads = 1;
+    File one = File::openTemporary();
+    ASSERT_TRUE(one.is_opened());
+    ASSERT_TRUE(DatasetGenerator(opts).write(one));
+
+    opts.threads = 4;
+    File four = File::openTemporary();
+    ASSERT_TRUE(four.is_opened());
+    ASSERT_TRUE(DatasetGenerator(opts).write(four));
+    EXPECT_EQ(file_bytes(one), file_bytes(four));
+
+    auto reader = EmployeeFileReader::open(four);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_TRUE(reader->versioned());
+    EXPECT_EQ(150000u, reader->size());
+
+    // A different seed gives a different file
+    opts.seed = 43;
+    File other = File::openTemporary();
+    ASSERT_TRUE(other.is_opened());
+    ASSERT_TRUE(DatasetGenerator(opts).write(other));
+    EXPECT_NE(file_bytes(one), file_bytes(other));
+}
+
+TEST(DatasetGeneratorTest, IdDistributions) {
+    DatasetOptions opts;
+    opts.ids = IdDistribution::sequential;
+    opts.id_range = 100;
+    DatasetGenerator seq(opts);
+    auto rows = generated(seq, 95, 10);
+    for (size_t i = 0; i < rows.size(); i++)
+        EXPECT_EQ((95 + i) % 100, rows[i].id());
+
+    opts.ids = IdDistribution::zipf;
+    opts.id_range = 1000;
+    opts.zipf_skew = 1.2;
+    DatasetGenerator zipf(opts);
+    std::vector<size_t> freq(1000);
+    for (const Employee& e : generated(zipf, 0, 200000)) {
+        ASSERT_LT(e.id(), 1000);
+        freq[e.id()]++;
+    }
+    // Frequencies follow 1 / rank^s, so rank 1 beats rank 2 by about 2^1.2
+    EXPECT_GT(freq[0], freq[1]);
+    EXPECT_GT(freq[1], freq[9]);
+    EXPECT_NEAR(std::pow(2.0, 1.2), double(freq[0]) / double(freq[1]), 0.15);
+
+    opts.ids = IdDistribution::uniform;
+    opts.id_range = 0;   // Clamped to 1
+    DatasetGenerator single(opts);
+    EXPECT_EQ(1u, single.options().id_range);
+    for (const Employee& e : generated(single, 0, 100))
+        EXPECT_EQ(0, e.id());
+}
+
+TEST(DatasetGeneratorTest, NamesAndHours) {
+    DatasetOptions opts;
+    opts.name_cardinality = 50;
+    opts.hours_min = 10.0;
+    opts.hours_max = 20.0;
+    opts.hours_step = 0.5;
+    DatasetGenerator gen(opts);
+
+    std::set<std::string> names;
+    for (const Employee& e : generated(gen, 0, 20000)) {
+        names.insert(std::string(e.name(), strnlen(e.name(), Employee::BUFF_SIZE)));
+        ASSERT_GE(e.hours(), 10.0);
+        ASSERT_LE(e.hours(), 20.0);
+        ASSERT_EQ(e.hours(), std::round(e.hours() * 2) / 2);
+    }
+    EXPECT_EQ(50u, names.size());
+    EXPECT_EQ(1u, names.count(gen.name(49)));
+    EXPECT_NE(gen.name(0), gen.name(32));
+
+    // Names stay within the fixed buffer at the largest cardinality
+    opts.name_cardinality = UINT32_MAX;
+    DatasetGenerator wide(opts);
+    EXPECT_LE(wide.name(wide.options().name_cardinality - 1).size(), size_t(Employee::BUFF_SIZE));
+
+    opts.hours = HoursDistribution::normal;
+    opts.hours_step = 0.0;
+    opts.hours_mean = 40.0;
+    opts.hours_stddev = 5.0;
+    double sum = 0.0;
+    for (const Employee& e : generated(DatasetGenerator(opts), 0, 50000))
+        sum += e.hours();
+    EXPECT_NEAR(40.0, sum / 50000, 0.2);
+
+    opts.hours = HoursDistribution::exponential;
+    sum = 0.0;
+    for (const Employee& e : generated(DatasetGenerator(opts), 0, 50000)) {
+        ASSERT_GE(e.hours(), 0.0);
+        sum += e.hours();
+    }
+    EXPECT_NEAR(40.0, sum / 50000, 1.0);
+}
+
+TEST(DatasetGeneratorTest, AlignedLayoutMatchesCompact) {
+    DatasetOptions opts;
+    opts.records = 70000;
+    opts.threads = 3;
+    opts.block_records = 1000;
+    File compact = File::openTemporary();
+    ASSERT_TRUE(compact.is_opened());
+    ASSERT_TRUE(DatasetGenerator(opts).write(compact));
+
+    opts.layout = EmployeeLayout::aligned;
+    File aligned = File::openTemporary();
+    ASSERT_TRUE(aligned.is_opened());
+    ASSERT_TRUE(DatasetGenerator(opts).write(aligned));
+
+    auto a = EmployeeFileReader::open(compact);
+    auto b = EmployeeFileReader::open(aligned);
+    ASSERT_TRUE(a.has_value());
+    ASSERT_TRUE(b.has_value());
+    EXPECT_TRUE(b->header().aligned_layout());
+    ASSERT_EQ(a->size(), b->size());
+
+    std::vector<char> x(a->size() * Employee::SERIALIZED_SIZE), y(x.size());
+    ASSERT_TRUE(a->read(0, a->size(), x.data()));
+    ASSERT_TRUE(b->read(0, b->size(), y.data()));
+    EXPECT_EQ(x, y);
+
+    // Empty datasets still produce a valid file
+    opts.records = 0;
+    File empty = File::openTemporary();
+    ASSERT_TRUE(empty.is_opened());
+    ASSERT_TRUE(DatasetGenerator(opts).write(empty));
+    auto c = EmployeeFileReader::open(empty);
+    ASSERT_TRUE(c.has_value());
+    EXPECT_EQ(0u, c->size());
+}
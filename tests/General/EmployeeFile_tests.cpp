@@ -0,0 +1,270 @@
+/**
+ * @file EmployeeFile_tests.cpp
+ * @brief Unit tests for the versioned Employee file format using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <cstring>
+#include <vector>
+
+#include <core/General/BufferedIO.h>
+#include <core/General/Checksum.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/HoursIndex.h>
+
+using namespace core::General;
+
+class EmployeeFileTest : public ::testing::Test {
+protected:
+    File file_;
+    std::vector<Employee> employees_;
+
+    void SetUp() override {
+        file_ = File::openTemporary();
+        ASSERT_TRUE(file_.is_opened());
+    }
+
+    void MakeEmployees(size_t n) {
+        static const char* names[] = { "Ivanov", "Petrov", "Sidorov" };
+        for (size_t i = 0; i < n; i++)
+            employees_.emplace_back(static_cast<Employee::ID_TYPE>(i % 65536), names[i % 3],
+                                    static_cast<double>(i % 977) / 4.0);
+    }
+
+    void WriteVersioned(uint32_t block_records) {
+        EmployeeFileWriter w(file_, block_records, 4096);
+        // Mix the single-record and batch paths
+        ASSERT_TRUE(w.append(employees_[0]));
+        ASSERT_TRUE(w.append(employees_.data() + 1, employees_.size() - 1));
+        EXPECT_EQ(employees_.size(), w.count());
+        ASSERT_TRUE(w.finish());
+    }
+};
+
+TEST(ChecksumTest, Crc32cCheckValue) {
+    const char* s = "123456789";
+    EXPECT_EQ(0xE3069283u, Checksum::crc32c(s, 9));
+    // Chained calls equal one call over the concatenation
+    EXPECT_EQ(0xE3069283u, Checksum::crc32c(s + 4, 5, Checksum::crc32c(s, 4)));
+    EXPECT_EQ(0u, Checksum::crc32c(nullptr, 0));
+}
+
+TEST_F(EmployeeFileTest, WriteAndReadBack) {
+    MakeEmployees(5000);
+    WriteVersioned(1000);
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_TRUE(reader->versioned());
+    EXPECT_TRUE(reader->zero_copy());
+    EXPECT_EQ(5000u, reader->size());
+    EXPECT_EQ(5u, reader->header().block_count);
+    EXPECT_TRUE(reader->verify());
+
+    auto e = reader->at(4321);
+    ASSERT_TRUE(e.has_value());
+    EXPECT_EQ(employees_[4321].id(), e->id());
+    EXPECT_EQ(employees_[4321].hours(), e->hours());
+    EXPECT_STREQ(employees_[4321].name(), e->name());
+    EXPECT_FALSE(reader->at(5000).has_value());
+
+    std::vector<char> buf(10 * Employee::SERIALIZED_SIZE);
+    ASSERT_TRUE(reader->read(4990, 10, buf.data()));
+    EXPECT_EQ(employees_[4999].id(), Employee::deserialize(&buf[9 * Employee::SERIALIZED_SIZE]).id());
+    EXPECT_FALSE(reader->read(4995, 10, buf.data()));
+}
+
+TEST_F(EmployeeFileTest, EmptyFileHasNoBlocks) {
+    EmployeeFileWriter w(file_);
+    ASSERT_TRUE(w.finish());
+    EXPECT_FALSE(w.finish());
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_TRUE(reader->versioned());
+    EXPECT_EQ(0u, reader->size());
+    EXPECT_TRUE(reader->verify());
+}
+
+TEST_F(EmployeeFileTest, DetectsCorruptedBlock) {
+    MakeEmployees(300);
+    WriteVersioned(100);
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    uint64_t at = reader->header().record_offset(150) + 3;
+    char c;
+    ASSERT_TRUE(file_.readAt(&c, 1, at));
+    c ^= 0x40;
+    ASSERT_TRUE(file_.writeAt(&c, 1, at));
+
+    EXPECT_TRUE(reader->verify_block(0));
+    EXPECT_FALSE(reader->verify_block(1));
+    EXPECT_TRUE(reader->verify_block(2));
+    EXPECT_FALSE(reader->verify_block(3));
+    EXPECT_FALSE(reader->verify());
+}
+
+TEST_F(EmployeeFileTest, RejectsDamagedHeader) {
+    MakeEmployees(10);
+    WriteVersioned(4);
+
+    // Flip a bit in the record count: the header checksum no longer matches
+    char c;
+    ASSERT_TRUE(file_.readAt(&c, 1, 24));
+    c ^= 0x01;
+    ASSERT_TRUE(file_.writeAt(&c, 1, 24));
+    EXPECT_FALSE(EmployeeFileHeader::read(file_).has_value());
+    // The magic is still there, so it must not be mistaken for a legacy file
+    EXPECT_FALSE(EmployeeFileReader::open(file_).has_value());
+}
+
+TEST_F(EmployeeFileTest, RejectsTruncatedFile) {
+    MakeEmployees(10);
+    WriteVersioned(4);
+
+    File copy = File::openTemporary();
+    ASSERT_TRUE(copy.is_opened());
+    auto size = file_.getFileSize64();
+    ASSERT_TRUE(size.has_value());
+    std::vector<char> bytes(static_cast<size_t>(size.value()) - 4);
+    ASSERT_TRUE(file_.readAt(bytes.data(), static_cast<DWORD>(bytes.size()), 0));
+    ASSERT_TRUE(copy.writeAt(bytes.data(), static_cast<DWORD>(bytes.size()), 0));
+    EXPECT_FALSE(EmployeeFileReader::open(copy).has_value());
+}
+
+TEST_F(EmployeeFileTest, OpensLegacyFile) {
+    MakeEmployees(40);
+    {
+        BufferedWriter w(file_);
+        for (const Employee& e : employees_) {
+            auto rec = e.serialize();
+            ASSERT_TRUE(w.write(rec.data(), rec.size()));
+        }
+    }
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_FALSE(reader->versioned());
+    EXPECT_EQ(40u, reader->size());
+    EXPECT_EQ(0u, reader->header().record_offset(0));
+    EXPECT_TRUE(reader->verify());
+    auto e = reader->at(17);
+    ASSERT_TRUE(e.has_value());
+    EXPECT_EQ(employees_[17].id(), e->id());
+}
+
+TEST_F(EmployeeFileTest, HoursIndexUsesRecordOffsets) {
+    MakeEmployees(2000);
+    WriteVersioned(256);
+
+    File index = File::openTemporary();
+    ASSERT_TRUE(index.is_opened());
+    ASSERT_TRUE(HoursIndex::build(file_, index));
+    auto idx = HoursIndex::open(std::move(index));
+    ASSERT_TRUE(idx.has_value());
+    ASSERT_EQ(2000u, idx->size());
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    auto top = idx->top(2);
+    ASSERT_TRUE(top.has_value());
+    for (uint64_t offset : *top) {
+        uint64_t i = (offset - reader->header().data_offset) / Employee::SERIALIZED_SIZE;
+        EXPECT_EQ(offset, reader->header().record_offset(i));
+        auto e = reader->at(i);
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(976.0 / 4.0, e->hours());
+    }
+}
+
+TEST_F(EmployeeFileTest, AlignedLayoutRoundTrip) {
+    MakeEmployees(3000);
+    {
+        EmployeeFileWriter w(file_, 512, 4096, EmployeeLayout::aligned);
+        ASSERT_TRUE(w.append(employees_[0]));
+        ASSERT_TRUE(w.append(employees_.data() + 1, 999));
+        std::vector<char> records(1000 * Employee::SERIALIZED_SIZE);
+        Employee::serialize_batch(employees_.data() + 1000, 1000, records.data());
+        ASSERT_TRUE(w.append_records(records.data(), 1000));
+        std::vector<AlignedEmployee> aligned(1000);
+        for (size_t i = 0; i < 1000; i++)
+            aligned[i] = AlignedEmployee::from_employee(employees_[2000 + i]);
+        ASSERT_TRUE(w.append_aligned(aligned.data(), aligned.size()));
+        ASSERT_TRUE(w.finish());
+    }
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    const EmployeeFileHeader& h = reader->header();
+    EXPECT_EQ(EmployeeLayout::aligned, h.layout());
+    EXPECT_TRUE(h.aligned_layout());
+    EXPECT_FALSE(reader->zero_copy());
+    EXPECT_EQ(AlignedEmployee::SIZE, h.record_size);
+    EXPECT_EQ(0u, h.data_offset % AlignedEmployee::SIZE);
+    EXPECT_TRUE(reader->verify());
+
+    std::vector<AlignedEmployee> aligned(3000);
+    ASSERT_TRUE(reader->read_aligned(0, 3000, aligned.data()));
+    std::vector<char> compact(3000 * Employee::SERIALIZED_SIZE);
+    ASSERT_TRUE(reader->read(0, 3000, compact.data()));
+    for (size_t i = 0; i < 3000; i += 7) {
+        EXPECT_EQ(employees_[i].id(), aligned[i].id);
+        EXPECT_EQ(employees_[i].hours(), aligned[i].hours);
+        Employee e = Employee::deserialize(&compact[i * Employee::SERIALIZED_SIZE]);
+        EXPECT_EQ(employees_[i].id(), e.id());
+        EXPECT_STREQ(employees_[i].name(), e.name());
+    }
+}
+
+TEST_F(EmployeeFileTest, ConvertsBetweenLayouts) {
+    MakeEmployees(1500);
+    WriteVersioned(256);
+
+    File aligned = File::openTemporary();
+    File compact = File::openTemporary();
+    ASSERT_TRUE(EmployeeFileConverter::run(file_, aligned, EmployeeLayout::aligned, 100));
+    ASSERT_TRUE(EmployeeFileConverter::run(aligned, compact, EmployeeLayout::compact, 256));
+
+    auto a = EmployeeFileReader::open(aligned);
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(EmployeeLayout::aligned, a->header().layout());
+    EXPECT_EQ(15u, a->header().block_count);
+    EXPECT_TRUE(a->verify());
+
+    // Round trip through the aligned layout gives the original bytes back
+    auto size = file_.getFileSize64();
+    ASSERT_TRUE(size.has_value());
+    ASSERT_EQ(size, compact.getFileSize64());
+    std::vector<char> before(static_cast<size_t>(*size)), after(before.size());
+    ASSERT_TRUE(file_.readAt(before.data(), static_cast<DWORD>(before.size()), 0));
+    ASSERT_TRUE(compact.readAt(after.data(), static_cast<DWORD>(after.size()), 0));
+    EXPECT_EQ(before, after);
+}
+
+TEST_F(EmployeeFileTest, RejectsUnknownFlags) {
+    MakeEmployees(10);
+    WriteVersioned(4);
+
+    auto h = EmployeeFileHeader::read(file_);
+    ASSERT_TRUE(h.has_value());
+    // A flag from a future version, and a flag that disagrees with the record size
+    for (uint32_t flags : { 2u, EmployeeFileHeader::FLAG_ALIGNED }) {
+        EmployeeFileHeader bad = *h;
+        bad.flags = flags;
+        ASSERT_TRUE(bad.write(file_));
+        EXPECT_FALSE(EmployeeFileHeader::read(file_).has_value());
+    }
+}
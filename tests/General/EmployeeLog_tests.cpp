@@ -0,0 +1,191 @@
+/**
+ * @file EmployeeLog_tests.cpp
+ * @brief Unit tests for the append-only Employee log using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <atomic>
+#include <string>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeLog.h>
+#include <core/General/File.h>
+#include <core/General/Parallel.h>
+
+using namespace core::General;
+
+class EmployeeLogTest : public ::testing::Test {
+protected:
+    std::string dir_;
+
+    void SetUp() override {
+        char temp[MAX_PATH] = {};
+        ASSERT_NE(0u, GetTempPathA(MAX_PATH, temp));
+        dir_ = std::string(temp) + "EmployeeLogTest-" + std::to_string(GetTickCount64());
+    }
+
+    void TearDown() override {
+        WIN32_FIND_DATAA data;
+        HANDLE find = FindFirstFileA((dir_ + "\\*.log").c_str(), &data);
+        if (INVALID_HANDLE_VALUE != find) {
+            do {
+                DeleteFileA((dir_ + "\\" + data.cFileName).c_str());
+            } while (FindNextFileA(find, &data));
+            FindClose(find);
+        }
+        RemoveDirectoryA(dir_.c_str());
+    }
+
+    static EmployeeLogOptions Options(uint64_t entries_per_segment) {
+        EmployeeLogOptions opts;
+        opts.segment_bytes = EmployeeLog::HEADER_SIZE + entries_per_segment * EmployeeLog::ENTRY_SIZE;
+        opts.buffer_size = 4096;
+        opts.background_compaction = false;
+        return opts;
+    }
+};
+
+TEST_F(EmployeeLogTest, PutGetAndReopen) {
+    {
+        EmployeeLog log(dir_.c_str(), Options(1000));
+        ASSERT_TRUE(log.is_open());
+        for (int i = 0; i < 500; i++)
+            ASSERT_TRUE(log.put(Employee(static_cast<Employee::ID_TYPE>(i), "Logged", i)));
+        EXPECT_FALSE(log.contains(500));
+        EXPECT_FALSE(log.get(500).has_value());
+        EXPECT_FALSE(log.set_hours(500, 1.0));
+
+        // Reads see entries still sitting in the write buffer
+        ASSERT_TRUE(log.set_hours(42, 420.0));
+        auto e = log.get(42);
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(420.0, e->hours());
+        EXPECT_STREQ("Logged", e->name());
+
+        EmployeeLogStats s = log.stats();
+        EXPECT_EQ(500u, s.live);
+        EXPECT_EQ(501u, s.appended);
+    }
+
+    EmployeeLog log(dir_.c_str(), Options(1000));
+    ASSERT_TRUE(log.is_open());
+    EXPECT_EQ(500u, log.stats().live);
+    EXPECT_EQ(420.0, log.get(42)->hours());
+    EXPECT_EQ(499.0, log.get(499)->hours());
+    // The reopened log appends to a new segment
+    EXPECT_EQ(2u, log.stats().segments);
+}
+
+TEST_F(EmployeeLogTest, RotatesAndCompacts) {
+    EmployeeLog log(dir_.c_str(), Options(100));
+    ASSERT_TRUE(log.is_open());
+    for (int round = 0; round < 20; round++)
+        for (int id = 0; id < 50; id++)
+            ASSERT_TRUE(log.put(Employee(static_cast<Employee::ID_TYPE>(id), "Hot", round * 100 + id)));
+    ASSERT_TRUE(log.flush());
+    EXPECT_EQ(10u, log.stats().segments);
+
+    // Only the active segment holds live entries, so every sealed one is dead
+    ASSERT_TRUE(log.compact());
+    EmployeeLogStats s = log.stats();
+    EXPECT_EQ(1u, s.segments);
+    EXPECT_EQ(1u, s.compactions);
+    EXPECT_EQ(9u * (EmployeeLog::HEADER_SIZE + 100 * EmployeeLog::ENTRY_SIZE), s.reclaimed_bytes);
+
+    // Rewrite half the ids so that sealed segments are partly live
+    for (int round = 0; round < 4; round++)
+        for (int id = 0; id < 50; id += (round < 2 ? 1 : 2))
+            ASSERT_TRUE(log.put(Employee(static_cast<Employee::ID_TYPE>(id), "Warm", 5000 + round * 100 + id)));
+    ASSERT_TRUE(log.compact());
+    ASSERT_TRUE(log.compact());
+    for (int id = 0; id < 50; id++) {
+        auto e = log.get(static_cast<Employee::ID_TYPE>(id));
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(id % 2 == 0 ? 5300 + id : 5100 + id, e->hours());
+        EXPECT_STREQ("Warm", e->name());
+    }
+    EXPECT_EQ(50u, log.stats().live);
+}
+
+TEST_F(EmployeeLogTest, ReplayKeepsLatestAfterCompaction) {
+    {
+        EmployeeLog log(dir_.c_str(), Options(64));
+        for (int round = 0; round < 10; round++)
+            for (int id = 0; id < 40; id++)
+                ASSERT_TRUE(log.put(Employee(static_cast<Employee::ID_TYPE>(id), "Replay", round * 1000 + id)));
+        ASSERT_TRUE(log.compact());
+    }
+
+    // Compacted segments carry higher file numbers than the entries they hold
+    EmployeeLog log(dir_.c_str(), Options(64));
+    ASSERT_TRUE(log.is_open());
+    EXPECT_EQ(40u, log.stats().live);
+    for (int id = 0; id < 40; id++)
+        EXPECT_EQ(9000 + id, log.get(static_cast<Employee::ID_TYPE>(id))->hours());
+}
+
+TEST_F(EmployeeLogTest, IgnoresTornTail) {
+    {
+        EmployeeLog log(dir_.c_str(), Options(1000));
+        for (int id = 0; id < 10; id++)
+            ASSERT_TRUE(log.put(Employee(static_cast<Employee::ID_TYPE>(id), "Torn", id)));
+    }
+
+    // Half an entry of garbage, as if the process died mid-write
+    File seg = File::open((dir_ + "\\employee-0000000001.log").c_str(), GENERIC_READ | GENERIC_WRITE, 0,
+                          nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    ASSERT_TRUE(seg.is_opened());
+    char garbage[EmployeeLog::ENTRY_SIZE / 2];
+    memset(garbage, 0x5A, sizeof(garbage));
+    ASSERT_TRUE(seg.writeAt(garbage, sizeof(garbage), EmployeeLog::HEADER_SIZE + 10 * EmployeeLog::ENTRY_SIZE));
+    seg.close();
+
+    EmployeeLog log(dir_.c_str(), Options(1000));
+    ASSERT_TRUE(log.is_open());
+    EXPECT_EQ(10u, log.stats().live);
+    EXPECT_EQ(9.0, log.get(9)->hours());
+}
+
+TEST_F(EmployeeLogTest, BackgroundCompactionWithConcurrentWriters) {
+    EmployeeLogOptions opts = Options(256);
+    opts.background_compaction = true;
+    opts.compact_interval_ms = 1;
+    EmployeeLog log(dir_.c_str(), opts);
+    ASSERT_TRUE(log.is_open());
+
+    std::atomic<size_t> failures(0);
+    Parallel::run(4, [&](size_t t) {
+        // Each thread owns a disjoint id range, so its last write must win
+        for (int round = 0; round < 50; round++)
+            for (int k = 0; k < 25; k++) {
+                Employee::ID_TYPE id = static_cast<Employee::ID_TYPE>(t * 100 + k);
+                if (!log.put(Employee(id, "Busy", round)))
+                    failures++;
+                if (k % 5 == 0 && !log.get(id).has_value())
+                    failures++;
+            }
+    });
+    EXPECT_EQ(0u, failures.load());
+    ASSERT_TRUE(log.compact());
+
+    for (size_t t = 0; t < 4; t++)
+        for (int k = 0; k < 25; k++) {
+            auto e = log.get(static_cast<Employee::ID_TYPE>(t * 100 + k));
+            ASSERT_TRUE(e.has_value());
+            EXPECT_EQ(49.0, e->hours());
+        }
+    EmployeeLogStats s = log.stats();
+    EXPECT_EQ(100u, s.live);
+    EXPECT_GT(s.compactions, 0u);
+    EXPECT_LT(s.segments, 5000u * EmployeeLog::ENTRY_SIZE / opts.segment_bytes);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file EmployeeRing_tests.cpp
+ * @brief Unit tests for the shared-memory Employee ring using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeRing.h>
+#include <core/General/Parallel.h>
+
+using namespace core::General;
+
+namespace {
+    std::string ring_name(const char* test) {
+        return std::string("EmployeeRingTest-") + test + "-" + std::to_string(GetCurrentProcessId())
+             + "-" + std::to_string(GetTickCount64());
+    }
+
+    // One producer and several consumers, each consumer with its own endpoint as a process would have
+    void run_spmc(RingWait wait, uint32_t capacity, size_t consumers, uint64_t records) {
+        std::string name = ring_name("spmc");
+        auto producer = EmployeeRing::create(name.c_str(), capacity, wait);
+        ASSERT_TRUE(producer.has_value());
+
+        std::vector<uint64_t> counts(consumers), sums(consumers);
+        std::atomic<size_t> out_of_order(0);
+        Parallel::run(consumers + 1, [&](size_t w) {
+            if (0 == w) {
+                std::vector<char> batch(100 * Employee::SERIALIZED_SIZE);
+                for (uint64_t first = 0; first < records; first += 100) {
+                    for (size_t i = 0; i < 100; i++) {
+                        Employee e(static_cast<Employee::ID_TYPE>(first + i), "Ring", double(first + i));
+                        auto bytes = e.serialize();
+                        memcpy(batch.data() + i * Employee::SERIALIZED_SIZE, bytes.data(), bytes.size());
+                    }
+                    producer->push_records(batch.data(), 100);
+                }
+                producer->close();
+                return;
+            }
+
+            auto consumer = EmployeeRing::open(name.c_str(), wait);
+            if (!consumer.has_value())
+                return;
+            std::vector<char> batch(32 * Employee::SERIALIZED_SIZE);
+            double last = -1.0;
+            size_t n;
+            while (0 != (n = consumer->pop_records(batch.data(), 32))) {
+                for (size_t i = 0; i < n; i++) {
+                    double h = Employee::Schema::read<Employee::FIELD_HOURS>(batch.data() + i * Employee::SERIALIZED_SIZE);
+                    if (h <= last)
+                        out_of_order++;
+                    last = h;
+                    counts[w - 1]++;
+                    sums[w - 1] += static_cast<uint64_t>(h);
+                }
+            }
+        });
+
+        uint64_t count = 0, sum = 0;
+        for (size_t c = 0; c < consumers; c++) {
+            count += counts[c];
+            sum += sums[c];
+        }
+        // Every record arrives exactly once, in order within each consumer
+        EXPECT_EQ(records, count);
+        EXPECT_EQ(records * (records - 1) / 2, sum);
+        EXPECT_EQ(0u, out_of_order.load());
+    }
+}
+
+TEST(EmployeeRingTest, PushPopAndClose) {
+    std::string name = ring_name("basic");
+    auto producer = EmployeeRing::create(name.c_str(), 5);
+    ASSERT_TRUE(producer.has_value());
+    EXPECT_TRUE(producer->is_producer());
+    EXPECT_EQ(8u, producer->capacity());
+    EXPECT_FALSE(EmployeeRing::create(name.c_str(), 8).has_value());
+    EXPECT_FALSE(EmployeeRing::open((name + "-missing").c_str()).has_value());
+
+    auto consumer = EmployeeRing::open(name.c_str());
+    ASSERT_TRUE(consumer.has_value());
+    EXPECT_FALSE(consumer->is_producer());
+    EXPECT_EQ(8u, consumer->capacity());
+
+    char record[Employee::SERIALIZED_SIZE];
+    EXPECT_FALSE(consumer->try_pop(record));
+    for (int i = 0; i < 8; i++) {
+        auto bytes = Employee(static_cast<Employee::ID_TYPE>(i), "Ring", i).serialize();
+        ASSERT_TRUE(producer->try_push(bytes.data()));
+    }
+    auto extra = Employee(8, "Ring", 8).serialize();
+    EXPECT_FALSE(producer->try_push(extra.data()));
+    EXPECT_FALSE(consumer->try_push(extra.data()));
+    EXPECT_EQ(8u, consumer->size());
+
+    Employee e;
+    ASSERT_TRUE(consumer->pop(e));
+    EXPECT_EQ(0, e.id());
+    EXPECT_TRUE(producer->push(Employee(8, "Ring", 8)));
+
+    std::vector<char> rest(16 * Employee::SERIALIZED_SIZE);
+    EXPECT_EQ(8u, consumer->pop_records(rest.data(), 16));
+    EXPECT_EQ(8, Employee::deserialize(rest.data() + 7 * Employee::SERIALIZED_SIZE).id());
+
+    ASSERT_TRUE(producer->push(Employee(9, "Last", 9)));
+    producer->close();
+    EXPECT_FALSE(producer->push(Employee(10, "Late", 10)));
+    EXPECT_TRUE(consumer->closed());
+    ASSERT_TRUE(consumer->pop(e));
+    EXPECT_EQ(9, e.id());
+    EXPECT_FALSE(consumer->pop(e));
+}
+
+TEST(EmployeeRingTest, BlockingConsumersShareTheStream) {
+    run_spmc(RingWait::block, 64, 4, 100000);
+}
+
+TEST(EmployeeRingTest, SpinningConsumersShareTheStream) {
+    run_spmc(RingWait::spin, 1024, 2, 100000);
+}
@@ -0,0 +1,168 @@
+/**
+ * @file EmployeeStore_tests.cpp
+ * @brief Unit tests for in-place Employee file updates using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/EmployeeStore.h>
+#include <core/General/File.h>
+
+using namespace core::General;
+
+class EmployeeStoreTest : public ::testing::Test {
+protected:
+    static constexpr size_t COUNT = 5000;
+    File file_;
+
+    void Write(EmployeeLayout layout) {
+        file_ = File::openTemporary();
+        ASSERT_TRUE(file_.is_opened());
+        EmployeeFileWriter w(file_, 1000, 4096, layout);
+        for (size_t i = 0; i < COUNT; i++)
+            ASSERT_TRUE(w.append(Employee(static_cast<Employee::ID_TYPE>(i * 3), "Stored", static_cast<double>(i))));
+        ASSERT_TRUE(w.finish());
+    }
+
+    bool Verify() {
+        auto reader = EmployeeFileReader::open(file_);
+        return reader.has_value() && reader->verify();
+    }
+};
+
+TEST_F(EmployeeStoreTest, SingleFieldUpdates) {
+    Write(EmployeeLayout::compact);
+    auto store = EmployeeStore::open(file_);
+    ASSERT_TRUE(store.has_value());
+    EXPECT_EQ(COUNT, store->size());
+
+    ASSERT_TRUE(store->set_hours(10, 99.5));
+    ASSERT_TRUE(store->set_name(11, "Renamed"));
+    ASSERT_TRUE(store->put(12, Employee(7, "Whole", 1.25)));
+    EXPECT_FALSE(store->set_hours(COUNT, 1.0));
+
+    // Checksums are stale until the store flushes
+    EXPECT_FALSE(Verify());
+    ASSERT_TRUE(store->flush());
+    EXPECT_TRUE(Verify());
+
+    auto a = store->get(10);
+    ASSERT_TRUE(a.has_value());
+    EXPECT_EQ(30, a->id());
+    EXPECT_EQ(99.5, a->hours());
+    EXPECT_STREQ("Stored", a->name());
+    EXPECT_STREQ("Renamed", store->get(11)->name());
+    EXPECT_EQ(33, store->get(11)->id());
+    EXPECT_EQ(7, store->get(12)->id());
+    EXPECT_STREQ("Whole", store->get(12)->name());
+    EXPECT_EQ(13.0, store->get(13)->hours());
+}
+
+TEST_F(EmployeeStoreTest, IdIndex) {
+    Write(EmployeeLayout::aligned);
+    {
+        auto store = EmployeeStore::open(file_);
+        ASSERT_TRUE(store.has_value());
+        EXPECT_FALSE(store->indexed());
+        EXPECT_FALSE(store->set_hours_by_id(30, 1.0));
+
+        ASSERT_TRUE(store->build_index());
+        EXPECT_TRUE(store->indexed());
+        EXPECT_EQ(10u, store->find(30).value());
+        EXPECT_FALSE(store->find(31).has_value());
+
+        ASSERT_TRUE(store->set_hours_by_id(30, -4.0));
+        ASSERT_TRUE(store->set_id(10, 31));
+        EXPECT_FALSE(store->find(30).has_value());
+        EXPECT_EQ(10u, store->find(31).value());
+        // The destructor flushes the stale checksums
+    }
+    EXPECT_TRUE(Verify());
+
+    auto reader = EmployeeFileReader::open(file_);
+    ASSERT_TRUE(reader.has_value());
+    auto e = reader->at(10);
+    ASSERT_TRUE(e.has_value());
+    EXPECT_EQ(31, e->id());
+    EXPECT_EQ(-4.0, e->hours());
+    EXPECT_STREQ("Stored", e->name());
+}
+
+TEST_F(EmployeeStoreTest, IdIndexFallsBackToEarlierDuplicate) {
+    file_ = File::openTemporary();
+    ASSERT_TRUE(file_.is_opened());
+    {
+        EmployeeFileWriter w(file_, 4, 4096, EmployeeLayout::compact);
+        for (size_t i = 0; i < 10; i++)
+            ASSERT_TRUE(w.append(Employee(static_cast<Employee::ID_TYPE>(100 + i), "Dup", 1.0)));
+        ASSERT_TRUE(w.finish());
+    }
+    auto store = EmployeeStore::open(file_);
+    ASSERT_TRUE(store.has_value());
+    ASSERT_TRUE(store->put(2, Employee(7, "Dup", 2.0)));
+    ASSERT_TRUE(store->set_id(8, 7));
+    ASSERT_TRUE(store->build_index());
+    EXPECT_EQ(8u, store->find(7).value());
+
+    // Giving an earlier record the id must not move the index back
+    ASSERT_TRUE(store->set_id(5, 7));
+    EXPECT_EQ(8u, store->find(7).value());
+
+    // Renaming the last holder falls back to the previous ones, one at a time
+    ASSERT_TRUE(store->set_id(8, 108));
+    EXPECT_EQ(5u, store->find(7).value());
+    ASSERT_TRUE(store->put(5, Employee(105, "Dup", 1.0)));
+    EXPECT_EQ(2u, store->find(7).value());
+    ASSERT_TRUE(store->set_hours_by_id(7, 9.0));
+    EXPECT_EQ(9.0, store->get(2)->hours());
+
+    ASSERT_TRUE(store->set_id(2, 102));
+    EXPECT_FALSE(store->find(7).has_value());
+    EXPECT_FALSE(store->set_hours_by_id(7, 1.0));
+    EXPECT_EQ(8u, store->find(108).value());
+}
+
+TEST_F(EmployeeStoreTest, BatchedUpdates) {
+    for (EmployeeLayout layout : { EmployeeLayout::compact, EmployeeLayout::aligned }) {
+        Write(layout);
+        auto store = EmployeeStore::open(file_);
+        ASSERT_TRUE(store.has_value());
+
+        // Out of order, with a repeated record and a gap wider than one span
+        std::vector<HoursUpdate> updates = { { 4000, 1.0 }, { 5, 2.0 }, { 6, 3.0 }, { 5, 10.0 }, { 4999, 0.5 } };
+        ASSERT_TRUE(store->update_hours(updates, HoursUpdateMode::add));
+        EXPECT_FALSE(store->update_hours({ { 1, 1.0 }, { COUNT, 1.0 } }));
+        ASSERT_TRUE(store->flush());
+        EXPECT_TRUE(Verify());
+
+        EXPECT_EQ(4001.0, store->get(4000)->hours());
+        EXPECT_EQ(17.0, store->get(5)->hours());
+        EXPECT_EQ(9.0, store->get(6)->hours());
+        EXPECT_EQ(5000 - 0.5, store->get(4999)->hours());
+        // The rejected batch wrote nothing
+        EXPECT_EQ(1.0, store->get(1)->hours());
+        EXPECT_STREQ("Stored", store->get(6)->name());
+        EXPECT_EQ(18, store->get(6)->id());
+
+        std::vector<HoursUpdate> all;
+        for (size_t i = 0; i < COUNT; i++)
+            all.push_back({ COUNT - 1 - i, 0.0 });
+        ASSERT_TRUE(store->update_hours(all));
+        ASSERT_TRUE(store->flush());
+        EXPECT_TRUE(Verify());
+        EXPECT_EQ(0.0, store->get(2500)->hours());
+    }
+}
@@ -0,0 +1,207 @@
+/**
+ * @file ExternalSort_tests.cpp
+ * @brief Unit tests for the external merge sort and its building blocks.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <core/General/BufferedIO.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/ExternalSort.h>
+#include <core/General/File.h>
+#include <core/General/LoserTree.h>
+
+using namespace core::General;
+
+class ExternalSortTest : public ::testing::Test {
+protected:
+    File input_;
+    File output_;
+    std::vector<Employee> employees_;
+
+    void SetUp() override {
+        input_ = File::openTemporary();
+        output_ = File::openTemporary();
+        ASSERT_TRUE(input_.is_opened());
+        ASSERT_TRUE(output_.is_opened());
+    }
+
+    void WriteRecords(size_t n) {
+        static const char* names[] = { "Ivanov", "Petrov", "Sidorov", "Smirnov", "Kuznetsov" };
+        BufferedWriter w(input_);
+        for (size_t i = 0; i < n; i++) {
+            Employee e(static_cast<Employee::ID_TYPE>((i * 40503) % 65536), names[(i * 7) % 5],
+                       static_cast<double>((i * 2654435761u) % 10007) / 8.0);
+            employees_.push_back(e);
+            auto rec = e.serialize();
+            ASSERT_TRUE(w.write(rec.data(), rec.size()));
+        }
+        ASSERT_TRUE(w.flush());
+    }
+
+    std::vector<Employee> ReadOutput() {
+        std::vector<Employee> result;
+        auto size = output_.getFileSize64();
+        EXPECT_TRUE(size.has_value());
+        BufferedReader r(output_, 0, size.value_or(0));
+        while (const char* p = r.peek(Employee::SERIALIZED_SIZE)) {
+            result.push_back(Employee::deserialize(p));
+            r.skip(Employee::SERIALIZED_SIZE);
+        }
+        return result;
+    }
+};
+
+TEST(LoserTreeTest, MergesSortedSources) {
+    std::vector<std::vector<int>> src = { { 1, 4, 9 }, {}, { 2, 3, 10, 11 }, { 0, 4 } };
+    std::vector<size_t> pos(src.size(), 0);
+    std::vector<char> empty = { 0, 1, 0, 0 };
+    auto less = [&](size_t a, size_t b) { return src[a][pos[a]] < src[b][pos[b]]; };
+    LoserTree<decltype(less)> tree(src.size(), less, empty);
+
+    std::vector<int> merged;
+    while (!tree.empty()) {
+        size_t s = tree.top();
+        merged.push_back(src[s][pos[s]]);
+        tree.replace_top(++pos[s] == src[s].size());
+    }
+    EXPECT_EQ((std::vector<int>{ 0, 1, 2, 3, 4, 4, 9, 10, 11 }), merged);
+}
+
+TEST(BufferedIOTest, WriterAndReaderRoundTrip) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    std::string payload;
+    {
+        BufferedWriter w(f, 0, 16);
+        for (int i = 0; i < 100; i++) {
+            std::string s = std::to_string(i) + ";";
+            payload += s;
+            ASSERT_TRUE(w.write(s.data(), s.size()));
+        }
+        // Larger than the buffer: written through
+        std::string big(64, 'x');
+        payload += big;
+        ASSERT_TRUE(w.write(big.data(), big.size()));
+        EXPECT_EQ(payload.size(), w.offset());
+    }
+
+    BufferedReader r(f, 0, payload.size(), 8);
+    std::string back(payload.size(), '\0');
+    ASSERT_TRUE(r.read(&back[0], 5));
+    ASSERT_TRUE(r.read(&back[5], payload.size() - 5));
+    EXPECT_EQ(payload, back);
+    EXPECT_EQ(0u, r.remaining());
+    EXPECT_EQ(nullptr, r.peek(1));
+}
+
+TEST_F(ExternalSortTest, InMemoryPathSortsById) {
+    WriteRecords(1000);
+    ExternalSortOptions opt;
+    opt.key = SortKey::id;
+    ASSERT_TRUE(ExternalSort::sort(input_, output_, opt));
+
+    std::vector<Employee> out = ReadOutput();
+    ASSERT_EQ(employees_.size(), out.size());
+    EXPECT_TRUE(std::is_sorted(out.begin(), out.end(),
+        [](const Employee& a, const Employee& b) { return a.id() < b.id(); }));
+}
+
+TEST_F(ExternalSortTest, SpillsRunsAndMergesByHours) {
+    // Minimum budget holds ~25k records, so this produces several runs and multiple workers
+    WriteRecords(120000);
+    ExternalSortOptions opt;
+    opt.key = SortKey::hours;
+    opt.memory_budget = ExternalSort::MIN_MEMORY_BUDGET;
+    opt.threads = 4;
+    ASSERT_TRUE(ExternalSort::sort(input_, output_, opt));
+
+    std::vector<Employee> out = ReadOutput();
+    ASSERT_EQ(employees_.size(), out.size());
+
+    // Stable sort: compare with std::stable_sort on the original sequence
+    std::vector<Employee> expected = employees_;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](const Employee& a, const Employee& b) { return a.hours() < b.hours(); });
+    for (size_t i = 0; i < out.size(); i++) {
+        ASSERT_EQ(expected[i].hours(), out[i].hours());
+        ASSERT_EQ(expected[i].id(), out[i].id());
+    }
+}
+
+TEST_F(ExternalSortTest, MultiPassMergeByName) {
+    // More runs than the minimum budget can buffer at once forces intermediate merge passes
+    WriteRecords(400000);
+    ExternalSortOptions opt;
+    opt.key = SortKey::name;
+    opt.memory_budget = ExternalSort::MIN_MEMORY_BUDGET;
+    opt.io_buffer_size = ExternalSort::MIN_MERGE_BUFFER;
+    ASSERT_TRUE(ExternalSort::sort(input_, output_, opt));
+
+    std::vector<Employee> out = ReadOutput();
+    ASSERT_EQ(employees_.size(), out.size());
+    EXPECT_TRUE(std::is_sorted(out.begin(), out.end(), [](const Employee& a, const Employee& b) {
+        return memcmp(a.name(), b.name(), Employee::BUFF_SIZE) < 0;
+    }));
+}
+
+TEST_F(ExternalSortTest, SortsVersionedFilesIntoVersionedOutput) {
+    for (EmployeeLayout layout : { EmployeeLayout::compact, EmployeeLayout::aligned }) {
+        input_ = File::openTemporary();
+        output_ = File::openTemporary();
+        employees_.clear();
+        {
+            EmployeeFileWriter w(input_, 1000, 4096, layout);
+            for (size_t i = 0; i < 60000; i++) {
+                employees_.emplace_back(static_cast<Employee::ID_TYPE>((i * 40503) % 65536), "Versioned",
+                                        static_cast<double>(i % 977));
+                ASSERT_TRUE(w.append(employees_.back()));
+            }
+            ASSERT_TRUE(w.finish());
+        }
+
+        // The minimum budget spills, so both the batch and the merge paths write the output
+        ExternalSortOptions opt;
+        opt.key = SortKey::id;
+        opt.memory_budget = ExternalSort::MIN_MEMORY_BUDGET;
+        ASSERT_TRUE(ExternalSort::sort(input_, output_, opt));
+
+        auto reader = EmployeeFileReader::open(output_);
+        ASSERT_TRUE(reader.has_value());
+        EXPECT_TRUE(reader->versioned());
+        EXPECT_EQ(layout, reader->header().layout());
+        EXPECT_EQ(1000u, reader->header().block_records);
+        EXPECT_TRUE(reader->verify());
+        ASSERT_EQ(employees_.size(), reader->size());
+
+        std::vector<Employee> expected = employees_;
+        std::stable_sort(expected.begin(), expected.end(),
+            [](const Employee& a, const Employee& b) { return a.id() < b.id(); });
+        for (size_t i = 0; i < expected.size(); i++) {
+            auto e = reader->at(i);
+            ASSERT_TRUE(e.has_value());
+            ASSERT_EQ(expected[i].id(), e->id());
+            ASSERT_EQ(expected[i].hours(), e->hours());
+        }
+    }
+
+    // A file with a damaged header is neither versioned nor legacy
+    char junk = 0x7f;
+    ASSERT_TRUE(input_.writeAt(&junk, 1, 20));
+    EXPECT_FALSE(ExternalSort::sort(input_, output_));
+}
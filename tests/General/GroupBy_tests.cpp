@@ -0,0 +1,141 @@
+/**
+ * @file GroupBy_tests.cpp
+ * @brief Unit tests for the hash group-by aggregator using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <cstring>
+#include <map>
+#include <string>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeColumns.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/GroupBy.h>
+
+using namespace core::General;
+
+class GroupByTest : public ::testing::Test {
+protected:
+    EmployeeColumns table_;
+
+    void SetUp() override {
+        static const char* names[] = { "Ivanov", "Petrov", "Sidorov", "Smirnov", "Kuznetsov", "Popov", "Vasiliev" };
+        for (size_t i = 0; i < 200003; i++) {
+            double h = static_cast<double>((i * 13) % 80) / 4.0;
+            table_.push_back(Employee(static_cast<Employee::ID_TYPE>((i * 7919) % 65536), names[(i / 3) % 7], h));
+        }
+    }
+
+    template <class Key>
+    std::map<Key, GroupStats> Expected(Key (*key)(const EmployeeColumns&, size_t)) const {
+        std::map<Key, GroupStats> groups;
+        for (size_t i = 0; i < table_.size(); i++)
+            groups[key(table_, i)].add(table_.hours()[i]);
+        return groups;
+    }
+};
+
+static void ExpectSame(const GroupStats& a, const GroupStats& b) {
+    EXPECT_EQ(a.count, b.count);
+    EXPECT_NEAR(a.hours_sum, b.hours_sum, 1e-6 * (1 + a.hours_sum));
+    EXPECT_EQ(a.hours_min, b.hours_min);
+    EXPECT_EQ(a.hours_max, b.hours_max);
+}
+
+TEST(GroupTableTest, InsertFindMerge) {
+    GroupTable a, b;
+    for (uint64_t k = 0; k < 1000; k++) {
+        a.at(k * 3).add(1.0);
+        b.at(k * 5).add(2.0);
+    }
+    EXPECT_EQ(1000u, a.size());
+    ASSERT_NE(nullptr, a.find(0));
+    EXPECT_EQ(nullptr, a.find(1));
+
+    a.merge(b);
+    const GroupStats* both = a.find(15);
+    ASSERT_NE(nullptr, both);
+    EXPECT_EQ(2u, both->count);
+    EXPECT_EQ(3.0, both->hours_sum);
+    EXPECT_EQ(1.0, both->hours_min);
+    EXPECT_EQ(2.0, both->hours_max);
+
+    std::vector<GroupRow> rows = a.rows();
+    EXPECT_EQ(a.size(), rows.size());
+    for (size_t i = 1; i < rows.size(); i++)
+        EXPECT_LT(rows[i - 1].key, rows[i].key);
+
+    a.clear();
+    EXPECT_EQ(0u, a.size());
+    EXPECT_EQ(nullptr, a.find(15));
+}
+
+TEST_F(GroupByTest, ByIdBucketMatchesSerial) {
+    GroupByOptions opts;
+    opts.key = GroupKey::id_bucket;
+    opts.bucket_width = 1000;
+    opts.threads = 4;
+    GroupByResult r = GroupBy::run(table_, opts);
+
+    auto expected = Expected<uint64_t>([](const EmployeeColumns& t, size_t i) -> uint64_t {
+        return t.ids()[i] - t.ids()[i] % 1000;
+    });
+    ASSERT_EQ(expected.size(), r.rows.size());
+    size_t k = 0;
+    for (const auto& e : expected) {
+        EXPECT_EQ(e.first, r.rows[k].key);
+        ExpectSame(e.second, r.rows[k].stats);
+        k++;
+    }
+}
+
+TEST_F(GroupByTest, ByNameKeepsFirstSeenOrder) {
+    GroupByOptions opts;
+    opts.threads = 3;
+    GroupByResult r = GroupBy::run(table_, opts);
+
+    auto expected = Expected<std::string>([](const EmployeeColumns& t, size_t i) {
+        return std::string(t.names()[i].data(), strnlen(t.names()[i].data(), Employee::BUFF_SIZE));
+    });
+    ASSERT_EQ(expected.size(), r.rows.size());
+    ASSERT_EQ(expected.size(), r.names.size());
+    EXPECT_STREQ("Ivanov", r.names.name(static_cast<NameDictionary::Code>(r.rows[0].key)));
+    EXPECT_STREQ("Petrov", r.names.name(static_cast<NameDictionary::Code>(r.rows[1].key)));
+    for (const GroupRow& g : r.rows)
+        ExpectSame(expected[r.names.name(static_cast<NameDictionary::Code>(g.key))], g.stats);
+}
+
+TEST_F(GroupByTest, FileMatchesTable) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    {
+        EmployeeFileWriter w(f);
+        for (size_t i = 0; i < table_.size(); i++)
+            ASSERT_TRUE(w.append(table_.employee(i)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    GroupByOptions opts;
+    opts.key = GroupKey::id;
+    opts.threads = 4;
+    auto from_file = GroupBy::run(f, opts);
+    ASSERT_TRUE(from_file.has_value());
+    GroupByResult in_memory = GroupBy::run(table_, opts);
+    ASSERT_EQ(in_memory.rows.size(), from_file->rows.size());
+    for (size_t i = 0; i < in_memory.rows.size(); i++) {
+        EXPECT_EQ(in_memory.rows[i].key, from_file->rows[i].key);
+        ExpectSame(in_memory.rows[i].stats, from_file->rows[i].stats);
+    }
+}
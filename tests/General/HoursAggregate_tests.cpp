@@ -0,0 +1,210 @@
+/**
+ * @file HoursAggregate_tests.cpp
+ * @brief Unit tests for the incrementally maintained hours aggregate using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/EmployeeLog.h>
+#include <core/General/EmployeeStore.h>
+#include <core/General/File.h>
+#include <core/General/HoursAggregate.h>
+
+using namespace core::General;
+
+TEST(HoursAggregateTest, InsertUpdateErase) {
+    HoursAggregate agg;
+    EXPECT_FALSE(agg.min().has_value());
+    EXPECT_FALSE(agg.mean().has_value());
+
+    for (double h : { 5.0, 1.0, 9.0, 5.0, 3.0 })
+        agg.insert(h);
+    EXPECT_EQ(5u, agg.count());
+    EXPECT_EQ(23.0, agg.sum());
+    EXPECT_EQ(1.0, agg.min().value());
+    EXPECT_EQ(9.0, agg.max().value());
+
+    // Removing the maximum exposes the next one without a rescan
+    ASSERT_TRUE(agg.erase(9.0));
+    EXPECT_EQ(5.0, agg.max().value());
+    ASSERT_TRUE(agg.erase(5.0));
+    EXPECT_EQ(5.0, agg.max().value());
+    EXPECT_FALSE(agg.erase(42.0));
+
+    ASSERT_TRUE(agg.update(1.0, 0.5));
+    EXPECT_EQ(0.5, agg.min().value());
+    EXPECT_FALSE(agg.update(1.0, 2.0));
+    EXPECT_EQ(3u, agg.count());
+    EXPECT_DOUBLE_EQ(8.5, agg.sum());
+
+    // NaN is counted but stays out of sum, min and max
+    agg.insert(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(4u, agg.count());
+    EXPECT_DOUBLE_EQ(8.5 / 3, agg.mean().value());
+    ASSERT_TRUE(agg.erase(std::numeric_limits<double>::quiet_NaN()));
+
+    GroupStats s = agg.stats();
+    EXPECT_EQ(3u, s.count);
+    EXPECT_EQ(0.5, s.hours_min);
+    EXPECT_EQ(5.0, s.hours_max);
+}
+
+TEST(HoursAggregateTest, CompensatedSumDoesNotDrift) {
+    HoursAggregate agg;
+    agg.insert(1e16);
+    for (int i = 0; i < 1000; i++)
+        agg.insert(1.0);
+    ASSERT_TRUE(agg.erase(1e16));
+    EXPECT_EQ(1000.0, agg.sum());
+}
+
+TEST(HoursAggregateTest, InfinitiesStayOutOfTheSum) {
+    const double inf = std::numeric_limits<double>::infinity();
+    HoursAggregate agg;
+    agg.insert(1.5);
+    agg.insert(inf);
+    EXPECT_EQ(inf, agg.sum());
+    EXPECT_EQ(inf, agg.max().value());
+    agg.insert(-inf);
+    EXPECT_TRUE(std::isnan(agg.sum()));
+    EXPECT_EQ(-inf, agg.min().value());
+
+    // A checkpoint keeps the infinities apart as well
+    File f = File::openTemporary();
+    ASSERT_TRUE(agg.write(f));
+    auto back = HoursAggregate::read(f);
+    ASSERT_TRUE(back.has_value());
+    EXPECT_TRUE(std::isnan(back->sum()));
+
+    // Removing them leaves the finite sum intact
+    for (HoursAggregate* a : { &agg, &back.value() }) {
+        ASSERT_TRUE(a->erase(inf));
+        EXPECT_EQ(-inf, a->sum());
+        ASSERT_TRUE(a->erase(-inf));
+        EXPECT_EQ(1.5, a->sum());
+        a->insert(2.0);
+        EXPECT_EQ(3.5, a->sum());
+        EXPECT_EQ(2.0, a->max().value());
+    }
+}
+
+TEST(HoursAggregateTest, CheckpointRoundTrip) {
+    HoursAggregate agg;
+    for (int i = 0; i < 5000; i++)
+        agg.insert(static_cast<double>(i % 700) / 8.0);
+    agg.set_stamp(77);
+
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    ASSERT_TRUE(agg.write(f));
+    auto back = HoursAggregate::read(f);
+    ASSERT_TRUE(back.has_value());
+    EXPECT_EQ(77u, back->stamp());
+    EXPECT_EQ(agg.count(), back->count());
+    EXPECT_EQ(agg.sum(), back->sum());
+    EXPECT_EQ(agg.min(), back->min());
+    EXPECT_EQ(agg.max(), back->max());
+
+    // The restored multiset keeps answering after further changes
+    ASSERT_TRUE(back->erase(699.0 / 8.0));
+    EXPECT_EQ(699.0 / 8.0, back->max().value());
+
+    char byte;
+    ASSERT_TRUE(f.readAt(&byte, 1, 200));
+    byte ^= 0x10;
+    ASSERT_TRUE(f.writeAt(&byte, 1, 200));
+    EXPECT_FALSE(HoursAggregate::read(f).has_value());
+    EXPECT_EQ("a.emp.agg", HoursAggregate::path_for("a.emp"));
+}
+
+TEST(HoursAggregateTest, FollowsEmployeeStoreUpdates) {
+    File data = File::openTemporary();
+    ASSERT_TRUE(data.is_opened());
+    EmployeeFileWriter w(data, 500);
+    for (int i = 0; i < 2000; i++)
+        ASSERT_TRUE(w.append(Employee(static_cast<Employee::ID_TYPE>(i), "Agg", i % 100)));
+    ASSERT_TRUE(w.finish());
+
+    auto agg = HoursAggregate::from_file(data);
+    ASSERT_TRUE(agg.has_value());
+    const uint64_t before = agg->stamp();
+    EXPECT_EQ(HoursAggregate::data_stamp(data), before);
+    EXPECT_EQ(99.0, agg->max().value());
+
+    auto store = EmployeeStore::open(data);
+    ASSERT_TRUE(store.has_value());
+    store->attach(&agg.value());
+    ASSERT_TRUE(store->set_hours(5, 1000.0));
+    ASSERT_TRUE(store->put(6, Employee(6, "Agg", -3.0)));
+    ASSERT_TRUE(store->update_hours({ { 10, 2.0 }, { 11, 2.0 }, { 1500, 0.5 } }, HoursUpdateMode::add));
+    EXPECT_FALSE(store->set_hours(2000, 1.0));
+    ASSERT_TRUE(store->flush());
+
+    // Same record count, new content: a checkpoint from before no longer matches
+    EXPECT_NE(before, agg->stamp());
+    EXPECT_EQ(HoursAggregate::data_stamp(data), agg->stamp());
+
+    // The maintained aggregate matches a fresh scan
+    auto scanned = HoursAggregate::from_file(data);
+    ASSERT_TRUE(scanned.has_value());
+    EXPECT_EQ(scanned->stamp(), agg->stamp());
+    EXPECT_EQ(scanned->count(), agg->count());
+    EXPECT_DOUBLE_EQ(scanned->sum(), agg->sum());
+    EXPECT_EQ(1000.0, agg->max().value());
+    EXPECT_EQ(-3.0, agg->min().value());
+    EXPECT_EQ(scanned->min(), agg->min());
+}
+
+TEST(HoursAggregateTest, FollowsEmployeeLogPuts) {
+    char temp[MAX_PATH] = {};
+    ASSERT_NE(0u, GetTempPathA(MAX_PATH, temp));
+    std::string dir = std::string(temp) + "HoursAggregateTest-" + std::to_string(GetTickCount64());
+    {
+        EmployeeLogOptions opts;
+        opts.background_compaction = false;
+        EmployeeLog log(dir.c_str(), opts);
+        ASSERT_TRUE(log.is_open());
+        for (int i = 0; i < 100; i++)
+            ASSERT_TRUE(log.put(Employee(static_cast<Employee::ID_TYPE>(i), "Agg", i)));
+
+        HoursAggregate agg;
+        log.attach(&agg);
+        EXPECT_EQ(100u, log.hours_stats().count);
+        EXPECT_EQ(99.0, log.hours_stats().hours_max);
+
+        ASSERT_TRUE(log.set_hours(99, 1.0));
+        ASSERT_TRUE(log.put(Employee(500, "New", 250.0)));
+        GroupStats s = log.hours_stats();
+        EXPECT_EQ(101u, s.count);
+        EXPECT_EQ(250.0, s.hours_max);
+        EXPECT_DOUBLE_EQ(4950.0 - 99.0 + 1.0 + 250.0, s.hours_sum);
+        EXPECT_EQ(102u, agg.stamp());
+        log.attach(nullptr);
+    }
+
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA((dir + "\\*.log").c_str(), &data);
+    if (INVALID_HANDLE_VALUE != find) {
+        do {
+            DeleteFileA((dir + "\\" + data.cFileName).c_str());
+        } while (FindNextFileA(find, &data));
+        FindClose(find);
+    }
+    RemoveDirectoryA(dir.c_str());
+}
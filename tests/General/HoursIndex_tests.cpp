@@ -0,0 +1,161 @@
+/**
+ * @file HoursIndex_tests.cpp
+ * @brief Unit tests for the persistent hours index using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/File.h>
+#include <core/General/HoursIndex.h>
+
+using namespace core::General;
+
+class HoursIndexTest : public ::testing::Test {
+protected:
+    File data_;
+    File index_;
+    std::vector<double> hours_;
+
+    void SetUp() override {
+        data_ = File::openTemporary();
+        index_ = File::openTemporary();
+        ASSERT_TRUE(data_.is_opened());
+        ASSERT_TRUE(index_.is_opened());
+    }
+
+    /**
+     * Writes @p n records whose hours follow a scrambled but reproducible pattern.
+     */
+    void WriteRecords(size_t n) {
+        std::vector<char> buf;
+        buf.reserve(n * Employee::SERIALIZED_SIZE);
+        for (size_t i = 0; i < n; i++) {
+            double h = static_cast<double>((i * 7919) % 1000) / 4.0;
+            hours_.push_back(h);
+            auto rec = Employee(static_cast<Employee::ID_TYPE>(i), "worker", h).serialize();
+            buf.insert(buf.end(), rec.begin(), rec.end());
+        }
+        ASSERT_TRUE(data_.writeAt(buf.data(), static_cast<DWORD>(buf.size()), 0));
+    }
+
+    double HoursAt(uint64_t offset) const {
+        return hours_[offset / Employee::SERIALIZED_SIZE];
+    }
+};
+
+TEST_F(HoursIndexTest, EmptyDataBuildsEmptyIndex) {
+    ASSERT_TRUE(HoursIndex::build(data_, index_));
+    auto idx = HoursIndex::open(std::move(index_));
+    ASSERT_TRUE(idx.has_value());
+    EXPECT_EQ(0u, idx->size());
+    EXPECT_TRUE(idx->range(0, 1000).value().empty());
+    EXPECT_TRUE(idx->top(5).value().empty());
+}
+
+TEST_F(HoursIndexTest, OpenRejectsGarbage) {
+    const char junk[64] = "definitely not an index";
+    ASSERT_TRUE(index_.writeAt(junk, sizeof(junk), 0));
+    EXPECT_FALSE(HoursIndex::open(std::move(index_)).has_value());
+}
+
+TEST_F(HoursIndexTest, RangeMatchesFullScan) {
+    WriteRecords(5000);
+    ASSERT_TRUE(HoursIndex::build(data_, index_));
+    auto idx = HoursIndex::open(std::move(index_));
+    ASSERT_TRUE(idx.has_value());
+    ASSERT_EQ(5000u, idx->size());
+
+    std::vector<uint64_t> offsets = idx->range(30.0, 40.0).value();
+    size_t expected = std::count_if(hours_.begin(), hours_.end(),
+                                    [](double h) { return h >= 30.0 && h <= 40.0; });
+    ASSERT_EQ(expected, offsets.size());
+
+    // Results are ordered by hours and every offset points at a matching record
+    double prev = 30.0;
+    for (uint64_t off : offsets) {
+        EXPECT_EQ(0u, off % Employee::SERIALIZED_SIZE);
+        double h = HoursAt(off);
+        EXPECT_GE(h, prev);
+        EXPECT_LE(h, 40.0);
+        prev = h;
+    }
+}
+
+TEST_F(HoursIndexTest, TopAndBottom) {
+    WriteRecords(3000);
+    ASSERT_TRUE(HoursIndex::build(data_, index_));
+    auto idx = HoursIndex::open(std::move(index_));
+    ASSERT_TRUE(idx.has_value());
+
+    std::vector<double> sorted = hours_;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<uint64_t> top = idx->top(10).value();
+    ASSERT_EQ(10u, top.size());
+    for (size_t i = 0; i < top.size(); i++)
+        EXPECT_EQ(sorted[sorted.size() - 1 - i], HoursAt(top[i]));
+
+    std::vector<uint64_t> bottom = idx->bottom(10).value();
+    ASSERT_EQ(10u, bottom.size());
+    for (size_t i = 0; i < bottom.size(); i++)
+        EXPECT_EQ(sorted[i], HoursAt(bottom[i]));
+
+    // Asking for more than exists returns everything
+    EXPECT_EQ(3000u, idx->top(100000).value().size());
+}
+
+TEST_F(HoursIndexTest, SmallBudgetSpillsAndMerges) {
+    // Enough records that the minimum budget forces several sorted runs
+    WriteRecords(200000);
+    ASSERT_TRUE(HoursIndex::build(data_, index_, HoursIndex::MIN_MEMORY_BUDGET));
+    auto idx = HoursIndex::open(std::move(index_));
+    ASSERT_TRUE(idx.has_value());
+    ASSERT_EQ(200000u, idx->size());
+
+    std::vector<double> sorted = hours_;
+    std::sort(sorted.begin(), sorted.end());
+    for (uint64_t i = 0; i < idx->size(); i += 997) {
+        auto e = idx->at(i);
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(sorted[i], e->hours);
+    }
+
+    EXPECT_EQ(static_cast<uint64_t>(std::lower_bound(sorted.begin(), sorted.end(), 100.0) - sorted.begin()),
+              idx->lower_bound(100.0).value());
+    EXPECT_EQ(static_cast<uint64_t>(std::upper_bound(sorted.begin(), sorted.end(), 100.0) - sorted.begin()),
+              idx->upper_bound(100.0).value());
+}
+
+TEST_F(HoursIndexTest, ReadErrorsAreNotEmptyResults) {
+    WriteRecords(5000);
+    ASSERT_TRUE(HoursIndex::build(data_, index_));
+    HANDLE h = index_.handle();
+    auto idx = HoursIndex::open(std::move(index_));
+    ASSERT_TRUE(idx.has_value());
+    ASSERT_TRUE(idx->lower_bound(100.0).has_value());
+
+    // Cut the entries off behind the index's back: the fences are already in memory
+    LARGE_INTEGER keep;
+    keep.QuadPart = 64;
+    ASSERT_TRUE(SetFilePointerEx(h, keep, nullptr, FILE_BEGIN));
+    ASSERT_TRUE(SetEndOfFile(h));
+
+    EXPECT_FALSE(idx->lower_bound(100.0).has_value());
+    EXPECT_FALSE(idx->upper_bound(100.0).has_value());
+    EXPECT_FALSE(idx->range(30.0, 40.0).has_value());
+    EXPECT_FALSE(idx->top(10).has_value());
+    EXPECT_FALSE(idx->bottom(10).has_value());
+}
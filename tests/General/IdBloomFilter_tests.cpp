@@ -0,0 +1,135 @@
+/**
+ * @file IdBloomFilter_tests.cpp
+ * @brief Unit tests for the blocked Bloom filter over Employee ids using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/IdBloomFilter.h>
+
+using namespace core::General;
+
+TEST(IdBloomFilterTest, NoFalseNegativesAndFewFalsePositives) {
+    IdBloomFilter filter(2000);
+    EXPECT_EQ(0u, filter.size_bytes() % IdBloomFilter::BLOCK_BYTES);
+    EXPECT_FALSE(filter.may_contain(1));
+
+    // Even ids go in, odd ids measure the false positive rate
+    for (uint32_t id = 0; id < 4000; id += 2)
+        filter.insert(static_cast<Employee::ID_TYPE>(id));
+    EXPECT_EQ(2000u, filter.key_count());
+    for (uint32_t id = 0; id < 4000; id += 2)
+        ASSERT_TRUE(filter.may_contain(static_cast<Employee::ID_TYPE>(id))) << id;
+
+    size_t false_positives = 0;
+    for (uint32_t id = 1; id < 40000; id += 2)
+        if (filter.may_contain(static_cast<Employee::ID_TYPE>(id)))
+            false_positives++;
+    EXPECT_LT(false_positives, 20000u * 3 / 100);
+
+    IdBloomFilter empty;
+    EXPECT_EQ(0u, empty.block_count());
+    EXPECT_FALSE(empty.may_contain(0));
+}
+
+TEST(IdBloomFilterTest, SizeIsCappedByIdDomain) {
+    IdBloomFilter filter(1000000, 20.0);
+    EXPECT_EQ(IdBloomFilter::MAX_BLOCKS, filter.block_count());
+    EXPECT_EQ(8192u, filter.size_bytes());
+    EXPECT_TRUE(filter.exact());
+    EXPECT_FALSE(IdBloomFilter(2000).exact());
+}
+
+TEST(IdBloomFilterTest, FullSizeFilterHasNoFalsePositives) {
+    IdBloomFilter filter(65536);
+    ASSERT_TRUE(filter.exact());
+    for (uint32_t id = 0; id < 65536; id += 3)
+        filter.insert(static_cast<Employee::ID_TYPE>(id));
+
+    // The exact bitmap survives a round trip
+    File side = File::openTemporary();
+    ASSERT_TRUE(side.is_opened());
+    ASSERT_TRUE(filter.write(side));
+    auto loaded = IdBloomFilter::read(side);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_TRUE(loaded->exact());
+
+    for (uint32_t id = 0; id < 65536; id++) {
+        ASSERT_EQ(0 == id % 3, filter.may_contain(static_cast<Employee::ID_TYPE>(id))) << id;
+        ASSERT_EQ(0 == id % 3, loaded->may_contain(static_cast<Employee::ID_TYPE>(id))) << id;
+    }
+}
+
+TEST(IdBloomFilterTest, WriteReadAndBuildFromFile) {
+    File data = File::openTemporary();
+    ASSERT_TRUE(data.is_opened());
+    EmployeeFileWriter w(data);
+    for (int i = 0; i < 3000; i++)
+        ASSERT_TRUE(w.append(Employee(static_cast<Employee::ID_TYPE>(i * 7), "Filtered", i)));
+    ASSERT_TRUE(w.finish());
+
+    auto built = IdBloomFilter::from_file(data);
+    ASSERT_TRUE(built.has_value());
+    EXPECT_EQ(3000u, built->key_count());
+
+    File side = File::openTemporary();
+    ASSERT_TRUE(side.is_opened());
+    ASSERT_TRUE(built->write(side));
+    auto loaded = IdBloomFilter::read(side);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(built->block_count(), loaded->block_count());
+    for (int id = 0; id < 65536; id++)
+        ASSERT_EQ(built->may_contain(static_cast<Employee::ID_TYPE>(id)),
+                  loaded->may_contain(static_cast<Employee::ID_TYPE>(id)));
+    for (int i = 0; i < 3000; i++)
+        ASSERT_TRUE(loaded->may_contain(static_cast<Employee::ID_TYPE>(i * 7)));
+
+    // A flipped bit in the stored blocks is detected
+    char byte;
+    ASSERT_TRUE(side.readAt(&byte, 1, 100));
+    byte ^= 1;
+    ASSERT_TRUE(side.writeAt(&byte, 1, 100));
+    EXPECT_FALSE(IdBloomFilter::read(side).has_value());
+
+    EXPECT_EQ("data.emp.bloom", IdBloomFilter::path_for("data.emp"));
+}
+
+TEST(IdBloomFilterTest, SkipsFilesWithoutTheId) {
+    // Eight files with disjoint id ranges, as after a range-partitioned export
+    std::vector<IdBloomFilter> filters;
+    for (int f = 0; f < 8; f++) {
+        IdBloomFilter filter(500);
+        for (int k = 0; k < 500; k++)
+            filter.insert(static_cast<Employee::ID_TYPE>(f * 1000 + k));
+        filters.push_back(std::move(filter));
+    }
+
+    size_t probes = 0, lookups = 0;
+    for (int id = 0; id < 8000; id += 3) {
+        size_t hits = 0;
+        for (const IdBloomFilter& filter : filters)
+            if (filter.may_contain(static_cast<Employee::ID_TYPE>(id)))
+                hits++;
+        if (id % 1000 < 500) {
+            ASSERT_GE(hits, 1u);
+        }
+        probes += hits;
+        lookups++;
+    }
+    // Without filters every lookup would open all eight files
+    EXPECT_LT(probes, lookups * 2);
+}
@@ -0,0 +1,228 @@
+/**
+ * @file MapReduce_tests.cpp
+ * @brief Unit tests for the multi-process GROUP BY partials using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/GroupBy.h>
+#include <core/General/MapReduce.h>
+#include <core/General/Pipe.h>
+
+using namespace core::General;
+
+namespace {
+    const char* NAMES[] = { "Ann", "Bob", "Cid", "Dee", "Eve", "Fay", "Gus" };
+
+    File make_data(size_t n) {
+        File data = File::openTemporary();
+        EmployeeFileWriter w(data, 1000);
+        for (size_t i = 0; i < n; i++)
+            w.append(Employee(static_cast<Employee::ID_TYPE>((i * 37) % 5000), NAMES[(i / 3) % 7], double(i % 97) / 4));
+        w.finish();
+        return data;
+    }
+
+    // What the driver does with worker processes, done in-process through temporary files
+    GroupByResult map_reduce(const File& data, const GroupByOptions& opts, size_t workers) {
+        auto reader = EmployeeFileReader::open(data);
+        GroupTable table;
+        NameDictionary names;
+        for (const MapRange& r : MapReduce::split(reader->size(), workers, 1000)) {
+            File partial = File::openTemporary();
+            EXPECT_TRUE(MapReduce::map(data, r, opts, partial));
+            partial.setFilePointer(0);
+            EXPECT_TRUE(MapReduce::reduce(partial, opts.key, table, names));
+        }
+        GroupByResult result;
+        result.rows = table.rows();
+        result.names = std::move(names);
+        return result;
+    }
+
+    void expect_same(const GroupByResult& a, const GroupByResult& b, bool by_name) {
+        ASSERT_EQ(a.rows.size(), b.rows.size());
+        for (size_t i = 0; i < a.rows.size(); i++) {
+            EXPECT_EQ(a.rows[i].key, b.rows[i].key);
+            if (by_name) {
+                auto code = static_cast<NameDictionary::Code>(a.rows[i].key);
+                EXPECT_STREQ(a.names.name(code), b.names.name(code));
+            }
+            EXPECT_EQ(a.rows[i].stats.count, b.rows[i].stats.count);
+            EXPECT_NEAR(a.rows[i].stats.hours_sum, b.rows[i].stats.hours_sum, 1e-6);
+            EXPECT_EQ(a.rows[i].stats.hours_min, b.rows[i].stats.hours_min);
+            EXPECT_EQ(a.rows[i].stats.hours_max, b.rows[i].stats.hours_max);
+        }
+    }
+
+    // Workers open the data by name, so end-to-end runs need a real path
+    struct NamedData {
+        std::string path;
+
+        explicit NamedData(size_t n) {
+            char temp[MAX_PATH] = {};
+            GetTempPathA(MAX_PATH, temp);
+            path = std::string(temp) + "MapReduceTest-" + std::to_string(GetTickCount64()) + ".emp";
+            File f = File::open(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+            EmployeeFileWriter w(f);
+            for (size_t i = 0; i < n; i++)
+                w.append(Employee(static_cast<Employee::ID_TYPE>((i * 37) % 5000), NAMES[(i / 3) % 7], double(i % 97) / 4));
+            w.finish();
+        }
+
+        ~NamedData() { DeleteFileA(path.c_str()); }
+    };
+}
+
+TEST(MapReduceTest, SplitsIntoBalancedRanges) {
+    EXPECT_TRUE(MapReduce::split(0, 4, 10).empty());
+
+    auto few = MapReduce::split(25, 4, 10);
+    ASSERT_EQ(2u, few.size());
+    EXPECT_EQ(13u, few[0].count);
+    EXPECT_EQ(13u, few[1].first);
+    EXPECT_EQ(12u, few[1].count);
+
+    auto many = MapReduce::split(1000003, 8, 1000);
+    ASSERT_EQ(8u, many.size());
+    uint64_t next = 0;
+    for (const MapRange& r : many) {
+        EXPECT_EQ(next, r.first);
+        EXPECT_GE(r.count, 125000u);
+        EXPECT_LE(r.count, 125001u);
+        next += r.count;
+    }
+    EXPECT_EQ(1000003u, next);
+}
+
+TEST(MapReduceTest, PartialsMergeToGroupByResult) {
+    File data = make_data(20000);
+    ASSERT_TRUE(data.is_opened());
+
+    for (GroupKey key : { GroupKey::id, GroupKey::id_bucket, GroupKey::name }) {
+        GroupByOptions opts;
+        opts.key = key;
+        opts.bucket_width = 256;
+        opts.threads = 1;
+        auto expected = GroupBy::run(data, opts);
+        ASSERT_TRUE(expected.has_value());
+        expect_same(*expected, map_reduce(data, opts, 5), GroupKey::name == key);
+    }
+}
+
+TEST(MapReduceTest, PartialsStreamThroughPipes) {
+    File data = make_data(5000);
+    GroupByOptions opts;
+    opts.key = GroupKey::name;
+
+    auto pipe = Pipe::create();
+    ASSERT_TRUE(pipe.has_value());
+    ASSERT_TRUE(MapReduce::map(data, { 100, 4000 }, opts, pipe->writer()));
+    pipe->close(PipeEnd::write);
+
+    GroupTable table;
+    NameDictionary names;
+    ASSERT_TRUE(MapReduce::reduce(pipe->reader(), GroupKey::name, table, names));
+    EXPECT_EQ(7u, names.size());
+    uint64_t total = 0;
+    for (const GroupRow& g : table.rows())
+        total += g.stats.count;
+    EXPECT_EQ(4000u, total);
+
+    // A range past the end is refused
+    EXPECT_FALSE(MapReduce::map(data, { 4000, 1001 }, opts, pipe->writer()));
+}
+
+TEST(MapReduceTest, RejectsDamagedPartials) {
+    File data = make_data(3000);
+    GroupByOptions opts;
+    opts.key = GroupKey::id;
+
+    File partial = File::openTemporary();
+    ASSERT_TRUE(MapReduce::map(data, { 0, 3000 }, opts, partial));
+    GroupTable table;
+    NameDictionary names;
+
+    // Grouped by another key
+    partial.setFilePointer(0);
+    EXPECT_FALSE(MapReduce::reduce(partial, GroupKey::id_bucket, table, names));
+
+    char byte;
+    ASSERT_TRUE(partial.readAt(&byte, 1, 100));
+    byte ^= 0x40;
+    ASSERT_TRUE(partial.writeAt(&byte, 1, 100));
+    partial.setFilePointer(0);
+    EXPECT_FALSE(MapReduce::reduce(partial, GroupKey::id, table, names));
+    EXPECT_EQ(0u, table.size());
+
+    EXPECT_FALSE(MapReduce::is_worker(1, nullptr));
+    char exe[] = "worker", flag[] = "--map-worker";
+    char* argv[] = { exe, flag };
+    EXPECT_TRUE(MapReduce::is_worker(2, argv));
+    EXPECT_EQ(2, MapReduce::worker_main(2, argv));
+}
+
+TEST(MapReduceTest, RunMatchesGroupByWithWorkerProcesses) {
+#ifndef MAP_REDUCE_WORKER_EXE
+    GTEST_SKIP() << "EmployeeMapReduce is not built";
+#else
+    NamedData data(100000);
+    File file = File::open(data.path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+
+    for (GroupKey key : { GroupKey::id_bucket, GroupKey::name }) {
+        MapReduceOptions opts;
+        opts.workers = 4;
+        opts.key = key;
+        opts.bucket_width = 100;
+        opts.min_records_per_worker = 1000;
+        opts.timeout_ms = 60000;
+        auto result = MapReduce::run(MAP_REDUCE_WORKER_EXE, data.path, opts);
+        ASSERT_TRUE(result.has_value());
+
+        GroupByOptions g;
+        g.key = key;
+        g.bucket_width = 100;
+        auto expected = GroupBy::run(file, g);
+        ASSERT_TRUE(expected.has_value());
+        expect_same(*expected, *result, GroupKey::name == key);
+    }
+
+    // A worker executable that cannot run the job fails the whole run
+    MapReduceOptions opts;
+    opts.min_records_per_worker = 1000;
+    EXPECT_FALSE(MapReduce::run(data.path, data.path, opts).has_value());
+#endif
+}
+
+TEST(MapReduceTest, RunTerminatesWorkersPastTheDeadline) {
+#ifndef MAP_REDUCE_WORKER_EXE
+    GTEST_SKIP() << "EmployeeMapReduce is not built";
+#else
+    NamedData data(2000000);
+    MapReduceOptions opts;
+    opts.workers = 2;
+    opts.min_records_per_worker = 1000;
+    opts.timeout_ms = 1;
+
+    // Far too short for any worker: the watchdog must end the run rather than let it block
+    ULONGLONG start = GetTickCount64();
+    EXPECT_FALSE(MapReduce::run(MAP_REDUCE_WORKER_EXE, data.path, opts).has_value());
+    EXPECT_LT(GetTickCount64() - start, 30000u);
+#endif
+}
@@ -0,0 +1,157 @@
+/**
+ * @file MappedEmployeeFile_tests.cpp
+ * @brief Unit tests for the memory-mapped Employee table using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <core/General/AlignedEmployee.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/EmployeeView.h>
+#include <core/General/File.h>
+#include <core/General/MappedEmployeeFile.h>
+
+using namespace core::General;
+
+namespace {
+    constexpr size_t COUNT = 30000;
+
+    // Ids 0, 2, 4, ... each repeated on three consecutive records
+    Employee Make(size_t i) {
+        return Employee(static_cast<Employee::ID_TYPE>((i / 3) * 2), "Mapped", static_cast<double>(i % 100));
+    }
+
+    void Write(const File& f, EmployeeLayout layout) {
+        EmployeeFileWriter w(f, 1000, 4096, layout);
+        for (size_t i = 0; i < COUNT; i++)
+            w.append(Make(i));
+        w.finish();
+    }
+}
+
+TEST(MappedEmployeeFileTest, IteratesRecordsInPlace) {
+    File f = File::openTemporary();
+    Write(f, EmployeeLayout::compact);
+    auto mapped = MappedEmployeeFile::open(f);
+    ASSERT_TRUE(mapped.has_value());
+    f.close();
+
+    ASSERT_EQ(COUNT, mapped->size());
+    EXPECT_FALSE(mapped->empty());
+    ASSERT_EQ(COUNT, static_cast<size_t>(std::distance(mapped->begin(), mapped->end())));
+
+    size_t i = 0;
+    for (EmployeeView v : *mapped) {
+        ASSERT_EQ(Make(i).id(), v.id());
+        ASSERT_EQ(Make(i).hours(), v.hours());
+        i++;
+    }
+    EXPECT_STREQ("Mapped", (*mapped)[123].name());
+
+    auto it = mapped->begin() + 10;
+    EXPECT_EQ(Make(10).id(), (*it).id());
+    EXPECT_EQ(Make(13).id(), it[3].id());
+    EXPECT_EQ(Make(9).id(), (*--it).id());
+    EXPECT_EQ(9, it - mapped->begin());
+    EXPECT_TRUE(mapped->begin() < it);
+
+    EXPECT_TRUE(std::is_sorted(mapped->begin(), mapped->end(),
+                               [](EmployeeView a, EmployeeView b) { return a.id() < b.id(); }));
+    EXPECT_EQ(COUNT / 100, static_cast<size_t>(std::count_if(mapped->begin(), mapped->end(),
+                                                             [](EmployeeView v) { return 42.0 == v.hours(); })));
+    EXPECT_TRUE(mapped->prefetch(1000, 5000));
+    EXPECT_TRUE(mapped->prefetch(COUNT - 10, 1000));
+}
+
+TEST(MappedEmployeeFileTest, BinarySearchesSortedIds) {
+    char temp[MAX_PATH] = {};
+    GetTempPathA(MAX_PATH, temp);
+    std::string path = std::string(temp) + "MappedEmployeeFileTest-" + std::to_string(GetTickCount64()) + ".emp";
+    {
+        File f = File::open(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        ASSERT_TRUE(f.is_opened());
+        Write(f, EmployeeLayout::compact);
+    }
+    auto mapped = MappedEmployeeFile::open(path.c_str(), MappedAccess::random);
+    ASSERT_TRUE(mapped.has_value());
+
+    // Present: the run of three records
+    auto lo = mapped->lower_bound(200);
+    auto hi = mapped->upper_bound(200);
+    EXPECT_EQ(300, lo - mapped->begin());
+    EXPECT_EQ(3, hi - lo);
+    EXPECT_EQ(200, (*lo).id());
+
+    // Absent: both bounds at the next larger id
+    lo = mapped->lower_bound(201);
+    EXPECT_EQ(lo, mapped->upper_bound(201));
+    EXPECT_EQ(202, (*lo).id());
+
+    EXPECT_EQ(mapped->begin(), mapped->lower_bound(0));
+    EXPECT_EQ(mapped->end(), mapped->lower_bound(Make(COUNT - 1).id() + 1));
+
+    mapped.reset();
+    DeleteFileA(path.c_str());
+}
+
+TEST(MappedEmployeeFileTest, ViewsAlignedRecordsInPlace) {
+    File f = File::openTemporary();
+    Write(f, EmployeeLayout::aligned);
+    auto mapped = MappedEmployeeFile::open(f);
+    ASSERT_TRUE(mapped.has_value());
+    EXPECT_EQ(EmployeeLayout::aligned, mapped->layout());
+    EXPECT_EQ(AlignedEmployee::SIZE, mapped->stride());
+    ASSERT_EQ(COUNT, mapped->size());
+    ASSERT_EQ(COUNT, static_cast<size_t>(std::distance(mapped->begin(), mapped->end())));
+
+    // Records sit at a 32-byte stride with the hours naturally aligned
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(mapped->data()) % alignof(double));
+    size_t i = 0;
+    for (EmployeeView v : *mapped) {
+        ASSERT_EQ(Make(i).id(), v.id());
+        ASSERT_EQ(Make(i).hours(), v.hours());
+        i++;
+    }
+    EXPECT_STREQ("Mapped", (*mapped)[123].name());
+    EXPECT_EQ(Make(777).hours(), (*mapped)[777].materialize().hours());
+
+    auto lo = mapped->lower_bound(200);
+    EXPECT_EQ(300, lo - mapped->begin());
+    EXPECT_EQ(3, mapped->upper_bound(200) - lo);
+    EXPECT_EQ(Make(30).id(), mapped->begin()[30].id());
+    EXPECT_TRUE(mapped->prefetch(0, 100));
+}
+
+TEST(MappedEmployeeFileTest, OpensLegacyFilesAndRejectsMissingOnes) {
+    // Legacy: bare records with no header
+    File legacy = File::openTemporary();
+    std::vector<char> bytes;
+    for (size_t i = 0; i < 100; i++) {
+        auto r = Make(i).serialize();
+        bytes.insert(bytes.end(), r.begin(), r.end());
+    }
+    ASSERT_TRUE(legacy.writeAt(bytes.data(), static_cast<DWORD>(bytes.size()), 0));
+    auto mapped = MappedEmployeeFile::open(legacy);
+    ASSERT_TRUE(mapped.has_value());
+    EXPECT_EQ(100u, mapped->size());
+    EXPECT_EQ(0, memcmp(bytes.data(), mapped->data(), bytes.size()));
+
+    EXPECT_FALSE(MappedEmployeeFile::open("does-not-exist.emp", MappedAccess::random).has_value());
+}
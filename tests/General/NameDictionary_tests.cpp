@@ -0,0 +1,99 @@
+/**
+ * @file NameDictionary_tests.cpp
+ * @brief Unit tests for name interning and the dictionary-coded table using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeColumns.h>
+#include <core/General/InternedColumns.h>
+#include <core/General/NameDictionary.h>
+
+using namespace core::General;
+
+TEST(NameDictionaryTest, InternAssignsDenseCodes) {
+    NameDictionary dict;
+    EXPECT_EQ(0u, dict.intern("Ivanov"));
+    EXPECT_EQ(1u, dict.intern("Petrov"));
+    EXPECT_EQ(0u, dict.intern("Ivanov"));
+    EXPECT_EQ(2u, dict.intern(""));
+    EXPECT_EQ(3u, dict.size());
+
+    EXPECT_EQ(1u, dict.find("Petrov"));
+    EXPECT_EQ(NameDictionary::NONE, dict.find("Sidorov"));
+    EXPECT_STREQ("Petrov", dict.name(1));
+}
+
+TEST(NameDictionaryTest, NormalizesLikeTheNameBuffer) {
+    NameDictionary dict;
+    // Bytes after the terminator and beyond BUFF_SIZE do not matter
+    char a[Employee::BUFF_SIZE] = { 'A', 'n', 'n', 'a', '\0', 'x', 'y' };
+    EXPECT_EQ(dict.intern("Anna"), dict.intern(a));
+    EXPECT_EQ(NameDictionary::hash("Anna"), NameDictionary::hash(a));
+
+    std::string long_name(Employee::BUFF_SIZE, 'Q');
+    NameDictionary::Code c = dict.intern((long_name + "tail").c_str());
+    EXPECT_EQ(c, dict.intern(long_name.c_str()));
+    EXPECT_EQ(long_name, std::string(dict.name(c)));
+}
+
+TEST(NameDictionaryTest, GrowsAndKeepsCodes) {
+    NameDictionary dict;
+    std::vector<std::string> names;
+    for (int i = 0; i < 20000; i++)
+        names.push_back("n" + std::to_string(i * 7919));
+    for (size_t i = 0; i < names.size(); i++)
+        ASSERT_EQ(i, dict.intern(names[i].c_str()));
+    for (size_t i = 0; i < names.size(); i++) {
+        ASSERT_EQ(i, dict.find(names[i].c_str()));
+        ASSERT_STREQ(names[i].c_str(), dict.name(static_cast<NameDictionary::Code>(i)));
+    }
+
+    dict.clear();
+    EXPECT_EQ(0u, dict.size());
+    EXPECT_EQ(NameDictionary::NONE, dict.find(names[5].c_str()));
+    EXPECT_EQ(0u, dict.intern(names[5].c_str()));
+}
+
+TEST(InternedColumnsTest, RoundTripAndGrouping) {
+    static const char* names[] = { "Ivanov", "Petrov", "Sidorov" };
+    EmployeeColumns plain;
+    for (int i = 0; i < 300; i++)
+        plain.push_back(Employee(static_cast<Employee::ID_TYPE>(i), names[i % 3], i * 0.5));
+
+    InternedColumns t = InternedColumns::from_columns(plain);
+    ASSERT_EQ(300u, t.size());
+    EXPECT_EQ(3u, t.dictionary().size());
+    EXPECT_EQ(t.codes()[0], t.codes()[3]);
+    EXPECT_NE(t.codes()[0], t.codes()[1]);
+    EXPECT_STREQ("Sidorov", t.name(299));
+
+    Employee e = t.employee(10);
+    EXPECT_EQ(10, e.id());
+    EXPECT_STREQ("Petrov", e.name());
+
+    std::vector<uint64_t> counts = t.count_by_name();
+    std::vector<double> hours = t.hours_by_name();
+    NameDictionary::Code ivanov = t.dictionary().find("Ivanov");
+    EXPECT_EQ(100u, counts[ivanov]);
+    double expected = 0;
+    for (int i = 0; i < 300; i += 3) expected += i * 0.5;
+    EXPECT_DOUBLE_EQ(expected, hours[ivanov]);
+
+    EmployeeColumns back = t.to_columns();
+    ASSERT_EQ(plain.size(), back.size());
+    for (size_t i = 0; i < back.size(); i++) {
+        EXPECT_EQ(plain.ids()[i], back.ids()[i]);
+        EXPECT_EQ(0, memcmp(plain.names()[i].data(), back.names()[i].data(), Employee::BUFF_SIZE));
+    }
+
+    auto rec = e.serialize();
+    InternedColumns r = InternedColumns::from_records(rec.data(), 1);
+    EXPECT_STREQ("Petrov", r.name(0));
+}
@@ -0,0 +1,134 @@
+/**
+ * @file PageCache_tests.cpp
+ * @brief Unit tests for the CLOCK page cache using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <atomic>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/PageCache.h>
+#include <core/General/Parallel.h>
+
+using namespace core::General;
+
+class PageCacheTest : public ::testing::Test {
+protected:
+    static constexpr size_t COUNT = 10000;
+    File file_;
+
+    static Employee Make(size_t i) {
+        return Employee(static_cast<Employee::ID_TYPE>(i), "Cached", static_cast<double>(i) / 2.0);
+    }
+
+    void SetUp() override {
+        file_ = File::openTemporary();
+        ASSERT_TRUE(file_.is_opened());
+        EmployeeFileWriter w(file_);
+        for (size_t i = 0; i < COUNT; i++)
+            ASSERT_TRUE(w.append(Make(i)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    static PageCacheOptions Options(size_t frames) {
+        PageCacheOptions opts;
+        opts.page_records = 100;
+        opts.budget_bytes = frames * 100 * Employee::SERIALIZED_SIZE;
+        return opts;
+    }
+};
+
+TEST_F(PageCacheTest, HitsAfterFirstMiss) {
+    PageCache cache(file_, Options(8));
+    ASSERT_TRUE(cache.is_open());
+    EXPECT_EQ(8u, cache.capacity());
+    EXPECT_EQ(COUNT, cache.size());
+
+    for (int round = 0; round < 3; round++) {
+        auto e = cache.at(1234);
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(1234, e->id());
+        EXPECT_EQ(617.0, e->hours());
+    }
+    PageCacheStats s = cache.stats();
+    EXPECT_EQ(1u, s.misses);
+    EXPECT_EQ(2u, s.hits);
+    EXPECT_FALSE(cache.at(COUNT).has_value());
+
+    PageCache::Pin last = cache.pin(COUNT / 100 - 1);
+    ASSERT_TRUE(last.valid());
+    EXPECT_EQ(COUNT - 100, last.first());
+    EXPECT_EQ(100u, last.size());
+    EXPECT_EQ(COUNT - 1, last[99].id());
+}
+
+TEST_F(PageCacheTest, ClockEvictsUnreferencedPages) {
+    PageCache cache(file_, Options(4));
+    for (uint64_t p = 0; p < 4; p++)
+        ASSERT_TRUE(cache.pin(p).valid());
+    EXPECT_EQ(0u, cache.stats().evictions);
+
+    // A fifth page must displace one of the four
+    ASSERT_TRUE(cache.pin(4).valid());
+    EXPECT_EQ(1u, cache.stats().evictions);
+    EXPECT_EQ(5u, cache.stats().misses);
+
+    // Cycling through more pages than frames keeps the cache bounded
+    for (uint64_t p = 0; p < 100; p++)
+        ASSERT_TRUE(cache.at(p * 100 + 7).has_value());
+    PageCacheStats s = cache.stats();
+    EXPECT_EQ(s.misses - cache.capacity(), s.evictions);
+    EXPECT_GE(s.misses, 100u);
+}
+
+TEST_F(PageCacheTest, PinnedPagesAreNotEvicted) {
+    PageCache cache(file_, Options(2));
+    PageCache::Pin a = cache.pin(0);
+    PageCache::Pin b = cache.pin(1);
+    ASSERT_TRUE(a.valid());
+    ASSERT_TRUE(b.valid());
+
+    // Every frame is pinned
+    EXPECT_FALSE(cache.pin(2).valid());
+    EXPECT_EQ(0, a[0].id());
+
+    b.release();
+    PageCache::Pin c = cache.pin(2);
+    ASSERT_TRUE(c.valid());
+    EXPECT_EQ(200, c[0].id());
+    // Page 0 survived because it stayed pinned
+    EXPECT_EQ(0, a[0].id());
+    EXPECT_EQ(1u, cache.stats().evictions);
+}
+
+TEST_F(PageCacheTest, ConcurrentLookups) {
+    PageCache cache(file_, Options(16));
+    std::atomic<size_t> wrong(0);
+    Parallel::run(4, [&](size_t t) {
+        uint64_t x = 0x9E3779B97F4A7C15ull * (t + 1);
+        for (int i = 0; i < 5000; i++) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            // Skewed towards a hot set of pages, like repeated id lookups
+            uint64_t r = (i % 4 == 0) ? x % COUNT : x % 1500;
+            auto e = cache.at(r);
+            if (!e.has_value() || e->id() != static_cast<Employee::ID_TYPE>(r))
+                wrong++;
+        }
+    });
+    EXPECT_EQ(0u, wrong.load());
+    PageCacheStats s = cache.stats();
+    EXPECT_EQ(20000u, s.hits + s.misses);
+    EXPECT_GT(s.hits, s.misses);
+}
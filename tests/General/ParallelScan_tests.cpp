@@ -0,0 +1,182 @@
+/**
+ * @file ParallelScan_tests.cpp
+ * @brief Unit tests for the partitioned parallel scan driver using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <core/General/AlignedEmployee.h>
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/EmployeeView.h>
+#include <core/General/File.h>
+#include <core/General/ParallelScan.h>
+
+using namespace core::General;
+
+namespace {
+    constexpr size_t COUNT = 250001;
+
+    Employee Make(size_t i) {
+        return Employee(static_cast<Employee::ID_TYPE>(i % 65536), "Scan", static_cast<double>(i % 1000) / 4.0);
+    }
+
+    /** @brief Per-worker visit log: every (first, n) batch and the id sum. */
+    struct Visits {
+        std::vector<std::pair<uint64_t, size_t>> batches;
+        uint64_t id_sum = 0;
+    };
+
+    std::optional<Visits> Scan(const File& f, const ParallelScanOptions& opts) {
+        return parallel_scan<Visits>(f,
+            [](Visits& v, const EmployeeRecords& records, size_t n, uint64_t first) {
+                v.batches.push_back({ first, n });
+                for (size_t i = 0; i < n; i++)
+                    v.id_sum += records[i].id();
+            },
+            [](Visits& into, Visits&& part) {
+                into.batches.insert(into.batches.end(), part.batches.begin(), part.batches.end());
+                into.id_sum += part.id_sum;
+            },
+            opts);
+    }
+
+    void ExpectFullCoverage(const Visits& v) {
+        // Batches arrive in range order after the fold and tile [0, COUNT) exactly
+        uint64_t next = 0;
+        for (const auto& b : v.batches) {
+            EXPECT_EQ(next, b.first);
+            next += b.second;
+        }
+        EXPECT_EQ(COUNT, next);
+
+        uint64_t expected = 0;
+        for (size_t i = 0; i < COUNT; i++)
+            expected += Make(i).id();
+        EXPECT_EQ(expected, v.id_sum);
+    }
+}
+
+TEST(ParallelScanTest, RangesAreContiguous) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    {
+        EmployeeFileWriter w(f);
+        for (size_t i = 0; i < COUNT; i++)
+            ASSERT_TRUE(w.append(Make(i)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    ParallelScanOptions opts;
+    opts.threads = 3;
+    auto scan = ParallelScan::open(f, opts);
+    ASSERT_TRUE(scan.has_value());
+    EXPECT_EQ(3u, scan->workers());
+    EXPECT_EQ(0u, scan->begin(0));
+    EXPECT_EQ(COUNT, scan->begin(scan->workers()));
+    for (size_t w = 0; w < scan->workers(); w++)
+        EXPECT_LE(scan->begin(w), scan->begin(w + 1));
+
+    std::vector<char> buffer;
+    const char* rec = scan->fetch(COUNT - 1, 1, buffer);
+    ASSERT_NE(nullptr, rec);
+    EXPECT_EQ(Make(COUNT - 1).id(), EmployeeView(rec).id());
+    EXPECT_EQ(nullptr, scan->fetch(COUNT, 1, buffer));
+}
+
+TEST(ParallelScanTest, MappedAndBufferedAgree) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    {
+        EmployeeFileWriter w(f);
+        for (size_t i = 0; i < COUNT; i++)
+            ASSERT_TRUE(w.append(Make(i)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    ParallelScanOptions opts;
+    opts.threads = 4;
+    opts.batch_records = 10000;
+    for (bool map : { true, false }) {
+        opts.map_file = map;
+        auto v = Scan(f, opts);
+        ASSERT_TRUE(v.has_value());
+        ExpectFullCoverage(*v);
+    }
+}
+
+TEST(ParallelScanTest, LegacyFilesAndSmallInputs) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    std::vector<char> raw(COUNT * Employee::SERIALIZED_SIZE);
+    for (size_t i = 0; i < COUNT; i++) {
+        auto rec = Make(i).serialize();
+        std::copy(rec.begin(), rec.end(), raw.begin() + i * Employee::SERIALIZED_SIZE);
+    }
+    ASSERT_TRUE(f.writeAt(raw.data(), static_cast<DWORD>(raw.size()), 0));
+
+    ParallelScanOptions opts;
+    opts.threads = 2;
+    auto v = Scan(f, opts);
+    ASSERT_TRUE(v.has_value());
+    ExpectFullCoverage(*v);
+
+    // One record never needs more than one worker
+    File one = File::openTemporary();
+    ASSERT_TRUE(one.writeAt(raw.data(), Employee::SERIALIZED_SIZE, 0));
+    opts.threads = 8;
+    auto scan = ParallelScan::open(one, opts);
+    ASSERT_TRUE(scan.has_value());
+    EXPECT_EQ(1u, scan->workers());
+}
+
+TEST(ParallelScanTest, AlignedFilesAreScannedInPlace) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    {
+        EmployeeFileWriter w(f, 4096, 1 << 20, EmployeeLayout::aligned);
+        for (size_t i = 0; i < COUNT; i++)
+            ASSERT_TRUE(w.append(Make(i)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    ParallelScanOptions opts;
+    opts.threads = 3;
+    auto scan = ParallelScan::open(f, opts);
+    ASSERT_TRUE(scan.has_value());
+    EXPECT_TRUE(scan->mapped());
+
+    // fetch_records() views the 32-byte records; fetch() still hands out compact ones
+    std::vector<char> buffer;
+    EmployeeRecords in_place = scan->fetch_records(1000, 10, buffer);
+    ASSERT_NE(nullptr, in_place.data());
+    EXPECT_EQ(EmployeeLayout::aligned, in_place.layout());
+    EXPECT_EQ(AlignedEmployee::SIZE, in_place.stride());
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(Make(1009).hours(), in_place[9].hours());
+    const char* compact = scan->fetch(1000, 10, buffer);
+    ASSERT_NE(nullptr, compact);
+    EXPECT_EQ(Make(1009).id(), EmployeeView(compact + 9 * Employee::SERIALIZED_SIZE).id());
+    EXPECT_EQ(nullptr, scan->fetch_records(COUNT, 1, buffer).data());
+
+    for (bool map : { true, false }) {
+        opts.map_file = map;
+        auto v = Scan(f, opts);
+        ASSERT_TRUE(v.has_value());
+        ExpectFullCoverage(*v);
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file ParallelSort_tests.cpp
+ * @brief Unit tests for the parallel in-memory sorts using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeColumns.h>
+#include <core/General/ParallelSort.h>
+
+using namespace core::General;
+
+class ParallelSortTest : public ::testing::Test {
+protected:
+    std::vector<Employee> employees_;
+
+    /**
+     * Builds rows with many duplicate keys so that stability is observable.
+     */
+    void MakeRows(size_t n) {
+        static const char* names[] = { "Zed", "Anna", "Boris", "Anastasia", "Anna" };
+        employees_.clear();
+        for (size_t i = 0; i < n; i++) {
+            double h = static_cast<double>(static_cast<int>((i * 2654435761u) % 2001) - 1000) / 4.0;
+            employees_.emplace_back(static_cast<Employee::ID_TYPE>((i * 31) % 1000), names[(i * 3) % 5], h);
+        }
+    }
+
+    template <class Less>
+    std::vector<size_t> ExpectedOrder(Less less) const {
+        std::vector<size_t> idx(employees_.size());
+        for (size_t i = 0; i < idx.size(); i++) idx[i] = i;
+        std::stable_sort(idx.begin(), idx.end(),
+            [&](size_t a, size_t b) { return less(employees_[a], employees_[b]); });
+        return idx;
+    }
+
+    static void ExpectSameOrder(const std::vector<size_t>& expected, const std::vector<uint32_t>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_EQ(expected[i], actual[i]) << "at position " << i;
+    }
+};
+
+TEST_F(ParallelSortTest, RadixOrderByIdIsStable) {
+    MakeRows(200000);
+    auto order = ParallelSort::order(employees_.data(), employees_.size(), SortKey::id, 4);
+    ASSERT_TRUE(order.has_value());
+    ExpectSameOrder(ExpectedOrder([](const Employee& a, const Employee& b) { return a.id() < b.id(); }), *order);
+}
+
+TEST_F(ParallelSortTest, RadixOrderByHoursHandlesNegatives) {
+    MakeRows(150000);
+    auto order = ParallelSort::order(employees_.data(), employees_.size(), SortKey::hours, 3);
+    ASSERT_TRUE(order.has_value());
+    ExpectSameOrder(ExpectedOrder([](const Employee& a, const Employee& b) { return a.hours() < b.hours(); }), *order);
+}
+
+TEST_F(ParallelSortTest, MergeOrderByNameIsStable) {
+    MakeRows(180000);
+    auto order = ParallelSort::order(employees_.data(), employees_.size(), SortKey::name, 5);
+    ASSERT_TRUE(order.has_value());
+    ExpectSameOrder(ExpectedOrder([](const Employee& a, const Employee& b) {
+        return memcmp(a.name(), b.name(), Employee::BUFF_SIZE) < 0;
+    }), *order);
+}
+
+TEST_F(ParallelSortTest, SortEmployeesInPlace) {
+    MakeRows(1000);
+    std::vector<Employee> expected = employees_;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](const Employee& a, const Employee& b) { return a.hours() < b.hours(); });
+
+    ASSERT_TRUE(ParallelSort::sort(employees_.data(), employees_.size(), SortKey::hours));
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].id(), employees_[i].id());
+        EXPECT_EQ(expected[i].hours(), employees_[i].hours());
+    }
+}
+
+TEST_F(ParallelSortTest, SortColumnsMatchesRowSort) {
+    MakeRows(100000);
+    EmployeeColumns table;
+    for (const Employee& e : employees_)
+        table.push_back(e);
+
+    ASSERT_TRUE(ParallelSort::sort(table, SortKey::name, 4));
+    ASSERT_TRUE(ParallelSort::sort(employees_.data(), employees_.size(), SortKey::name, 4));
+
+    ASSERT_EQ(employees_.size(), table.size());
+    for (size_t i = 0; i < table.size(); i++) {
+        Employee e = table.employee(i);
+        ASSERT_EQ(employees_[i].id(), e.id());
+        ASSERT_EQ(employees_[i].hours(), e.hours());
+        ASSERT_EQ(0, memcmp(employees_[i].name(), e.name(), Employee::BUFF_SIZE));
+    }
+}
+
+TEST_F(ParallelSortTest, EmptyAndSingle) {
+    EXPECT_TRUE(ParallelSort::order(nullptr, 0, SortKey::id).value().empty());
+    MakeRows(1);
+    auto order = ParallelSort::order(employees_.data(), 1, SortKey::name);
+    ASSERT_TRUE(order.has_value());
+    ASSERT_EQ(1u, order->size());
+    EXPECT_EQ(0u, (*order)[0]);
+}
+
+TEST_F(ParallelSortTest, RejectsRowsPastThe32BitIndex) {
+    if (sizeof(size_t) <= sizeof(uint32_t))
+        GTEST_SKIP() << "size_t cannot exceed MAX_ROWS";
+    // Rejected before any row is read
+    MakeRows(2);
+    const size_t n = ParallelSort::MAX_ROWS + size_t(1);
+    EXPECT_FALSE(ParallelSort::order(employees_.data(), n, SortKey::id).has_value());
+    EXPECT_FALSE(ParallelSort::sort(employees_.data(), n, SortKey::hours));
+    EXPECT_TRUE(ParallelSort::sort(employees_.data(), employees_.size(), SortKey::hours));
+}
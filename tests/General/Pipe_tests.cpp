@@ -0,0 +1,125 @@
+/**
+ * @file Pipe_tests.cpp
+ * @brief Unit tests for the Pipe wrapper and record streaming using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/File.h>
+#include <core/General/Parallel.h>
+#include <core/General/Pipe.h>
+
+using namespace core::General;
+
+TEST(PipeTest, StreamsEmployeesThroughAnonymousPipe) {
+    auto pipe = Pipe::create(64 * 1024);
+    ASSERT_TRUE(pipe.has_value());
+    ASSERT_TRUE(pipe->reader().is_opened());
+    ASSERT_TRUE(pipe->writer().is_opened());
+    EXPECT_TRUE(Pipe::set_inheritable(pipe->reader(), true));
+    EXPECT_TRUE(Pipe::set_inheritable(pipe->reader(), false));
+
+    std::vector<Employee> sent;
+    for (int i = 0; i < 50000; i++)
+        sent.emplace_back(static_cast<Employee::ID_TYPE>(i), "Piped", i * 0.5);
+
+    std::vector<Employee> received;
+    bool wrote = false;
+    Parallel::run(2, [&](size_t w) {
+        if (0 == w) {
+            wrote = Pipe::write_employees(pipe->writer(), sent.data(), sent.size());
+            pipe->close(PipeEnd::write);
+            return;
+        }
+        std::vector<Employee> batch(4096);
+        size_t n;
+        while (0 != (n = Pipe::read_employees(pipe->reader(), batch.data(), batch.size())))
+            received.insert(received.end(), batch.begin(), batch.begin() + n);
+    });
+
+    EXPECT_TRUE(wrote);
+    ASSERT_EQ(sent.size(), received.size());
+    for (size_t i = 0; i < sent.size(); i++) {
+        ASSERT_EQ(sent[i].id(), received[i].id());
+        ASSERT_EQ(sent[i].hours(), received[i].hours());
+    }
+}
+
+TEST(PipeTest, ReassemblesRecordsSplitAcrossWrites) {
+    auto pipe = Pipe::create();
+    ASSERT_TRUE(pipe.has_value());
+
+    auto a = Employee(1, "First", 1.0).serialize();
+    auto b = Employee(2, "Second", 2.0).serialize();
+    std::vector<char> bytes(a.begin(), a.end());
+    bytes.insert(bytes.end(), b.begin(), b.end());
+
+    size_t got = 0;
+    std::vector<char> out(4 * Employee::SERIALIZED_SIZE);
+    Parallel::run(2, [&](size_t w) {
+        if (0 == w) {
+            // Split mid-record, then leave a partial record before closing
+            Pipe::write_all(pipe->writer(), bytes.data(), 10);
+            Sleep(20);
+            Pipe::write_all(pipe->writer(), bytes.data() + 10, bytes.size() - 10);
+            Pipe::write_all(pipe->writer(), bytes.data(), 5);
+            pipe->close(PipeEnd::write);
+            return;
+        }
+        size_t n;
+        while (0 != (n = Pipe::read_records(pipe->reader(), out.data() + got * Employee::SERIALIZED_SIZE, 4 - got)))
+            got += n;
+    });
+
+    ASSERT_EQ(2u, got);
+    EXPECT_EQ(1, Employee::deserialize(out.data()).id());
+    EXPECT_EQ(2, Employee::deserialize(out.data() + Employee::SERIALIZED_SIZE).id());
+
+    File reader = pipe->release(PipeEnd::read);
+    EXPECT_TRUE(reader.is_opened());
+    EXPECT_FALSE(pipe->reader().is_opened());
+}
+
+TEST(PipeTest, NamedPipeCarriesRecords) {
+    std::string name = "\\\\.\\pipe\\PipeTest-" + std::to_string(GetTickCount64());
+    File server = Pipe::create_named(name.c_str(), PIPE_ACCESS_INBOUND, 256 * 1024);
+    ASSERT_TRUE(server.is_opened());
+
+    const size_t count = 20000;
+    std::vector<char> records(count * Employee::SERIALIZED_SIZE);
+    for (size_t i = 0; i < count; i++) {
+        auto r = Employee(static_cast<Employee::ID_TYPE>(i), "Named", double(i)).serialize();
+        memcpy(records.data() + i * Employee::SERIALIZED_SIZE, r.data(), r.size());
+    }
+
+    std::vector<char> received(records.size());
+    size_t bytes = 0;
+    bool connected = false, wrote = false;
+    Parallel::run(2, [&](size_t w) {
+        if (0 == w) {
+            connected = Pipe::connect(server);
+            bytes = Pipe::read_full(server, received.data(), received.size());
+            return;
+        }
+        File client = Pipe::open_named(name.c_str(), GENERIC_WRITE);
+        wrote = client.is_opened() && Pipe::write_records(client, records.data(), count);
+    });
+
+    EXPECT_TRUE(connected);
+    EXPECT_TRUE(wrote);
+    ASSERT_EQ(records.size(), bytes);
+    EXPECT_EQ(records, received);
+}
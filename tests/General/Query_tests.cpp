@@ -0,0 +1,134 @@
+/**
+ * @file Query_tests.cpp
+ * @brief Unit tests for the batch query engine using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeColumns.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/Query.h>
+
+using namespace core::General;
+
+class QueryTest : public ::testing::Test {
+protected:
+    EmployeeColumns table_;
+
+    void SetUp() override {
+        static const char* names[] = { "Ivanov", "Ivanova", "Petrov", "Ivanovskiy-Long", "Sidorov" };
+        for (size_t i = 0; i < 5003; i++) {
+            double h = (i % 101 == 0) ? std::numeric_limits<double>::quiet_NaN()
+                                      : static_cast<double>((i * 37) % 200) / 2.0;
+            table_.push_back(Employee(static_cast<Employee::ID_TYPE>((i * 7919) % 65536), names[i % 5], h));
+        }
+    }
+
+    template <class Match>
+    std::vector<uint64_t> Expected(Match match) const {
+        std::vector<uint64_t> rows;
+        for (size_t i = 0; i < table_.size(); i++)
+            if (match(table_.ids()[i], table_.hours()[i], table_.names()[i].data()))
+                rows.push_back(i);
+        return rows;
+    }
+};
+
+TEST_F(QueryTest, RangesAndPrefixes) {
+    Query q;
+    q.where(Predicate::id_between(1000, 30000)).select(Query::COLUMN_ROW);
+    EXPECT_EQ(Expected([](Employee::ID_TYPE id, double, const char*) { return 1000 <= id && id <= 30000; }),
+              q.run(table_).rows);
+
+    q.where(Predicate::hours_between(10.0, 20.5));
+    EXPECT_EQ(Expected([](Employee::ID_TYPE, double h, const char*) { return 10.0 <= h && h <= 20.5; }),
+              q.run(table_).rows);
+
+    q.where(Predicate::name_starts_with("Ivanov"));
+    EXPECT_EQ(Expected([](Employee::ID_TYPE, double, const char* n) { return 0 == strncmp(n, "Ivanov", 6); }),
+              q.run(table_).rows);
+
+    // Longer than one word takes the byte-wise path
+    q.where(Predicate::name_starts_with("Ivanovskiy"));
+    EXPECT_EQ(Expected([](Employee::ID_TYPE, double, const char* n) { return 0 == strncmp(n, "Ivanovskiy", 10); }),
+              q.run(table_).rows);
+
+    q.where(Predicate::id_between(10, 5));
+    EXPECT_EQ(0u, q.run(table_).totals.count);
+}
+
+TEST_F(QueryTest, AndOrTreesAndProjection) {
+    Query q;
+    q.where((Predicate::name_starts_with("Iv") && Predicate::hours_between(50, 99))
+            || Predicate::id_between(0, 999))
+     .select(Query::COLUMN_ROW | Query::COLUMN_ID | Query::COLUMN_HOURS | Query::COLUMN_NAME);
+    QueryResult r = q.run(table_);
+
+    auto match = [](Employee::ID_TYPE id, double h, const char* n) {
+        return (0 == strncmp(n, "Iv", 2) && 50 <= h && h <= 99) || id <= 999;
+    };
+    std::vector<uint64_t> expected = Expected(match);
+    ASSERT_EQ(expected, r.rows);
+    ASSERT_EQ(expected.size(), r.ids.size());
+    ASSERT_EQ(expected.size(), r.names.size());
+
+    double sum = 0;
+    for (size_t k = 0; k < expected.size(); k++) {
+        EXPECT_EQ(table_.ids()[expected[k]], r.ids[k]);
+        EXPECT_EQ(table_.names()[expected[k]], r.names[k]);
+        sum += table_.hours()[expected[k]];
+    }
+    EXPECT_EQ(expected.size(), r.totals.count);
+    if (std::isnan(sum)) {
+        EXPECT_TRUE(std::isnan(r.totals.hours_sum));
+    } else {
+        EXPECT_DOUBLE_EQ(sum, r.totals.hours_sum);
+    }
+}
+
+TEST_F(QueryTest, TotalsIgnoreNaNInRanges) {
+    Query q;
+    q.where(Predicate::hours_between(-1e9, 1e9));
+    QueryResult r = q.run(table_);
+    EXPECT_EQ(table_.size() - (table_.size() + 100) / 101, r.totals.count);
+    EXPECT_EQ(0.0, r.totals.hours_min);
+    EXPECT_EQ(99.5, r.totals.hours_max);
+    EXPECT_TRUE(r.rows.empty());
+}
+
+TEST_F(QueryTest, RunsOverFiles) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    {
+        EmployeeFileWriter w(f);
+        for (size_t i = 0; i < table_.size(); i++)
+            ASSERT_TRUE(w.append(table_.employee(i)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    Query q;
+    q.where(Predicate::hours_between(30, 40) && Predicate::name_starts_with("Petrov"))
+     .select(Query::COLUMN_ROW);
+    auto from_file = q.run(f);
+    ASSERT_TRUE(from_file.has_value());
+    QueryResult in_memory = q.run(table_);
+    EXPECT_EQ(in_memory.rows, from_file->rows);
+    EXPECT_EQ(in_memory.totals.count, from_file->totals.count);
+    EXPECT_EQ(in_memory.totals.hours_sum, from_file->totals.hours_sum);
+}
@@ -0,0 +1,182 @@
+/**
+ * @file RangeLock_tests.cpp
+ * @brief Unit tests for byte-range file locks using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <atomic>
+#include <string>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/EmployeeStore.h>
+#include <core/General/File.h>
+#include <core/General/Parallel.h>
+#include <core/General/RangeLock.h>
+
+using namespace core::General;
+
+namespace {
+    // Locks are per handle, so contention needs two handles on one path
+    struct SharedFile {
+        std::string path;
+        File first, second;
+
+        SharedFile() {
+            char temp[MAX_PATH] = {};
+            GetTempPathA(MAX_PATH, temp);
+            path = std::string(temp) + "RangeLockTest-" + std::to_string(GetTickCount64()) + ".bin";
+            first = File::open(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                               nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            second = File::open(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        }
+
+        ~SharedFile() {
+            first.close();
+            second.close();
+            DeleteFileA(path.c_str());
+        }
+    };
+}
+
+TEST(RangeLockTest, SharedAndExclusiveRanges) {
+    SharedFile f;
+    ASSERT_TRUE(f.first.is_opened());
+    ASSERT_TRUE(f.second.is_opened());
+
+    auto reader = RangeLock::try_acquire(f.first, 0, 100, LockMode::shared);
+    ASSERT_TRUE(reader.has_value());
+    {
+        // Readers share, writers wait
+        auto other_reader = RangeLock::try_acquire(f.second, 50, 10, LockMode::shared);
+        EXPECT_TRUE(other_reader.has_value());
+    }
+    EXPECT_FALSE(RangeLock::try_acquire(f.second, 50, 10, LockMode::exclusive).has_value());
+
+    // Disjoint ranges never contend, even past the end of the file
+    auto writer = RangeLock::try_acquire(f.second, 100, 1 << 20, LockMode::exclusive);
+    ASSERT_TRUE(writer.has_value());
+    EXPECT_EQ(100u, writer->offset());
+    EXPECT_EQ(LockMode::exclusive, writer->mode());
+
+    ULONGLONG start = GetTickCount64();
+    EXPECT_FALSE(RangeLock::acquire(f.second, 0, 10, LockMode::exclusive, 60).has_value());
+    EXPECT_GE(GetTickCount64() - start, 40u);
+
+    EXPECT_TRUE(reader->release());
+    EXPECT_FALSE(reader->release());
+    EXPECT_TRUE(RangeLock::try_acquire(f.second, 0, 10, LockMode::exclusive).has_value());
+
+    EXPECT_FALSE(f.first.lockRange(0, 0, true, 0));
+}
+
+TEST(RangeLockTest, WaiterProceedsAfterRelease) {
+    SharedFile f;
+    ASSERT_TRUE(f.first.is_opened());
+    ASSERT_TRUE(f.second.is_opened());
+
+    auto held = RangeLock::acquire(f.first, 4096, 512, LockMode::exclusive);
+    ASSERT_TRUE(held.has_value());
+
+    std::atomic<bool> released(false), acquired(false), early(false);
+    Parallel::run(2, [&](size_t i) {
+        if (0 == i) {
+            Sleep(50);
+            released = true;
+            held->release();
+        } else {
+            auto lock = RangeLock::acquire(f.second, 4000, 200, LockMode::exclusive, 5000);
+            acquired = lock.has_value();
+            early = !released;
+        }
+    });
+    EXPECT_TRUE(acquired);
+    EXPECT_FALSE(early);
+}
+
+TEST(RangeLockTest, LocksRecordRanges) {
+    SharedFile f;
+    ASSERT_TRUE(f.first.is_opened());
+    ASSERT_TRUE(f.second.is_opened());
+    {
+        EmployeeFileWriter w(f.first, 16, 4096, EmployeeLayout::aligned);
+        for (int i = 0; i < 100; i++)
+            ASSERT_TRUE(w.append(Employee(static_cast<Employee::ID_TYPE>(i), "Locked", i)));
+        ASSERT_TRUE(w.finish());
+    }
+    auto header = EmployeeFileHeader::read(f.second);
+    ASSERT_TRUE(header.has_value());
+
+    // Records 10..19 widen to the blocks of records 0..31
+    auto mine = RangeLock::records(f.first, *header, 10, 10, LockMode::exclusive);
+    ASSERT_TRUE(mine.has_value());
+    EXPECT_EQ(header->record_offset(0), mine->offset());
+    EXPECT_EQ(32u * header->record_size, mine->length());
+
+    // Records of other blocks stay available to the other writer; records sharing a block do not
+    EXPECT_TRUE(RangeLock::records(f.second, *header, 32, 10, LockMode::exclusive, 0).has_value());
+    EXPECT_TRUE(RangeLock::records(f.second, *header, 95, 5, LockMode::exclusive, 0).has_value());
+    EXPECT_FALSE(RangeLock::records(f.second, *header, 20, 1, LockMode::shared, 0).has_value());
+    EXPECT_FALSE(RangeLock::records(f.second, *header, 0, 1, LockMode::shared, 0).has_value());
+    EXPECT_FALSE(RangeLock::records(f.second, *header, 95, 10, LockMode::shared, 0).has_value());
+
+    // The last block ends with the records
+    auto tail = RangeLock::records(f.second, *header, 97, 1, LockMode::shared, 0);
+    ASSERT_TRUE(tail.has_value());
+    EXPECT_EQ(header->record_offset(96), tail->offset());
+    EXPECT_EQ(4u * header->record_size, tail->length());
+
+    // Moving the guard moves the lock
+    RangeLock moved = std::move(*mine);
+    EXPECT_FALSE(mine->owns());
+    EXPECT_TRUE(moved.owns());
+    moved = RangeLock();
+    EXPECT_TRUE(RangeLock::records(f.second, *header, 19, 1, LockMode::shared, 0).has_value());
+}
+
+TEST(RangeLockTest, StoresShareABlockUnderRecordLocks) {
+    SharedFile f;
+    ASSERT_TRUE(f.first.is_opened());
+    ASSERT_TRUE(f.second.is_opened());
+    {
+        EmployeeFileWriter w(f.first, 64);
+        for (int i = 0; i < 100; i++)
+            ASSERT_TRUE(w.append(Employee(static_cast<Employee::ID_TYPE>(i), "Locked", 0.0)));
+        ASSERT_TRUE(w.finish());
+    }
+
+    // Two writers, one handle each, alternate records of block 0 and flush before releasing
+    std::atomic<bool> ok(true);
+    Parallel::run(2, [&](size_t w) {
+        const File& file = 0 == w ? f.first : f.second;
+        auto store = EmployeeStore::open(file);
+        if (!store.has_value()) {
+            ok = false;
+            return;
+        }
+        for (uint64_t r = w; r < 64; r += 2) {
+            auto lock = RangeLock::records(file, store->reader().header(), r, 1, LockMode::exclusive, 10000);
+            if (!lock.has_value() || !store->set_hours(r, double(r) + 0.5) || !store->flush())
+                ok = false;
+        }
+    });
+    EXPECT_TRUE(ok);
+
+    // Every update landed and the shared block checksum covers all of them
+    auto reader = EmployeeFileReader::open(f.first);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_TRUE(reader->verify());
+    for (uint64_t r = 0; r < 64; r++)
+        EXPECT_EQ(double(r) + 0.5, reader->at(r)->hours());
+}
@@ -0,0 +1,96 @@
+/**
+ * @file RecordSchema_tests.cpp
+ * @brief Unit tests for compile-time record schemas and Employee serialization.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeView.h>
+#include <core/General/RecordSchema.h>
+
+using namespace core::General;
+
+namespace
+{
+    typedef RecordSchema<Field<uint8_t>, Field<uint32_t>, Field<char, 3>, Field<double>> Mixed;
+
+    static_assert(1 + 4 + 3 + 8 == Mixed::SIZE, "Schema must be packed");
+    static_assert(0 == Mixed::offset<0>(), "First field starts the record");
+    static_assert(1 == Mixed::offset<1>(), "No alignment padding");
+    static_assert(5 == Mixed::offset<2>(), "Array field offset");
+    static_assert(8 == Mixed::offset<3>(), "Trailing field offset");
+    static_assert(25 == Employee::SERIALIZED_SIZE, "Employee layout is unchanged");
+    static_assert(2 == Employee::Schema::offset<Employee::FIELD_HOURS>(), "Hours follow the ID");
+    static_assert(10 == Employee::Schema::offset<Employee::FIELD_NAME>(), "Name follows the hours");
+}
+
+TEST(RecordSchemaTest, EncodeDecodeRoundTrip) {
+    uint8_t a = 7;
+    uint32_t b = 0xDEADBEEF;
+    char c[3] = { 'x', 'y', 'z' };
+    double d = -2.5;
+
+    char buf[Mixed::SIZE];
+    Mixed::encode(buf, &a, &b, c, &d);
+
+    EXPECT_EQ(a, Mixed::read<0>(buf));
+    EXPECT_EQ(b, Mixed::read<1>(buf));
+    EXPECT_EQ(d, Mixed::read<3>(buf));
+
+    uint8_t a2 = 0;
+    uint32_t b2 = 0;
+    char c2[3] = {};
+    double d2 = 0;
+    Mixed::decode(buf, &a2, &b2, c2, &d2);
+    EXPECT_EQ(a, a2);
+    EXPECT_EQ(b, b2);
+    EXPECT_EQ(0, memcmp(c, c2, 3));
+    EXPECT_EQ(d, d2);
+
+    Mixed::write<3>(buf, 4.0);
+    EXPECT_EQ(4.0, Mixed::read<3>(buf));
+    EXPECT_EQ(b, Mixed::read<1>(buf));
+}
+
+TEST(RecordSchemaTest, EmployeeMatchesHandWrittenLayout) {
+    Employee e(513, "Romanchuck", 37.25);
+    auto rec = e.serialize();
+
+    // Layout documented in Employee.h: [ID][Hours][NameBuffer]
+    Employee::ID_TYPE id;
+    double hours;
+    memcpy(&id, &rec[0], sizeof(id));
+    memcpy(&hours, &rec[sizeof(id)], sizeof(hours));
+    EXPECT_EQ(513, id);
+    EXPECT_EQ(37.25, hours);
+    EXPECT_EQ(0, memcmp("Romanchuck", &rec[sizeof(id) + sizeof(hours)], 10));
+
+    EmployeeView v(rec.data());
+    EXPECT_EQ(513, v.id());
+    EXPECT_EQ(37.25, v.hours());
+    EXPECT_STREQ("Romanchuck", v.name());
+}
+
+TEST(RecordSchemaTest, BatchRoundTrip) {
+    std::vector<Employee> src;
+    for (int i = 0; i < 10; i++)
+        src.emplace_back(static_cast<Employee::ID_TYPE>(i), "batch", i * 1.5);
+
+    std::vector<char> buf(src.size() * Employee::SERIALIZED_SIZE);
+    Employee::serialize_batch(src.data(), src.size(), buf.data());
+
+    std::vector<Employee> back(src.size());
+    Employee::deserialize_batch(buf.data(), back.size(), back.data());
+    for (size_t i = 0; i < src.size(); i++) {
+        EXPECT_EQ(src[i].id(), back[i].id());
+        EXPECT_EQ(src[i].hours(), back[i].hours());
+        EXPECT_STREQ(src[i].name(), back[i].name());
+        EXPECT_EQ(src[i].hours(), EmployeeView(&buf[i * Employee::SERIALIZED_SIZE]).hours());
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file TextExport_tests.cpp
+ * @brief Unit tests for the text exporter using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/TextExport.h>
+#include <core/General/TextImport.h>
+
+using namespace core::General;
+
+namespace {
+    std::string Format(const Employee& e, TextFormat format) {
+        char line[TextExport::MAX_LINE];
+        auto rec = e.serialize();
+        return std::string(line, TextExport::format_record(rec.data(), format, line));
+    }
+
+    std::string ReadAll(const File& f) {
+        auto size = f.getFileSize64();
+        std::string s(static_cast<size_t>(size.value_or(0)), '\0');
+        if (!s.empty()) f.readAt(&s[0], static_cast<DWORD>(s.size()), 0);
+        return s;
+    }
+}
+
+TEST(TextExportFormatTest, FormatsEachLayout) {
+    Employee e(42, "Ivanov", 37.5);
+    EXPECT_EQ("42,Ivanov,37.5\n", Format(e, TextFormat::csv));
+    EXPECT_EQ("42\tIvanov\t37.5\n", Format(e, TextFormat::tsv));
+    EXPECT_EQ("{\"id\":42,\"name\":\"Ivanov\",\"hours\":37.5}\n", Format(e, TextFormat::jsonl));
+}
+
+TEST(TextExportFormatTest, EscapesNames) {
+    Employee quoted(1, "Smith, \"Jr\"", 0.1);
+    EXPECT_EQ("1,\"Smith, \"\"Jr\"\"\",0.1\n", Format(quoted, TextFormat::csv));
+    EXPECT_EQ("{\"id\":1,\"name\":\"Smith, \\\"Jr\\\"\",\"hours\":0.1}\n", Format(quoted, TextFormat::jsonl));
+
+    Employee tabbed(2, "A\tB\\", -2.0);
+    EXPECT_EQ("2\tA B\\\t-2\n", Format(tabbed, TextFormat::tsv));
+    EXPECT_EQ("{\"id\":2,\"name\":\"A\\u0009B\\\\\",\"hours\":-2}\n", Format(tabbed, TextFormat::jsonl));
+
+    // Line breaks would split the record for TextImport, even inside quotes
+    Employee broken(3, "Jo\r\n\"Ann\"", 1.0);
+    EXPECT_EQ("3,\"Jo  \"\"Ann\"\"\",1\n", Format(broken, TextFormat::csv));
+    EXPECT_EQ("3,Line Two,1\n", Format(Employee(3, "Line\nTwo", 1.0), TextFormat::csv));
+    EXPECT_EQ("3\tJo  \"Ann\"\t1\n", Format(broken, TextFormat::tsv));
+    EXPECT_EQ("{\"id\":3,\"name\":\"Jo\\u000d\\u000a\\\"Ann\\\"\",\"hours\":1}\n", Format(broken, TextFormat::jsonl));
+
+    // A full 15-byte name has no terminator in the record
+    Employee full(65535, "ABCDEFGHIJKLMNO", std::numeric_limits<double>::infinity());
+    EXPECT_EQ("65535,ABCDEFGHIJKLMNO,inf\n", Format(full, TextFormat::csv));
+    EXPECT_EQ("{\"id\":65535,\"name\":\"ABCDEFGHIJKLMNO\",\"hours\":null}\n", Format(full, TextFormat::jsonl));
+}
+
+TEST(TextExportTest, ParallelExportRoundTripsThroughImport) {
+    File binary = File::openTemporary();
+    File text = File::openTemporary();
+    File back = File::openTemporary();
+    ASSERT_TRUE(binary.is_opened() && text.is_opened() && back.is_opened());
+
+    std::vector<Employee> employees;
+    {
+        EmployeeFileWriter w(binary);
+        for (size_t i = 0; i < 20000; i++) {
+            const char* name = i % 7 == 3 ? "Two\nLines" : i % 5 ? "Petrov" : "O\"Neil, J";
+            employees.emplace_back(static_cast<Employee::ID_TYPE>(i * 13), name,
+                                   std::sqrt(static_cast<double>(i)) - 50.0);
+            ASSERT_TRUE(w.append(employees.back()));
+        }
+        ASSERT_TRUE(w.finish());
+    }
+
+    TextExportOptions opt;
+    opt.write_header = true;
+    opt.threads = 4;
+    opt.chunk_records = TextExport::MIN_CHUNK_RECORDS;
+    auto written = TextExport::run(binary, text, opt);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(employees.size(), written.value());
+
+    // Ordered concatenation: the same bytes as a single-threaded export
+    File single = File::openTemporary();
+    opt.threads = 1;
+    ASSERT_TRUE(TextExport::run(binary, single, opt).has_value());
+    EXPECT_EQ(ReadAll(single), ReadAll(text));
+
+    TextImportOptions in;
+    in.skip_header = true;
+    auto imported = TextImport::run(text, back, in);
+    ASSERT_TRUE(imported.has_value());
+    EXPECT_EQ(0u, imported->bad_lines);
+
+    auto reader = EmployeeFileReader::open(back);
+    ASSERT_TRUE(reader.has_value());
+    ASSERT_EQ(employees.size(), reader->size());
+    for (size_t i = 0; i < employees.size(); i += 997) {
+        auto e = reader->at(i);
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(employees[i].id(), e->id());
+        // Line breaks in names come back as spaces
+        std::string name = employees[i].name();
+        std::replace(name.begin(), name.end(), '\n', ' ');
+        EXPECT_EQ(name, e->name());
+        EXPECT_EQ(employees[i].hours(), e->hours());
+    }
+}
@@ -0,0 +1,151 @@
+/**
+ * @file TextImport_tests.cpp
+ * @brief Unit tests for the CSV/TSV importer using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <string>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/TextImport.h>
+
+using namespace core::General;
+
+namespace {
+    bool Parse(const std::string& line, TextFormat format, Employee& out) {
+        char record[Employee::SERIALIZED_SIZE];
+        if (!TextImport::parse_line(line.data(), line.data() + line.size(), format, record))
+            return false;
+        out = Employee::deserialize(record);
+        return true;
+    }
+}
+
+class TextImportTest : public ::testing::Test {
+protected:
+    File input_;
+    File output_;
+
+    void SetUp() override {
+        input_ = File::openTemporary();
+        output_ = File::openTemporary();
+        ASSERT_TRUE(input_.is_opened());
+        ASSERT_TRUE(output_.is_opened());
+    }
+
+    void WriteText(const std::string& text) {
+        ASSERT_TRUE(input_.writeAt(text.data(), static_cast<DWORD>(text.size()), 0));
+    }
+};
+
+TEST(TextImportLineTest, ParsesCsvFields) {
+    Employee e;
+    ASSERT_TRUE(Parse("42,Ivanov,37.5", TextFormat::csv, e));
+    EXPECT_EQ(42, e.id());
+    EXPECT_STREQ("Ivanov", e.name());
+    EXPECT_EQ(37.5, e.hours());
+
+    ASSERT_TRUE(Parse("7,\"Smith, \"\"Jr\"\"\",-1e2", TextFormat::csv, e));
+    EXPECT_STREQ("Smith, \"Jr\"", e.name());
+    EXPECT_EQ(-100.0, e.hours());
+
+    ASSERT_TRUE(Parse("65535,,0", TextFormat::csv, e));
+    EXPECT_EQ(65535, e.id());
+    EXPECT_STREQ("", e.name());
+
+    ASSERT_TRUE(Parse("1\tA, B\t2.25", TextFormat::tsv, e));
+    EXPECT_STREQ("A, B", e.name());
+}
+
+TEST(TextImportLineTest, RejectsMalformedLines) {
+    Employee e;
+    EXPECT_FALSE(Parse("65536,Big,1", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("-1,Neg,1", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("x1,Bad,1", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("1,Name", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("1,Name,abc", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("1,Name,2,extra", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("1,ThisNameIsTooLong,2", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("1,\"unterminated,2", TextFormat::csv, e));
+    EXPECT_FALSE(Parse("1,Name,2", TextFormat::tsv, e));
+}
+
+TEST_F(TextImportTest, ImportsInParallelInOrder) {
+    // Enough text for several slices at the minimum chunk size
+    std::string text = "id,name,hours\r\n";
+    const size_t n = 60000;
+    for (size_t i = 0; i < n; i++)
+        text += std::to_string(i % 65536) + ",N" + std::to_string(i % 997) + "," + std::to_string(i) + ".5\r\n";
+    WriteText(text);
+
+    TextImportOptions opt;
+    opt.skip_header = true;
+    opt.threads = 4;
+    opt.chunk_size = TextImport::MIN_CHUNK_SIZE;
+    auto result = TextImport::run(input_, output_, opt);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(n + 1, result->lines);
+    EXPECT_EQ(n, result->records);
+    EXPECT_EQ(0u, result->bad_lines);
+
+    auto reader = EmployeeFileReader::open(output_);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_TRUE(reader->versioned());
+    ASSERT_EQ(n, reader->size());
+    EXPECT_TRUE(reader->verify());
+    for (size_t i : { size_t(0), size_t(12345), n - 1 }) {
+        auto e = reader->at(i);
+        ASSERT_TRUE(e.has_value());
+        EXPECT_EQ(i % 65536, e->id());
+        EXPECT_EQ(("N" + std::to_string(i % 997)), e->name());
+        EXPECT_EQ(static_cast<double>(i) + 0.5, e->hours());
+    }
+}
+
+TEST_F(TextImportTest, CountsBadLinesAndSkipsBlanks) {
+    WriteText("1\tA\t1\n\nbroken line\n2\tB\t2\n3\tC\tx\n4\tD\t4");
+    TextImportOptions opt;
+    opt.format = TextFormat::tsv;
+    opt.headerless_output = true;
+    auto result = TextImport::run(input_, output_, opt);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(6u, result->lines);
+    EXPECT_EQ(3u, result->records);
+    EXPECT_EQ(2u, result->bad_lines);
+    EXPECT_EQ(3u, result->first_bad_line);
+
+    auto reader = EmployeeFileReader::open(output_);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_FALSE(reader->versioned());
+    ASSERT_EQ(3u, reader->size());
+    EXPECT_STREQ("D", reader->at(2)->name());
+}
+
+TEST_F(TextImportTest, LineLongerThanTheWindow) {
+    // A single line longer than one round forces the window to grow
+    std::string text = "1,A,1\n2,B," + std::string(TextImport::MIN_CHUNK_SIZE * 2, '0') + "3\n4,C,4\n";
+    WriteText(text);
+    TextImportOptions opt;
+    opt.threads = 1;
+    opt.chunk_size = TextImport::MIN_CHUNK_SIZE;
+    auto result = TextImport::run(input_, output_, opt);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(3u, result->records);
+
+    auto reader = EmployeeFileReader::open(output_);
+    ASSERT_TRUE(reader.has_value());
+    EXPECT_EQ(3.0, reader->at(1)->hours());
+}
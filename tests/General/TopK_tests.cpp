@@ -0,0 +1,145 @@
+/**
+ * @file TopK_tests.cpp
+ * @brief Unit tests for the parallel top-K operator using GoogleTest.
+ * @author Timofei Romanchuck
+ * @date 2026-10-16
+ */
+
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+
+#include <gtest/gtest.h>
+#include <Windows.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <core/General/Employee.h>
+#include <core/General/EmployeeColumns.h>
+#include <core/General/EmployeeFile.h>
+#include <core/General/File.h>
+#include <core/General/FileMapping.h>
+#include <core/General/TopK.h>
+
+using namespace core::General;
+
+class TopKTest : public ::testing::Test {
+protected:
+    EmployeeColumns table_;
+
+    void SetUp() override {
+        for (size_t i = 0; i < 300007; i++) {
+            double h = (i % 997 == 0) ? std::numeric_limits<double>::quiet_NaN()
+                                      : static_cast<double>((i * 2654435761u) % 100000) / 8.0;
+            table_.push_back(Employee(static_cast<Employee::ID_TYPE>(i % 65536), "Worker", h));
+        }
+    }
+
+    std::vector<uint64_t> Expected(size_t k) const {
+        std::vector<uint64_t> rows;
+        for (size_t i = 0; i < table_.size(); i++)
+            if (!std::isnan(table_.hours()[i]))
+                rows.push_back(i);
+        const std::vector<double>& h = table_.hours();
+        std::stable_sort(rows.begin(), rows.end(), [&](uint64_t a, uint64_t b) { return h[a] > h[b]; });
+        rows.resize(std::min(k, rows.size()));
+        return rows;
+    }
+
+    static std::vector<uint64_t> Rows(const std::vector<TopKEntry>& entries) {
+        std::vector<uint64_t> rows;
+        for (const TopKEntry& e : entries)
+            rows.push_back(e.row);
+        return rows;
+    }
+
+    void WriteFile(const File& f, EmployeeLayout layout = EmployeeLayout::compact) const {
+        EmployeeFileWriter w(f, EmployeeFileHeader::DEFAULT_BLOCK_RECORDS, 1 << 20, layout);
+        for (size_t i = 0; i < table_.size(); i++)
+            ASSERT_TRUE(w.append(table_.employee(i)));
+        ASSERT_TRUE(w.finish());
+    }
+};
+
+TEST_F(TopKTest, TableMatchesFullSort) {
+    TopKOptions opts;
+    opts.threads = 4;
+    for (size_t k : { size_t(1), size_t(100), size_t(5000) }) {
+        std::vector<TopKEntry> top = TopK::by_hours(table_, k, opts);
+        EXPECT_EQ(Expected(k), Rows(top)) << "k = " << k;
+    }
+    EXPECT_TRUE(TopK::by_hours(table_, 0, opts).empty());
+}
+
+TEST(TopKSmallTest, KLargerThanInputSkipsNaN) {
+    EmployeeColumns small;
+    small.push_back(Employee(1, "A", 3.0));
+    small.push_back(Employee(2, "B", std::numeric_limits<double>::quiet_NaN()));
+    small.push_back(Employee(3, "C", 3.0));
+    small.push_back(Employee(4, "D", 5.0));
+    std::vector<TopKEntry> top = TopK::by_hours(small, 10);
+    ASSERT_EQ(3u, top.size());
+    EXPECT_EQ(4, top[0].employee.id());
+    EXPECT_EQ(1, top[1].employee.id());
+    EXPECT_EQ(3, top[2].employee.id());
+}
+
+TEST_F(TopKTest, FileMappedAndBuffered) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    WriteFile(f);
+
+    FileMapping mapping = FileMapping::open(f);
+    ASSERT_TRUE(mapping.is_mapped());
+    EXPECT_EQ(*f.getFileSize64(), mapping.size());
+
+    std::vector<uint64_t> expected = Expected(100);
+    TopKOptions opts;
+    opts.threads = 3;
+    for (bool map : { true, false }) {
+        opts.map_file = map;
+        auto top = TopK::by_hours(f, 100, opts);
+        ASSERT_TRUE(top.has_value());
+        EXPECT_EQ(expected, Rows(*top)) << "map_file = " << map;
+        for (const TopKEntry& e : *top)
+            EXPECT_EQ(table_.employee(e.row).hours(), e.employee.hours());
+    }
+}
+
+TEST_F(TopKTest, AlignedFileReadInPlace) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    WriteFile(f, EmployeeLayout::aligned);
+
+    TopKOptions opts;
+    opts.threads = 3;
+    auto top = TopK::by_hours(f, 100, opts);
+    ASSERT_TRUE(top.has_value());
+    EXPECT_EQ(Expected(100), Rows(*top));
+}
+
+TEST_F(TopKTest, HugeKReturnsEveryRow) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    WriteFile(f);
+
+    // k is clamped to the row count instead of sizing heaps by it
+    std::vector<uint64_t> expected = Expected(table_.size());
+    EXPECT_EQ(expected, Rows(TopK::by_hours(table_, SIZE_MAX)));
+    auto top = TopK::by_hours(f, SIZE_MAX);
+    ASSERT_TRUE(top.has_value());
+    EXPECT_EQ(expected, Rows(*top));
+}
+
+TEST(FileMappingTest, EmptyFileIsNotMapped) {
+    File f = File::openTemporary();
+    ASSERT_TRUE(f.is_opened());
+    FileMapping mapping = FileMapping::open(f);
+    EXPECT_FALSE(mapping.is_mapped());
+    EXPECT_EQ(nullptr, mapping.data());
+}